@@ -0,0 +1,431 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_socket_ref_server.c
+* @{
+*
+* This file contains a reference server for the socket backend of the driver.
+*
+* The server models the AIE address space as sparse memory. It listens on the
+* loopback interface and writes its port number to
+* ./mesim_output/mesimulator_aximm_port, where the socket backend looks for
+* the simulator port. Applications built with the socket backend (-D
+* __AIESOCKET__) and started from the same directory connect to it.
+*
+* Both the text protocol of the simulator and the binary framed protocol are
+* supported. Set XAIE_SOCKET_PROTOCOL=binary in the environment of the
+* application to use the binary protocol.
+*
+* Usage: xaie_socket_ref_server [port [number of clients]]
+* The default port 0 selects a free port, and one client is served by default.
+* The server prints the number of commands and round trips of each client.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* 1.1   Tejus   10/16/2026  Add block read frames
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/************************** Constant Definitions *****************************/
+#define PORT_FILE_DIR		"./mesim_output"
+#define PORT_FILE		PORT_FILE_DIR "/mesimulator_aximm_port"
+#define LINE_MAX_LEN		64U
+#define REG_MAP_MIN_SIZE	4096U
+
+/* Binary protocol, see xaie_socket.c */
+#define FRAME_HDR_SIZE		16U
+#define FRAME_OP_WRITE		0x1U
+#define FRAME_OP_READ		0x2U
+#define FRAME_OP_BLOCKWRITE	0x3U
+#define FRAME_OP_BLOCKSET	0x4U
+#define FRAME_OP_BLOCKREAD	0x5U
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint64_t Addr;
+	uint32_t Value;
+	uint8_t Valid;
+} RegEntry;
+
+/* Sparse model of the address space */
+typedef struct {
+	RegEntry *Entries;
+	size_t Size;
+	size_t NumEntries;
+} RegMap;
+
+typedef struct {
+	int Fd;
+	uint8_t Buf[65536];
+	size_t Len;
+	size_t Pos;
+} Conn;
+
+typedef struct {
+	unsigned long Cmds;
+	unsigned long Words;
+	unsigned long Reads;
+} Stats;
+
+/************************** Function Definitions *****************************/
+static size_t RegSlot(const RegMap *Map, uint64_t Addr)
+{
+	size_t i = (size_t)((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) &
+		(Map->Size - 1U);
+
+	while(Map->Entries[i].Valid && Map->Entries[i].Addr != Addr) {
+		i = (i + 1U) & (Map->Size - 1U);
+	}
+
+	return i;
+}
+
+static int RegGrow(RegMap *Map)
+{
+	RegMap New;
+
+	New.Size = (Map->Size == 0U) ? REG_MAP_MIN_SIZE : Map->Size * 2U;
+	New.NumEntries = Map->NumEntries;
+	New.Entries = calloc(New.Size, sizeof(*New.Entries));
+	if(New.Entries == NULL) {
+		return -1;
+	}
+
+	for(size_t i = 0U; i < Map->Size; i++) {
+		if(Map->Entries[i].Valid) {
+			New.Entries[RegSlot(&New, Map->Entries[i].Addr)] =
+				Map->Entries[i];
+		}
+	}
+
+	free(Map->Entries);
+	*Map = New;
+
+	return 0;
+}
+
+static int RegWrite(RegMap *Map, uint64_t Addr, uint32_t Value)
+{
+	size_t i;
+
+	if((Map->NumEntries + 1U) * 2U > Map->Size && RegGrow(Map) != 0) {
+		fprintf(stderr, "Out of memory\n");
+		return -1;
+	}
+
+	i = RegSlot(Map, Addr);
+	if(!Map->Entries[i].Valid) {
+		Map->Entries[i].Valid = 1U;
+		Map->Entries[i].Addr = Addr;
+		Map->NumEntries++;
+	}
+	Map->Entries[i].Value = Value;
+
+	return 0;
+}
+
+static uint32_t RegRead(const RegMap *Map, uint64_t Addr)
+{
+	size_t i;
+
+	if(Map->Size == 0U) {
+		return 0U;
+	}
+
+	i = RegSlot(Map, Addr);
+
+	return Map->Entries[i].Valid ? Map->Entries[i].Value : 0U;
+}
+
+/* Returns the next byte of the connection, -1 on end of connection */
+static int ConnGetc(Conn *C)
+{
+	ssize_t Ret;
+
+	if(C->Pos == C->Len) {
+		do {
+			Ret = read(C->Fd, C->Buf, sizeof(C->Buf));
+		} while(Ret < 0 && errno == EINTR);
+		if(Ret <= 0) {
+			return -1;
+		}
+		C->Len = (size_t)Ret;
+		C->Pos = 0U;
+	}
+
+	return C->Buf[C->Pos++];
+}
+
+static int ConnRead(Conn *C, void *Buf, size_t Len)
+{
+	uint8_t *Ptr = Buf;
+
+	while(Len > 0U) {
+		size_t Avail = C->Len - C->Pos;
+		int Ch;
+
+		if(Avail == 0U) {
+			Ch = ConnGetc(C);
+			if(Ch < 0) {
+				return -1;
+			}
+			*Ptr++ = (uint8_t)Ch;
+			Len--;
+			continue;
+		}
+
+		if(Avail > Len) {
+			Avail = Len;
+		}
+		memcpy(Ptr, C->Buf + C->Pos, Avail);
+		C->Pos += Avail;
+		Ptr += Avail;
+		Len -= Avail;
+	}
+
+	return 0;
+}
+
+static int ConnWrite(int Fd, const void *Buf, size_t Len)
+{
+	const uint8_t *Ptr = Buf;
+	ssize_t Ret;
+
+	while(Len > 0U) {
+		Ret = write(Fd, Ptr, Len);
+		if(Ret < 0 && errno == EINTR) {
+			continue;
+		}
+		if(Ret <= 0) {
+			return -1;
+		}
+		Ptr += Ret;
+		Len -= (size_t)Ret;
+	}
+
+	return 0;
+}
+
+static uint32_t GetU32(const uint8_t *Buf)
+{
+	return (uint32_t)Buf[0] | ((uint32_t)Buf[1] << 8U) |
+		((uint32_t)Buf[2] << 16U) | ((uint32_t)Buf[3] << 24U);
+}
+
+static int ServeBinary(Conn *C, RegMap *Map, Stats *St)
+{
+	uint8_t Hdr[FRAME_HDR_SIZE], Word[4];
+	uint64_t Addr;
+	uint32_t NumWords, Value;
+
+	while(ConnRead(C, Hdr, sizeof(Hdr)) == 0) {
+		NumWords = GetU32(&Hdr[4]);
+		Addr = (uint64_t)GetU32(&Hdr[8]) |
+			((uint64_t)GetU32(&Hdr[12]) << 32U);
+		St->Cmds++;
+
+		switch(Hdr[0]) {
+		case FRAME_OP_WRITE:
+		case FRAME_OP_BLOCKSET:
+			if(ConnRead(C, Word, sizeof(Word)) != 0) {
+				return -1;
+			}
+			Value = GetU32(Word);
+			if(Hdr[0] == FRAME_OP_WRITE) {
+				NumWords = 1U;
+			}
+			for(uint32_t i = 0U; i < NumWords; i++) {
+				if(RegWrite(Map, Addr + i * 4U, Value) != 0) {
+					return -1;
+				}
+			}
+			St->Words += NumWords;
+			break;
+		case FRAME_OP_BLOCKWRITE:
+			for(uint32_t i = 0U; i < NumWords; i++) {
+				if(ConnRead(C, Word, sizeof(Word)) != 0 ||
+						RegWrite(Map, Addr + i * 4U,
+							GetU32(Word)) != 0) {
+					return -1;
+				}
+			}
+			St->Words += NumWords;
+			break;
+		case FRAME_OP_READ:
+		case FRAME_OP_BLOCKREAD:
+			if(Hdr[0] == FRAME_OP_READ) {
+				NumWords = 1U;
+			}
+			for(uint32_t i = 0U; i < NumWords; i++) {
+				Value = RegRead(Map, Addr + i * 4U);
+				for(uint32_t j = 0U; j < 4U; j++) {
+					Word[j] = (uint8_t)(Value >> (8U * j));
+				}
+				if(ConnWrite(C->Fd, Word, sizeof(Word)) != 0) {
+					return -1;
+				}
+			}
+			St->Reads += NumWords;
+			break;
+		default:
+			fprintf(stderr, "Invalid frame opcode 0x%x\n", Hdr[0]);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int Serve(int Fd, RegMap *Map, Stats *St)
+{
+	Conn *C;
+	char Line[LINE_MAX_LEN], Reply[16];
+	unsigned long long Addr;
+	unsigned int Value;
+	size_t Len;
+	int Ch, Ret = 0;
+
+	C = calloc(1U, sizeof(*C));
+	if(C == NULL) {
+		return -1;
+	}
+	C->Fd = Fd;
+
+	while(1) {
+		Len = 0U;
+		while((Ch = ConnGetc(C)) >= 0 && Ch != '\n') {
+			if(Len < sizeof(Line) - 1U) {
+				Line[Len++] = (char)Ch;
+			}
+		}
+		if(Ch < 0) {
+			break;
+		}
+		Line[Len] = '\0';
+		St->Cmds++;
+
+		if(sscanf(Line, "W %llx %x", &Addr, &Value) == 2) {
+			if(RegWrite(Map, Addr, Value) != 0) {
+				Ret = -1;
+				break;
+			}
+			St->Words++;
+		} else if(sscanf(Line, "R %llx", &Addr) == 1) {
+			snprintf(Reply, sizeof(Reply), "0x%08X\n",
+					RegRead(Map, Addr));
+			if(ConnWrite(Fd, Reply, strlen(Reply)) != 0) {
+				Ret = -1;
+				break;
+			}
+			St->Reads++;
+		} else if(strcmp(Line, "P BINARY") == 0) {
+			if(ConnWrite(Fd, "OK\n", 3U) != 0) {
+				Ret = -1;
+				break;
+			}
+			Ret = ServeBinary(C, Map, St);
+			break;
+		} else {
+			fprintf(stderr, "Invalid command: %s\n", Line);
+		}
+	}
+
+	free(C);
+
+	return Ret;
+}
+
+int main(int argc, char **argv)
+{
+	struct sockaddr_in SockAddr;
+	socklen_t AddrLen = sizeof(SockAddr);
+	int ListenFd, Fd, NumClients = 1, One = 1;
+	RegMap Map = {NULL, 0U, 0U};
+	FILE *PortFile;
+
+	memset(&SockAddr, 0, sizeof(SockAddr));
+	SockAddr.sin_family = AF_INET;
+	SockAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if(argc > 1) {
+		SockAddr.sin_port = htons((uint16_t)atoi(argv[1]));
+	}
+	if(argc > 2) {
+		NumClients = atoi(argv[2]);
+	}
+
+	ListenFd = socket(AF_INET, SOCK_STREAM, 0);
+	if(ListenFd < 0) {
+		perror("socket");
+		return 1;
+	}
+
+	setsockopt(ListenFd, SOL_SOCKET, SO_REUSEADDR, &One, sizeof(One));
+	if(bind(ListenFd, (struct sockaddr *)&SockAddr, sizeof(SockAddr)) != 0 ||
+			listen(ListenFd, 1) != 0 ||
+			getsockname(ListenFd, (struct sockaddr *)&SockAddr,
+				&AddrLen) != 0) {
+		perror("bind");
+		close(ListenFd);
+		return 1;
+	}
+
+	mkdir(PORT_FILE_DIR, 0755);
+	PortFile = fopen(PORT_FILE, "w");
+	if(PortFile == NULL) {
+		perror(PORT_FILE);
+		close(ListenFd);
+		return 1;
+	}
+	fprintf(PortFile, "%u", ntohs(SockAddr.sin_port));
+	fclose(PortFile);
+	printf("Listening on localhost:%u\n", ntohs(SockAddr.sin_port));
+	fflush(stdout);
+
+	for(int i = 0; i < NumClients; i++) {
+		Stats St = {0U, 0U, 0U};
+
+		Fd = accept(ListenFd, NULL, NULL);
+		if(Fd < 0) {
+			perror("accept");
+			break;
+		}
+
+		if(Serve(Fd, &Map, &St) != 0) {
+			fprintf(stderr, "Client connection failed\n");
+		}
+		close(Fd);
+
+		printf("Client %d: %lu commands, %lu words written, %lu reads\n",
+				i, St.Cmds, St.Words, St.Reads);
+		fflush(stdout);
+	}
+
+	close(ListenFd);
+	free(Map.Entries);
+
+	return 0;
+}
+
+/** @} */
@@ -37,22 +37,110 @@
 #include <string.h>
 
 #include "xaie_helper.h"
+#include "xaie_helper_internal.h"
 #include "xaie_reset_aie.h"
 #include "xaie_txn.h"
 
 /************************** Constant Definitions *****************************/
 #define XAIE_DEFAULT_NUM_CMDS 1024U
-#define XAIE_DEFAULT_TXN_BUFFER_SIZE (1024 * 4)
+#define XAIE_TXN_PAYLOAD_CHUNK_SIZE (64U * 1024U)
+#define XAIE_TXN_PAYLOAD_ALIGN sizeof(u64)
 
-#define XAIE_TXN_INSTANCE_EXPORTED	0b10U
-#define XAIE_TXN_INST_EXPORTED_MASK XAIE_TXN_INSTANCE_EXPORTED
-#define XAIE_TXN_AUTO_FLUSH_MASK XAIE_TRANSACTION_ENABLE_AUTO_FLUSH
+#define XAIE_TXN_REG_FULL_MASK 0xFFFFFFFFU
+#define XAIE_TXN_PARALLEL_MIN_CMDS 64U
+
+#define XAIE_REG_SHADOW_MIN_SIZE 64U
+#define XAIE_REG_SHADOW_MAX_SIZE (64U * 1024U)
+#define XAIE_REG_SHADOW_HASH_MUL 0x9E3779B97F4A7C15ULL
 
 #define TX_DUMP_ENABLE 0
 #define XAIE_INVALID_PARTITIONFD -1
+/**************************** Type Definitions *******************************/
+/*
+ * Chunk of transaction payload memory. Payloads of block writes and custom
+ * operations are bump allocated from the chunks of the transaction instance
+ * and released together with the instance.
+ */
+struct XAie_TxnChunk {
+	XAie_TxnChunk *Next;
+	u64 Size;
+	u64 Used;
+	u64 Payload[];
+};
+
+/*
+ * Per thread cache of the last transaction instance lookup. Only the thread of
+ * Tid starts or removes the transaction of Tid, and it updates its own entry
+ * when it does, so transactions of other threads do not invalidate it. The
+ * entry is valid as long as the generation of the device instance transaction
+ * list, which changes only when the list is reset, matches Gen.
+ */
+typedef struct {
+	const XAie_DevInst *DevInst;
+	u64 Tid;
+	u32 Gen;
+	XAie_TxnInst *Inst;
+} XAie_TxnLookupCache;
+
+#ifdef __linux__
+/*
+ * Section of a parallel flush. The commands of the section are sorted by
+ * column into Sorted, the commands of column C are Sorted[ColStart[C]] to
+ * Sorted[ColStart[C + 1] - 1]. Workers take columns from NextCol.
+ */
+typedef struct {
+	XAie_DevInst *DevInst;
+	const XAie_TxnInst *TxnInst;
+	XAie_TxnCmd *Sorted;
+	u32 *ColStart;
+	u32 NextCol;
+	AieRC RC;		/* First error of the section */
+} XAie_TxnParallelFlush;
+
+/*
+ * Worker threads of the parallel flushes of a device instance. The pool is
+ * started by the first section executed in parallel and lives until the
+ * device instance is finished. Owner is held by the thread releasing a
+ * section, a thread finding the pool busy executes its section alone.
+ */
+struct XAie_TxnFlushPool {
+	pthread_mutex_t Owner;
+	pthread_mutex_t Lock;
+	pthread_cond_t StartCond;	/* Signalled when a section is released */
+	pthread_cond_t DoneCond;	/* Signalled when all workers are done */
+	XAie_TxnParallelFlush *Flush;	/* Section being executed */
+	u32 Gen;		/* Incremented for every released section */
+	u32 NumBusy;		/* Workers executing the current section */
+	u32 NumWorkers;
+	u8 Exit;
+	pthread_t Workers[XAIE_REG_LOCK_SHARDS];
+};
+#endif
+
 /************************** Variable Definitions *****************************/
 const u8 TransactionHeaderVersion_Major = 0;
 const u8 TransactionHeaderVersion_Minor = 1;
+const u8 TransactionHeaderVersion_Compact_Major = 1;
+const u8 TransactionHeaderVersion_Compact_Minor = 0;
+
+/*
+ * Generation counter shared by all device instances. A transaction list takes
+ * a new value from it with _XAie_TxnListNextGen() when it is reset, at
+ * _XAie_TxnListInit() and _XAie_TxnResourceCleanup(), which invalidates the
+ * per thread lookup caches of all threads. Appending or removing a
+ * transaction only updates the cache entry of the owning thread. As the
+ * counter is shared, a stale cache entry can never match a device instance
+ * that was reinitialized at the same address.
+ */
+static u32 TxnListGenCounter;
+static XAIE_THREAD_LOCAL XAie_TxnLookupCache TxnLookupCache;
+
+/*
+ * Non zero while the calling thread runs a custom op handler. IO issued by the
+ * handlers goes to the backend directly and is not recorded in the
+ * transaction being executed.
+ */
+static XAIE_THREAD_LOCAL u32 TxnCustomOpDepth;
 
 /***************************** Macro Definitions *****************************/
 /************************** Function Definitions *****************************/
@@ -411,15 +499,16 @@ AieRC XAie_GetUngatedLocsInPartition(XAie_DevInst *DevInst, u32 *NumTiles,
 * @return       none
 *
 * @note         This API is internal, hence all the argument checks are taken
-*               care of in the caller API.
+*               care of in the caller API. Bits are set atomically, so that
+*               bits of different columns can be updated concurrently.
 *
 ******************************************************************************/
 void _XAie_SetBitInBitmap(u32 *Bitmap, u32 StartSetBit,
 		u32 NumSetBit)
 {
 	for(u32 i = StartSetBit; i < StartSetBit + NumSetBit; i++) {
-		Bitmap[i / (sizeof(Bitmap[0]) * 8U)] |=
-			(u32)(1U << (i % (sizeof(Bitmap[0]) * 8U)));
+		XAIE_ATOMIC_OR(&Bitmap[i / (sizeof(Bitmap[0]) * 8U)],
+			(u32)(1U << (i % (sizeof(Bitmap[0]) * 8U))));
 	}
 }
 
@@ -434,15 +523,386 @@ void _XAie_SetBitInBitmap(u32 *Bitmap, u32 StartSetBit,
 * @return       None
 *
 * @note         This API is internal, hence all the argument checks are taken
-*               care of in the caller API.
+*               care of in the caller API. Bits are cleared atomically.
 *
 ******************************************************************************/
 void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartBit, u32 NumBit)
 {
 	for(u32 i = StartBit; i < StartBit + NumBit; i++) {
-		Bitmap[i / (sizeof(Bitmap[0]) * 8U)] &=
-			~(u32)((1U << (i % (sizeof(Bitmap[0]) * 8U))));
+		XAIE_ATOMIC_AND(&Bitmap[i / (sizeof(Bitmap[0]) * 8U)],
+			~(u32)((1U << (i % (sizeof(Bitmap[0]) * 8U)))));
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a tile local register offset falls in the range of the
+* ports of a stream switch port array.
+*
+* @param        Ports: Array of stream switch ports indexed by port type
+* @param        Stride: Offset between consecutive ports
+* @param        Off: Tile local register offset
+*
+* @return       XAIE_ENABLE if the offset is in range, XAIE_DISABLE otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_IsStrmPortReg(const XAie_StrmPort *Ports, u32 Stride, u32 Off)
+{
+	if(Ports == NULL) {
+		return XAIE_DISABLE;
+	}
+
+	for(u8 i = 0U; i < (u8)SS_PORT_TYPE_MAX; i++) {
+		if((Ports[i].NumPorts != 0U) &&
+				(Off >= Ports[i].PortBaseAddr) &&
+				(Off < Ports[i].PortBaseAddr +
+				 (u32)Ports[i].NumPorts * Stride)) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a tile local register offset is one of the configuration
+* registers of an event module.
+*
+* @param        EvntMod: Event module
+* @param        Off: Tile local register offset
+*
+* @return       XAIE_ENABLE if the offset is an event configuration register,
+*		XAIE_DISABLE otherwise.
+*
+* @note         Internal only. Event generate, status and broadcast block
+*		registers are excluded as writing them has side effects.
+*
+******************************************************************************/
+static u8 _XAie_IsEventCfgReg(const XAie_EvntMod *EvntMod, u32 Off)
+{
+	u32 NumPortSelRegs;
+
+	if((Off >= EvntMod->BaseBroadcastRegOff) &&
+			(Off < EvntMod->BaseBroadcastRegOff +
+			 (u32)EvntMod->NumBroadcastIds * 4U)) {
+		return XAIE_ENABLE;
+	}
+
+	if((Off >= EvntMod->BaseGroupEventRegOff) &&
+			(Off < EvntMod->BaseGroupEventRegOff +
+			 (u32)EvntMod->NumGroupEvents * 4U)) {
+		return XAIE_ENABLE;
+	}
+
+	if(EvntMod->StrmPortSelectIdsPerReg != 0U) {
+		NumPortSelRegs = (EvntMod->NumStrmPortSelectIds +
+				EvntMod->StrmPortSelectIdsPerReg - 1U) /
+			EvntMod->StrmPortSelectIdsPerReg;
+		if((Off >= EvntMod->BaseStrmPortSelectRegOff) &&
+				(Off < EvntMod->BaseStrmPortSelectRegOff +
+				 NumPortSelRegs * 4U)) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	if((Off == EvntMod->ComboInputRegOff) ||
+			(Off == EvntMod->ComboCtrlRegOff) ||
+			((EvntMod->NumEdgeSelectIds != 0U) &&
+			 (Off == EvntMod->EdgeEventRegOff))) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the modules of the tile addressed by a partition relative
+* register offset.
+*
+* @param        DevInst: Device Instance
+* @param        RegOff: Register offset relative to the partition base
+* @param        Off: Pointer to return the tile local register offset
+*
+* @return       Pointer to the tile modules, NULL if the offset is outside of
+*		the partition.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static const XAie_TileMod* _XAie_GetRegTileMod(XAie_DevInst *DevInst,
+		u64 RegOff, u32 *Off)
+{
+	XAie_LocType Loc;
+	u8 TileType;
+
+	if((RegOff >> DevInst->DevProp.ColShift) >= DevInst->NumCols) {
+		return NULL;
+	}
+
+	Loc.Col = _XAie_GetColfromRegOff(DevInst, RegOff);
+	Loc.Row = _XAie_GetRowfromRegOff(DevInst, RegOff);
+	if(Loc.Row >= DevInst->NumRows) {
+		return NULL;
+	}
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return NULL;
+	}
+
+	*Off = (u32)(RegOff & ((1U << DevInst->DevProp.RowShift) - 1U));
+	return &DevInst->DevProp.DevMod[TileType];
+}
+
+/*****************************************************************************/
+/**
+* This API classifies a partition relative register offset.
+*
+* @param        DevInst: Device Instance
+* @param        RegOff: Register offset relative to the partition base
+*
+* @return       Class of the register. XAIE_REG_CLASS_OTHER is returned for
+*		registers that are not known to be free of side effects and for
+*		offsets outside of the partition.
+*
+* @note         Internal only. Registers of the stream switch, DMA buffer
+*		descriptor and event configuration classes only hold
+*		configuration, writing them has no effect other than updating
+*		the stored value.
+*
+******************************************************************************/
+XAie_RegClass _XAie_GetRegClass(XAie_DevInst *DevInst, u64 RegOff)
+{
+	const XAie_TileMod *TileMod;
+	u32 Off;
+
+	TileMod = _XAie_GetRegTileMod(DevInst, RegOff, &Off);
+	if(TileMod == NULL) {
+		return XAIE_REG_CLASS_OTHER;
+	}
+
+	if(TileMod->DmaMod != NULL) {
+		const XAie_DmaMod *DmaMod = TileMod->DmaMod;
+
+		if((Off >= DmaMod->BaseAddr) && (Off < DmaMod->BaseAddr +
+					(u32)DmaMod->NumBds *
+					DmaMod->IdxOffset)) {
+			return XAIE_REG_CLASS_DMA_BD;
+		}
+	}
+
+	if(TileMod->StrmSw != NULL) {
+		const XAie_StrmMod *StrmSw = TileMod->StrmSw;
+
+		if(_XAie_IsStrmPortReg(StrmSw->MstrConfig, StrmSw->PortOffset,
+					Off) ||
+				_XAie_IsStrmPortReg(StrmSw->SlvConfig,
+					StrmSw->PortOffset, Off) ||
+				_XAie_IsStrmPortReg(StrmSw->SlvSlotConfig,
+					StrmSw->SlotOffsetPerPort, Off)) {
+			return XAIE_REG_CLASS_STRMSW;
+		}
+	}
+
+	if(TileMod->EvntMod != NULL) {
+		for(u8 i = 0U; i < TileMod->NumModules; i++) {
+			if(_XAie_IsEventCfgReg(&TileMod->EvntMod[i], Off)) {
+				return XAIE_REG_CLASS_EVENT_CFG;
+			}
+		}
+	}
+
+	return XAIE_REG_CLASS_OTHER;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a tile local register offset is in a range of registers.
+*
+* @param        Off: Tile local register offset
+* @param        Base: Offset of the first register of the range
+* @param        Size: Size of the range in bytes
+*
+* @return       XAIE_ENABLE if the offset is in range, XAIE_DISABLE otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_IsRegInRange(u32 Off, u32 Base, u32 Size)
+{
+	return (Off >= Base) && (Off - Base < Size);
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a tile local register offset is one of the control and
+* status registers of a core module.
+*
+* @param        CoreMod: Core module
+* @param        Off: Tile local register offset
+*
+* @return       XAIE_ENABLE if the offset is a core register, XAIE_DISABLE
+*		otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_IsCoreReg(const XAie_CoreMod *CoreMod, u32 Off)
+{
+	if((Off == CoreMod->CoreCtrl->RegOff) ||
+			(Off == CoreMod->CoreSts->RegOff) ||
+			(Off == CoreMod->CorePCOff) ||
+			(Off == CoreMod->CoreSPOff) ||
+			(Off == CoreMod->CoreLROff)) {
+		return XAIE_ENABLE;
+	}
+
+	if((CoreMod->CoreDebug != NULL) &&
+			((Off == CoreMod->CoreDebug->RegOff) ||
+			 (Off == CoreMod->CoreDebug->DebugCtrl1Offset))) {
+		return XAIE_ENABLE;
+	}
+
+	if((CoreMod->CoreDebugStatus != NULL) &&
+			(Off == CoreMod->CoreDebugStatus->RegOff)) {
+		return XAIE_ENABLE;
+	}
+
+	if((CoreMod->CoreEvent != NULL) &&
+			(Off == CoreMod->CoreEvent->EnableEventOff)) {
+		return XAIE_ENABLE;
+	}
+
+	if((CoreMod->CoreAccumCtrl != NULL) &&
+			(Off == CoreMod->CoreAccumCtrl->RegOff)) {
+		return XAIE_ENABLE;
+	}
+
+	if((CoreMod->ProcBusCtrl != NULL) &&
+			(Off == CoreMod->ProcBusCtrl->RegOff)) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a tile local register offset is one of the registers of
+* an event module.
+*
+* @param        EvntMod: Event module
+* @param        Off: Tile local register offset
+*
+* @return       XAIE_ENABLE if the offset is an event register, XAIE_DISABLE
+*		otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_IsEventReg(const XAie_EvntMod *EvntMod, u32 Off)
+{
+	return _XAie_IsEventCfgReg(EvntMod, Off) ||
+		(Off == EvntMod->GenEventRegOff) ||
+		(Off == EvntMod->ErrorHaltRegOff) ||
+		_XAie_IsRegInRange(Off, EvntMod->BaseStatusRegOff,
+				(u32)EvntMod->NumEventReg * 4U) ||
+		_XAie_IsRegInRange(Off, EvntMod->BasePCEventRegOff,
+				(u32)EvntMod->NumPCEvents * 4U);
+}
+
+/*****************************************************************************/
+/**
+* This API returns the module a partition relative register offset belongs to.
+*
+* @param        DevInst: Device Instance
+* @param        RegOff: Register offset relative to the partition base
+*
+* @return       Module of the register. XAIE_TXN_STATS_MOD_OTHER is returned
+*		for registers not owned by one of the tracked modules and for
+*		offsets outside of the partition.
+*
+* @note         Internal only. Program and data memories are reported as
+*		memory, the buffer descriptor, channel control and channel
+*		status registers as DMA.
+*
+******************************************************************************/
+XAie_TxnStatsModule _XAie_GetRegModule(XAie_DevInst *DevInst, u64 RegOff)
+{
+	const XAie_TileMod *TileMod;
+	u32 Off;
+
+	TileMod = _XAie_GetRegTileMod(DevInst, RegOff, &Off);
+	if(TileMod == NULL) {
+		return XAIE_TXN_STATS_MOD_OTHER;
+	}
+
+	switch(_XAie_GetRegClass(DevInst, RegOff)) {
+	case XAIE_REG_CLASS_STRMSW:
+		return XAIE_TXN_STATS_MOD_STRMSW;
+	case XAIE_REG_CLASS_DMA_BD:
+		return XAIE_TXN_STATS_MOD_DMA;
+	case XAIE_REG_CLASS_EVENT_CFG:
+		return XAIE_TXN_STATS_MOD_EVENT;
+	default:
+		break;
+	}
+
+	if((TileMod->MemMod != NULL) && _XAie_IsRegInRange(Off,
+				TileMod->MemMod->MemAddr,
+				TileMod->MemMod->Size)) {
+		return XAIE_TXN_STATS_MOD_MEMORY;
+	}
+
+	if(TileMod->CoreMod != NULL) {
+		if(_XAie_IsRegInRange(Off, TileMod->CoreMod->ProgMemHostOffset,
+					TileMod->CoreMod->ProgMemSize)) {
+			return XAIE_TXN_STATS_MOD_MEMORY;
+		}
+		if(_XAie_IsCoreReg(TileMod->CoreMod, Off)) {
+			return XAIE_TXN_STATS_MOD_CORE;
+		}
 	}
+
+	if(TileMod->DmaMod != NULL) {
+		const XAie_DmaMod *DmaMod = TileMod->DmaMod;
+
+		/* S2MM channels are followed by the MM2S channels */
+		if(_XAie_IsRegInRange(Off, DmaMod->ChCtrlBase,
+					2U * DmaMod->NumChannels *
+					(u32)DmaMod->ChIdxOffset) ||
+				_XAie_IsRegInRange(Off, DmaMod->ChStatusBase,
+					2U * DmaMod->ChStatusOffset)) {
+			return XAIE_TXN_STATS_MOD_DMA;
+		}
+	}
+
+	if(TileMod->LockMod != NULL) {
+		const XAie_LockMod *LockMod = TileMod->LockMod;
+
+		if(_XAie_IsRegInRange(Off, LockMod->BaseAddr,
+					(u32)LockMod->NumLocks *
+					LockMod->LockIdOff) ||
+				_XAie_IsRegInRange(Off, LockMod->LockSetValBase,
+					(u32)LockMod->NumLocks *
+					LockMod->LockSetValOff)) {
+			return XAIE_TXN_STATS_MOD_LOCK;
+		}
+	}
+
+	if(TileMod->EvntMod != NULL) {
+		for(u8 i = 0U; i < TileMod->NumModules; i++) {
+			if(_XAie_IsEventReg(&TileMod->EvntMod[i], Off)) {
+				return XAIE_TXN_STATS_MOD_EVENT;
+			}
+		}
+	}
+
+	return XAIE_TXN_STATS_MOD_OTHER;
 }
 
 /*****************************************************************************/
@@ -586,456 +1046,2656 @@ AieRC _XAie_PrintPartitionList(XAie_DevInst *DevInst)
 
 /*****************************************************************************/
 /**
-* This API inserts a transaction node to the linked list.
-*
-* @param        DevInst: Device Instance
-* @param        TxnNode: Pointer to the transaction node to be inserted
+* This API allocates and initializes a mutex.
 *
-* @return       None
+* @return       Pointer to the mutex on success and NULL on failure or if the
+*		platform does not support threads.
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static void _XAie_AppendTxnInstToList(XAie_DevInst *DevInst, XAie_TxnInst *Inst)
+XAie_Mutex* _XAie_MutexCreate(void)
 {
-	XAie_List *Node = &DevInst->TxnList;
+#ifdef __linux__
+	XAie_Mutex *Mutex;
 
-	while(Node->Next != NULL) {
-		Node = Node->Next;
+	Mutex = (XAie_Mutex *)malloc(sizeof(*Mutex));
+	if(Mutex == NULL) {
+		XAIE_ERROR("Failed to allocate memory for mutex\n");
+		return NULL;
 	}
 
-	Node->Next = &Inst->Node;
-	Inst->Node.Next = NULL;
+	if(pthread_mutex_init(&Mutex->Mutex, NULL) != 0) {
+		XAIE_ERROR("Failed to initialize mutex\n");
+		free(Mutex);
+		return NULL;
+	}
+
+	return Mutex;
+#else
+	return NULL;
+#endif
 }
 
 /*****************************************************************************/
 /**
-* This API returns the transaction list from the linked list based on the thread
-* id.
+* This API releases a mutex allocated with _XAie_MutexCreate().
 *
-* @param        DevInst: Device instance pointer
-* @param	Tid: Thread id.
+* @param        Mutex: Pointer to the mutex. NULL is ignored.
 *
-* @return       Pointer to transaction instance on success and NULL on failure
+* @return       None
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static XAie_TxnInst *_XAie_GetTxnInst(XAie_DevInst *DevInst, u64 Tid)
+void _XAie_MutexDestroy(XAie_Mutex *Mutex)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
-	XAie_TxnInst *TxnInst;
-
-	while(NodePtr != NULL) {
-		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, Node);
-		if(TxnInst->Tid == Tid) {
-			return TxnInst;
-		}
-
-		NodePtr = NodePtr->Next;
+	if(Mutex == NULL) {
+		return;
 	}
 
-	return NULL;
+#ifdef __linux__
+	pthread_mutex_destroy(&Mutex->Mutex);
+#endif
+	free(Mutex);
 }
 
 /*****************************************************************************/
 /**
-* This API removes a node from the linked list if the thread id is found.
+* This API acquires a mutex.
 *
-* @param        DevInst: Device instance pointer
-* @param	Tid: Thread id.
+* @param        Mutex: Pointer to the mutex. NULL is a no-op.
 *
-* @return       XAIE_OK on success and error code on failure.
+* @return       None
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_RemoveTxnInstFromList(XAie_DevInst *DevInst, u64 Tid)
+void _XAie_MutexLock(XAie_Mutex *Mutex)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
-	XAie_List *Prev = &DevInst->TxnList;
-	XAie_TxnInst *Inst;
-
-	while(NodePtr != NULL) {
-		Inst = (XAie_TxnInst *)XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst,
-				Node);
-		if(Inst->Tid == Tid) {
-			break;
-		}
-
-		Prev = NodePtr;
-		NodePtr = NodePtr->Next;
-	}
-
-	if(NodePtr == NULL) {
-		XAIE_ERROR("Cannot find node to delete from list\n");
-		return XAIE_ERR;
-	} else {
-		Prev->Next = NodePtr->Next;
-	}
-
-	return XAIE_OK;
-}
-
-void BuffHexDump(char* buff,u32 size) {
-	XAIE_DBG("Buff Info %p %d\n",buff,size);
-	for (u32 i = 0; i < size; ++i) {
-		printf("0x%x ",(u8)buff[i]&0xffU);
+#ifdef __linux__
+	if(Mutex != NULL) {
+		pthread_mutex_lock(&Mutex->Mutex);
 	}
-	printf("\n");
-}
-
-static int TxnCmdDump(XAie_TxnCmd* cmd) {
-	XAIE_DBG("TxnCmdDump Called for %d and size %d\n",cmd->Opcode,cmd->Size);
-	BuffHexDump((char *)(uintptr_t)(cmd->DataPtr),cmd->Size);
-	return 0;
+#else
+	(void)Mutex;
+#endif
 }
 
 /*****************************************************************************/
 /**
-* This API rellaocates the command buffer associated with the given transaction
-* instance. The command buffer is extended to accomodate an additional
-* XAIE_DEFAULT_NUM_CMDS number of commands.
+* This API releases a mutex.
 *
-* @param        TxnInst: Pointer to the transaction instance
+* @param        Mutex: Pointer to the mutex. NULL is a no-op.
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure
+* @return       None
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_ReallocCmdBuf(XAie_TxnInst *TxnInst)
+void _XAie_MutexUnlock(XAie_Mutex *Mutex)
 {
-	TxnInst->CmdBuf = (XAie_TxnCmd *)realloc((void *)TxnInst->CmdBuf,
-			sizeof(XAie_TxnCmd) *
-			(u64)(TxnInst->MaxCmds + XAIE_DEFAULT_NUM_CMDS));
-	if(TxnInst->CmdBuf == NULL) {
-		XAIE_ERROR("Failed reallocate memory for transaction buffer "
-				"with id: %d\n", TxnInst->Tid);
-		return XAIE_ERR;
+#ifdef __linux__
+	if(Mutex != NULL) {
+		pthread_mutex_unlock(&Mutex->Mutex);
 	}
-
-	TxnInst->MaxCmds += XAIE_DEFAULT_NUM_CMDS;
-
-	return XAIE_OK;
+#else
+	(void)Mutex;
+#endif
 }
 
 /*****************************************************************************/
 /**
+* This API allocates the register lock shards of a device instance. Backends
+* accessing the registers through memory mapped IO or the kernel driver get a
+* shard per column, other backends share their state between columns and get a
+* single shard.
 *
-* This api allocates the memory to store the IO transaction commands
-* when the driver is configured to execute in transaction mode.
-*
-* @param	DevInst - Device instance pointer.
-* @param	Flags - Flags passed by the user.
+* @param        DevInst: Device instance pointer
 *
-* @return	Pointer to transaction instance on success and NULL on error.
+* @return       Pointer to the register locks on success and NULL on failure or
+*		if the platform does not support threads.
 *
-* @note		Internal Only.
+* @note         Internal only.
 *
 ******************************************************************************/
-AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags)
+XAie_RegLocks* _XAie_RegLocksCreate(XAie_DevInst *DevInst)
 {
-	XAie_TxnInst *Inst;
-	const XAie_Backend *Backend = DevInst->Backend;
-
-	Inst = (XAie_TxnInst*)malloc(sizeof(*Inst));
-	if(Inst == NULL) {
-		XAIE_ERROR("Failed to allocate memory for txn instance\n");
-		return XAIE_ERR;
-	}
+#ifdef __linux__
+	XAie_RegLocks *RegLocks;
+	XAie_BackendType Type = DevInst->Backend->Type;
 
-	Inst->CmdBuf = (XAie_TxnCmd*)calloc(XAIE_DEFAULT_NUM_CMDS,
-			sizeof(*Inst->CmdBuf));
-	if(Inst->CmdBuf == NULL) {
-		XAIE_ERROR("Failed to allocate memory for command buffer\n");
-		free(Inst);
-		return XAIE_ERR;
+	RegLocks = (XAie_RegLocks *)malloc(sizeof(*RegLocks));
+	if(RegLocks == NULL) {
+		XAIE_ERROR("Failed to allocate memory for register locks\n");
+		return NULL;
 	}
 
-	Inst->NumCmds = 0U;
-	Inst->MaxCmds = XAIE_DEFAULT_NUM_CMDS;
-	Inst->Tid = Backend->Ops.GetTid();
-	Inst->NextCustomOp = (u8)XAIE_IO_CUSTOM_OP_NEXT;
-
-	XAIE_DBG("Transaction buffer allocated with id: %ld\n", Inst->Tid);
-	Inst->Flags = Flags;
-	if(Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
-		XAIE_DBG("Auto flush is enabled for transaction buffer with "
-				"id: %ld\n", Inst->Tid);
+	if((Type == XAIE_IO_BACKEND_LINUX) || (Type == XAIE_IO_BACKEND_METAL) ||
+			(Type == XAIE_IO_BACKEND_BAREMETAL)) {
+		RegLocks->NumShards = XAIE_REG_LOCK_SHARDS;
 	} else {
-		XAIE_DBG("Auto flush is disabled for transaction buffer with "
-				"id: %ld\n", Inst->Tid);
+		RegLocks->NumShards = 1U;
 	}
 
-	_XAie_AppendTxnInstToList(DevInst, Inst);
+	for(u32 i = 0U; i < RegLocks->NumShards; i++) {
+		if(pthread_mutex_init(&RegLocks->Shards[i].Mutex, NULL) != 0) {
+			XAIE_ERROR("Failed to initialize register lock\n");
+			while(i > 0U) {
+				pthread_mutex_destroy(
+						&RegLocks->Shards[--i].Mutex);
+			}
+			free(RegLocks);
+			return NULL;
+		}
+	}
 
-	return XAIE_OK;
+	return RegLocks;
+#else
+	(void)DevInst;
+	return NULL;
+#endif
 }
 
 /*****************************************************************************/
 /**
-* This API decodes the command type and executes the IO operation.
+* This API releases the register locks allocated with _XAie_RegLocksCreate().
 *
-* @param        DevInst: Device instance pointer
-* @param        Cmd: Pointer to the transaction command structure
-* @param	Flags: Transaction instance flags
+* @param        RegLocks: Pointer to the register locks. NULL is ignored.
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure.
+* @return       None
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
-		u32 Flags)
+void _XAie_RegLocksDestroy(XAie_RegLocks *RegLocks)
 {
-	AieRC RC;
-	const XAie_Backend *Backend = DevInst->Backend;
-
-	if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
-		// TBD hooking point for  custom op handler
-		XAIE_WARN("Custom OP Transaction %d handler hook point\n",Cmd->Opcode);
-		return XAIE_OK;
+	if(RegLocks == NULL) {
+		return;
 	}
 
-	switch(Cmd->Opcode)
-	{
-		case XAIE_IO_WRITE:
-			if(Cmd->Mask == 0U) {
-				RC = Backend->Ops.Write32((void*)DevInst->IOInst,
-						Cmd->RegOff, Cmd->Value);
-			} else {
-
-				RC = Backend->Ops.MaskWrite32((void*)DevInst->IOInst,
-							Cmd->RegOff, Cmd->Mask,
-							Cmd->Value);
-			}
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Wr failed. Addr: 0x%lx, Mask: 0x%x,"
-						"Value: 0x%x\n", Cmd->RegOff,
-						Cmd->Mask, Cmd->Value);
-				return RC;
-			}
-			break;
-		case XAIE_IO_BLOCKWRITE:
-			RC = Backend->Ops.BlockWrite32((void *)DevInst->IOInst,
-					Cmd->RegOff,
-					(u32 *)(uintptr_t)Cmd->DataPtr,
-					Cmd->Size);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
-						Cmd->RegOff);
-				return RC;
-			}
-
-			if((Flags & XAIE_TXN_INST_EXPORTED_MASK) == 0U) {
-				free((void *)(uintptr_t)Cmd->DataPtr);
-			}
-			break;
-		case XAIE_IO_BLOCKSET:
-			RC = Backend->Ops.BlockSet32((void *)DevInst->IOInst,
-					Cmd->RegOff, Cmd->Value,
-					Cmd->Size);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
-						Cmd->RegOff);
-				return RC;
-			}
-			break;
-		case XAIE_IO_MASKPOLL:
-			/* Force timeout to default value */
-			RC = Backend->Ops.MaskPoll((void*)DevInst->IOInst,
-							Cmd->RegOff, Cmd->Mask,
-							Cmd->Value, 0U);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("MP failed. Addr: 0x%lx, Mask: 0x%x, Value: 0x%x\n",
-						Cmd->RegOff, Cmd->Mask,
-						Cmd->Value);
-				return RC;
-			}
-			break;
-
-		default:
-			XAIE_ERROR("Invalid transaction opcode\n");
-			return XAIE_ERR;
+#ifdef __linux__
+	for(u32 i = 0U; i < RegLocks->NumShards; i++) {
+		pthread_mutex_destroy(&RegLocks->Shards[i].Mutex);
 	}
+#endif
+	free(RegLocks);
+}
 
-	return XAIE_OK;
+/*****************************************************************************/
+/**
+* This API returns the register shadow table of a register. The table is
+* protected by the register lock returned by _XAie_RegLockOf() for the same
+* register.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+*
+* @return       Pointer to the shadow table.
+*
+* @note         Internal only. The register shadow must be enabled.
+*
+******************************************************************************/
+static inline XAie_RegShadowTable* _XAie_RegShadowTableOf(
+		XAie_DevInst *DevInst, u64 RegOff)
+{
+	XAie_RegShadow *Shadow = DevInst->RegShadow;
+
+	return &Shadow->Tables[(RegOff >> DevInst->DevProp.ColShift) %
+		Shadow->NumTables];
 }
 
 /*****************************************************************************/
 /**
-* This API executes all the commands in the command buffer and resets the number
-* of commands.
+* This API checks if a register is shadowed. Only the configuration registers
+* are shadowed, status and control registers may change without a write or
+* have side effects when written.
 *
 * @param        DevInst: Device instance pointer
-* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Register offset
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure
+* @return       XAIE_ENABLE if the register is shadowed, XAIE_DISABLE
+*		otherwise.
 *
-* @note         Internal only. This API does not allocate, reallocate or free
-*		any buffer.
+* @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+static inline u8 _XAie_RegShadowIsTracked(XAie_DevInst *DevInst, u64 RegOff)
 {
-	AieRC RC;
-	const XAie_Backend *Backend = DevInst->Backend;
+	return _XAie_GetRegClass(DevInst, RegOff) != XAIE_REG_CLASS_OTHER;
+}
 
-	XAIE_DBG("Flushing %d commands from transaction buffer\n",
-			TxnInst->NumCmds);
+/*****************************************************************************/
+/**
+* This API returns the slot of a register in a shadow table, or the free slot
+* to insert it into.
+*
+* @param        Table: Pointer to the shadow table
+* @param        RegOff: Register offset
+*
+* @return       Pointer to the slot.
+*
+* @note         Internal only. The table must be allocated and at most half
+*		full.
+*
+******************************************************************************/
+static XAie_RegShadowEntry* _XAie_RegShadowSlot(XAie_RegShadowTable *Table,
+		u64 RegOff)
+{
+	u32 Idx = (u32)(((RegOff >> 2U) * XAIE_REG_SHADOW_HASH_MUL) >> 32U) &
+		(Table->Size - 1U);
 
-	if(Backend->Ops.SubmitTxn != NULL) {
-		return Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst);
-	}
+	while(1) {
+		XAie_RegShadowEntry *Entry = &Table->Entries[Idx];
 
-	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
-		RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i],
-				TxnInst->Flags);
-		if (RC != XAIE_OK) {
-			 return RC;
+		if((Entry->Epoch != Table->Epoch) || (Entry->RegOff == RegOff)) {
+			return Entry;
 		}
+		Idx = (Idx + 1U) & (Table->Size - 1U);
 	}
-
-	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
-* This API executes all the commands in the command buffer and frees the
-* transaction instance unless it is exported to the user.
+* This API drops all the registers of a shadow table.
 *
-* @param        DevInst: Device instance pointer
-* @param        TxnInst: Pointer to the transaction instance
+* @param        Table: Pointer to the shadow table
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure
+* @return       None
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+static void _XAie_RegShadowClear(XAie_RegShadowTable *Table)
 {
-	AieRC RC;
-	u64 Tid = 0;
-	XAie_TxnInst *Inst;
-	const XAie_Backend *Backend = DevInst->Backend;
-
-	if(TxnInst == NULL) {
-		Tid = Backend->Ops.GetTid();
-		Inst = _XAie_GetTxnInst(DevInst, Tid);
-		if(Inst == NULL) {
-			XAIE_ERROR("Failed to get the correct transaction "
-					"instance\n");
-			return XAIE_ERR;
-		}
-	} else {
-		if(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK) {
-			Inst = TxnInst;
-		} else {
-			XAIE_ERROR("Transaction instance was not exported.\n");
-			return XAIE_ERR;
+	Table->NumEntries = 0U;
+	if(++Table->Epoch == 0U) {
+		if(Table->Entries != NULL) {
+			memset((void *)Table->Entries, 0,
+					sizeof(*Table->Entries) * Table->Size);
 		}
+		Table->Epoch = 1U;
 	}
+}
 
-	RC =  _XAie_Txn_FlushCmdBuf(DevInst, Inst);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Flushing the buffer failed\n");
-		return RC;
+/*****************************************************************************/
+/**
+* This API doubles the size of a shadow table. A table at its maximum size is
+* cleared instead, as is a table that could not be reallocated.
+*
+* @param        Table: Pointer to the shadow table
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_RegShadowGrow(XAie_RegShadowTable *Table)
+{
+	XAie_RegShadowEntry *Old = Table->Entries;
+	u32 OldSize = Table->Size, OldEpoch = Table->Epoch;
+	u32 NewSize = (OldSize == 0U) ? XAIE_REG_SHADOW_MIN_SIZE :
+		OldSize * 2U;
+	XAie_RegShadowEntry *Entries;
+
+	if(NewSize > XAIE_REG_SHADOW_MAX_SIZE) {
+		_XAie_RegShadowClear(Table);
+		return;
 	}
 
-	/* Do not free resources if transaction is exported */
-	if(Inst->Flags & XAIE_TXN_INST_EXPORTED_MASK) {
-		return XAIE_OK;
+	Entries = (XAie_RegShadowEntry *)calloc(NewSize, sizeof(*Entries));
+	if(Entries == NULL) {
+		XAIE_DBG("Failed to grow register shadow, clearing it\n");
+		_XAie_RegShadowClear(Table);
+		return;
 	}
 
-	RC = _XAie_RemoveTxnInstFromList(DevInst, Tid);
-	if(RC != XAIE_OK) {
-		return RC;
-	}
+	Table->Entries = Entries;
+	Table->Size = NewSize;
+	Table->Epoch = 1U;
+	Table->NumEntries = 0U;
+	for(u32 i = 0U; i < OldSize; i++) {
+		XAie_RegShadowEntry *Entry;
 
-	free(Inst->CmdBuf);
-	free(Inst);
-	return XAIE_OK;
+		if((Old[i].Epoch != OldEpoch) || (Old[i].Valid == XAIE_DISABLE)) {
+			continue;
+		}
+
+		Entry = _XAie_RegShadowSlot(Table, Old[i].RegOff);
+		*Entry = Old[i];
+		Entry->Epoch = Table->Epoch;
+		Table->NumEntries++;
+	}
+	free(Old);
 }
 
 /*****************************************************************************/
 /**
+* This API looks a register up in a shadow table.
 *
-* This api copies an existing transaction instance and returns a copy of the
-* instance with all the commands for users to save the commands and use them
-* at a later point.
-*
-* @param	DevInst - Device instance pointer.
+* @param        Table: Pointer to the shadow table
+* @param        RegOff: Register offset
+* @param        Value: Pointer to return the shadowed value
 *
-* @return	Pointer to copy of transaction instance on success and NULL
-*		on error.
+* @return       XAIE_ENABLE if the value of the register is known,
+*		XAIE_DISABLE otherwise.
 *
-* @note		Internal only.
+* @note         Internal only.
 *
 ******************************************************************************/
-XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
+static u8 _XAie_RegShadowLookup(XAie_RegShadowTable *Table, u64 RegOff,
+		u32 *Value)
 {
-	XAie_TxnInst *Inst, *TmpInst;
-	const XAie_Backend *Backend = DevInst->Backend;
-
-	TmpInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
-	if(TmpInst == NULL) {
-		XAIE_ERROR("Failed to get the correct transaction instance "
-				"from internal list\n");
-		return NULL;
-	}
+	XAie_RegShadowEntry *Entry;
 
-	Inst = (XAie_TxnInst *)malloc(sizeof(*Inst));
-	if(Inst == NULL) {
-		XAIE_ERROR("Failed to allocate memory for txn instance\n");
-		return NULL;
+	if(Table->NumEntries == 0U) {
+		return XAIE_DISABLE;
 	}
 
-	Inst->CmdBuf = (XAie_TxnCmd *)calloc(TmpInst->NumCmds,
-			sizeof(*Inst->CmdBuf));
-	if(Inst->CmdBuf == NULL) {
-		XAIE_ERROR("Failed to allocate memory for command buffer\n");
-		free(Inst);
-		return NULL;
+	Entry = _XAie_RegShadowSlot(Table, RegOff);
+	if((Entry->Epoch != Table->Epoch) || (Entry->Valid == XAIE_DISABLE)) {
+		return XAIE_DISABLE;
 	}
 
-	Inst->CmdBuf = (XAie_TxnCmd *)memcpy((void *)Inst->CmdBuf,
-			(void *)TmpInst->CmdBuf,
-			TmpInst->NumCmds * sizeof(*Inst->CmdBuf));
-
-	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
-		XAie_TxnCmd *TmpCmd = &TmpInst->CmdBuf[i];
-		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if(TmpCmd->Opcode == XAIE_IO_BLOCKWRITE) {
-			Cmd->DataPtr = (u64)(uintptr_t)malloc(
-					sizeof(u32) * TmpCmd->Size);
-			if((void *)(uintptr_t)Cmd->DataPtr == NULL) {
-				XAIE_ERROR("Failed to allocate memory to copy "
-						"command %d\n", i);
-				free(Inst->CmdBuf);
-				free(Inst);
-				return NULL;
-			}
+	*Value = Entry->Value;
+	return XAIE_ENABLE;
+}
 
-			Cmd->DataPtr = (u64)(uintptr_t)memcpy(
-					(void *)(uintptr_t)Cmd->DataPtr,
-					(void *)(uintptr_t)TmpCmd->DataPtr,
-					sizeof(u32) * TmpCmd->Size);
+/*****************************************************************************/
+/**
+* This API records the value of a register in a shadow table.
+*
+* @param        Table: Pointer to the shadow table
+* @param        RegOff: Register offset
+* @param        Value: Value of the register
+*
+* @return       None
+*
+* @note         Internal only. The value is not recorded if the table cannot
+*		be allocated, the register is unknown in this case.
+*
+******************************************************************************/
+static void _XAie_RegShadowSet(XAie_RegShadowTable *Table, u64 RegOff,
+		u32 Value)
+{
+	XAie_RegShadowEntry *Entry;
+
+	if(Table->Size != 0U) {
+		Entry = _XAie_RegShadowSlot(Table, RegOff);
+		if(Entry->Epoch == Table->Epoch) {
+			Entry->Value = Value;
+			Entry->Valid = XAIE_ENABLE;
+			return;
 		}
 	}
 
-	Inst->Tid = TmpInst->Tid;
-	Inst->Flags = TmpInst->Flags;
-	Inst->Flags |= XAIE_TXN_INSTANCE_EXPORTED;
-	Inst->NumCmds = TmpInst->NumCmds;
-	Inst->MaxCmds = TmpInst->MaxCmds;
-	Inst->Node.Next = NULL;
+	if((Table->NumEntries + 1U) * 2U > Table->Size) {
+		_XAie_RegShadowGrow(Table);
+		if(Table->Size == 0U) {
+			return;
+		}
+	}
 
-	return Inst;
+	Entry = _XAie_RegShadowSlot(Table, RegOff);
+	Entry->RegOff = RegOff;
+	Entry->Value = Value;
+	Entry->Epoch = Table->Epoch;
+	Entry->Valid = XAIE_ENABLE;
+	Table->NumEntries++;
 }
 
-static inline void _XAie_CreateTxnHeader(XAie_DevInst *DevInst,
-		XAie_TxnHeader *Header)
+/*****************************************************************************/
+/**
+* This API drops the shadowed registers of a shadow table in an address range.
+*
+* @param        Table: Pointer to the shadow table
+* @param        Start: Offset of the first register of the range
+* @param        End: Offset past the last register of the range
+*
+* @return       None
+*
+* @note         Internal only. Scans the whole table, used for ranges which
+*		are too large to be dropped register by register. Blocks in
+*		tile memory do not reach it, see _XAie_RegShadowIsMemBlock().
+*
+******************************************************************************/
+static void _XAie_RegShadowDropRange(XAie_RegShadowTable *Table, u64 Start,
+		u64 End)
+{
+	if(Table->NumEntries == 0U) {
+		return;
+	}
+
+	for(u32 i = 0U; i < Table->Size; i++) {
+		XAie_RegShadowEntry *Entry = &Table->Entries[i];
+
+		if((Entry->Epoch == Table->Epoch) && (Entry->RegOff >= Start) &&
+				(Entry->RegOff < End)) {
+			Entry->Valid = XAIE_DISABLE;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API drops the shadowed registers of a column if a register is the column
+* reset register. The registers of the column are back to their reset values
+* once the reset is asserted, the shadow is dropped on every write of the
+* column reset, so that writes issued while the column is in reset are not
+* trusted either. It is called when the write executes, so that resets
+* recorded in transactions take effect when the transaction is submitted.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+*
+* @return       None
+*
+* @note         Internal only. Must be called with the register lock held.
+*
+******************************************************************************/
+static void _XAie_RegShadowCheckColRst(XAie_DevInst *DevInst, u64 RegOff)
+{
+	const XAie_TileMod *TileMod;
+	u64 Start;
+	u32 Off;
+
+	if(_XAie_GetRowfromRegOff(DevInst, RegOff) != DevInst->ShimRow) {
+		return;
+	}
+
+	TileMod = _XAie_GetRegTileMod(DevInst, RegOff, &Off);
+	if((TileMod == NULL) || (TileMod->PlIfMod == NULL) ||
+			(Off != TileMod->PlIfMod->ColRstOff)) {
+		return;
+	}
+
+	Start = RegOff & ~((1ULL << DevInst->DevProp.ColShift) - 1U);
+	_XAie_RegShadowDropRange(_XAie_RegShadowTableOf(DevInst, RegOff),
+			Start, Start + (1ULL << DevInst->DevProp.ColShift));
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a block lies entirely in the data or program memory of a
+* tile. Memory holds no shadowed registers, such blocks bypass the register
+* shadow.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Offset of the first word
+* @param        Size: Number of words
+*
+* @return       XAIE_ENABLE if the block is in memory, XAIE_DISABLE otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_RegShadowIsMemBlock(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Size)
+{
+	const XAie_TileMod *TileMod;
+	u64 Len = sizeof(u32) * (u64)Size;
+	u32 Off;
+
+	TileMod = _XAie_GetRegTileMod(DevInst, RegOff, &Off);
+	if((TileMod == NULL) || (Size == 0U)) {
+		return XAIE_DISABLE;
+	}
+
+	if((TileMod->MemMod != NULL) &&
+			_XAie_IsRegInRange(Off, TileMod->MemMod->MemAddr,
+				TileMod->MemMod->Size) &&
+			(Len <= TileMod->MemMod->MemAddr +
+			 TileMod->MemMod->Size - Off)) {
+		return XAIE_ENABLE;
+	}
+
+	if((TileMod->CoreMod != NULL) &&
+			_XAie_IsRegInRange(Off,
+				TileMod->CoreMod->ProgMemHostOffset,
+				TileMod->CoreMod->ProgMemSize) &&
+			(Len <= TileMod->CoreMod->ProgMemHostOffset +
+			 TileMod->CoreMod->ProgMemSize - Off)) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API updates the register shadow after a block of registers is written.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Offset of the first register
+* @param        Data: Pointer to the data, NULL if the block is set to Fill
+* @param        Fill: Value the block is set to if Data is NULL
+* @param        Size: Number of words
+*
+* @return       None
+*
+* @note         Internal only. Must be called with the register lock held.
+*
+******************************************************************************/
+static void _XAie_RegShadowUpdateBlock(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Fill, u32 Size)
+{
+	XAie_RegShadowTable *Table = _XAie_RegShadowTableOf(DevInst, RegOff);
+
+	if(_XAie_RegShadowIsMemBlock(DevInst, RegOff, Size)) {
+		return;
+	}
+
+	if(Size > XAIE_REG_SHADOW_BLOCK_MAX) {
+		_XAie_RegShadowDropRange(Table, RegOff,
+				RegOff + sizeof(u32) * (u64)Size);
+		return;
+	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		u64 Off = RegOff + sizeof(u32) * (u64)i;
+
+		if(_XAie_RegShadowIsTracked(DevInst, Off)) {
+			_XAie_RegShadowSet(Table, Off,
+					(Data != NULL) ? Data[i] : Fill);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API writes a register through the register shadow. The write is skipped
+* if the register is known to hold the value already.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+* @param        Value: Value to write
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. Must be called with the register lock held.
+*
+******************************************************************************/
+static AieRC _XAie_RegShadowWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Value)
+{
+	XAie_RegShadowTable *Table = _XAie_RegShadowTableOf(DevInst, RegOff);
+	u8 Tracked = _XAie_RegShadowIsTracked(DevInst, RegOff);
+	u32 Old;
+	AieRC RC;
+
+	if(Tracked && _XAie_RegShadowLookup(Table, RegOff, &Old) &&
+			(Old == Value)) {
+		return XAIE_OK;
+	}
+
+	RC = DevInst->Backend->Ops.Write32(DevInst->IOInst, RegOff, Value);
+	if(!Tracked) {
+		_XAie_RegShadowCheckColRst(DevInst, RegOff);
+		return RC;
+	}
+
+	if(RC == XAIE_OK) {
+		_XAie_RegShadowSet(Table, RegOff, Value);
+	} else {
+		_XAie_RegShadowDropRange(Table, RegOff, RegOff + sizeof(u32));
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API writes masked bits of a register through the register shadow. The
+* new value of a shadowed register is computed from the shadow, or from a
+* single read the first time, and written unless it is unchanged.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+* @param        Mask: Mask of the bits to write
+* @param        Value: Value to write
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. Must be called with the register lock held.
+*
+******************************************************************************/
+static AieRC _XAie_RegShadowMaskWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Mask, u32 Value)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+	XAie_RegShadowTable *Table;
+	u32 Old, New;
+	AieRC RC;
+
+	if(!_XAie_RegShadowIsTracked(DevInst, RegOff)) {
+		RC = Backend->Ops.MaskWrite32(DevInst->IOInst, RegOff, Mask,
+				Value);
+		_XAie_RegShadowCheckColRst(DevInst, RegOff);
+		return RC;
+	}
+
+	Table = _XAie_RegShadowTableOf(DevInst, RegOff);
+	if(!_XAie_RegShadowLookup(Table, RegOff, &Old)) {
+		RC = Backend->Ops.Read32(DevInst->IOInst, RegOff, &Old);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	New = (Old & ~Mask) | (Value & Mask);
+	if(New == Old) {
+		_XAie_RegShadowSet(Table, RegOff, Old);
+		return XAIE_OK;
+	}
+
+	RC = Backend->Ops.Write32(DevInst->IOInst, RegOff, New);
+	if(RC == XAIE_OK) {
+		_XAie_RegShadowSet(Table, RegOff, New);
+	} else {
+		_XAie_RegShadowDropRange(Table, RegOff, RegOff + sizeof(u32));
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API writes or sets a block of registers through the register shadow. The
+* block is skipped if all its registers are shadowed and hold the values
+* already.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Offset of the first register
+* @param        Data: Pointer to the data, NULL to set the block to Fill
+* @param        Fill: Value to set the block to if Data is NULL
+* @param        Size: Number of words
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. Must be called with the register lock held.
+*
+******************************************************************************/
+static AieRC _XAie_RegShadowBlockWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Fill, u32 Size)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+	XAie_RegShadowTable *Table = _XAie_RegShadowTableOf(DevInst, RegOff);
+	u8 Mem = _XAie_RegShadowIsMemBlock(DevInst, RegOff, Size);
+	u8 Redundant = !Mem && (Size <= XAIE_REG_SHADOW_BLOCK_MAX);
+	AieRC RC;
+
+	for(u32 i = 0U; Redundant && (i < Size); i++) {
+		u64 Off = RegOff + sizeof(u32) * (u64)i;
+		u32 Old;
+
+		Redundant = _XAie_RegShadowIsTracked(DevInst, Off) &&
+			_XAie_RegShadowLookup(Table, Off, &Old) &&
+			(Old == ((Data != NULL) ? Data[i] : Fill));
+	}
+
+	if(Redundant) {
+		return XAIE_OK;
+	}
+
+	if(Data != NULL) {
+		RC = Backend->Ops.BlockWrite32(DevInst->IOInst, RegOff, Data,
+				Size);
+	} else {
+		RC = Backend->Ops.BlockSet32(DevInst->IOInst, RegOff, Fill,
+				Size);
+	}
+
+	if(Mem) {
+		return RC;
+	}
+
+	if(RC == XAIE_OK) {
+		_XAie_RegShadowUpdateBlock(DevInst, RegOff, Data, Fill, Size);
+	} else {
+		_XAie_RegShadowDropRange(Table, RegOff,
+				RegOff + sizeof(u32) * (u64)Size);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API updates the register shadow with the commands of a transaction
+* executed by the backend.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmds: Pointer to the commands
+* @param        NumCmds: Number of commands
+*
+* @return       None
+*
+* @note         Internal only. Commands of which the effect on the registers is
+*		not known, such as custom operations, invalidate the shadow.
+*
+******************************************************************************/
+static void _XAie_RegShadowUpdateTxn(XAie_DevInst *DevInst,
+		const XAie_TxnCmd *Cmds, u32 NumCmds)
+{
+	for(u32 i = 0U; i < NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &Cmds[i];
+		XAie_RegShadowTable *Table;
+		XAie_Mutex *Lock;
+		u32 Old;
+
+		if(Cmd->Opcode == XAIE_IO_MASKPOLL) {
+			continue;
+		}
+
+		if((Cmd->Opcode != XAIE_IO_WRITE) &&
+				(Cmd->Opcode != XAIE_IO_BLOCKWRITE) &&
+				(Cmd->Opcode != XAIE_IO_BLOCKSET)) {
+			_XAie_RegShadowInvalidate(DevInst);
+			continue;
+		}
+
+		Lock = _XAie_RegLockOf(DevInst, Cmd->RegOff);
+		Table = _XAie_RegShadowTableOf(DevInst, Cmd->RegOff);
+		_XAie_MutexLock(Lock);
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			_XAie_RegShadowUpdateBlock(DevInst, Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					0U, Cmd->Size);
+		} else if(Cmd->Opcode == XAIE_IO_BLOCKSET) {
+			_XAie_RegShadowUpdateBlock(DevInst, Cmd->RegOff, NULL,
+					Cmd->Value, Cmd->Size);
+		} else if(!_XAie_RegShadowIsTracked(DevInst, Cmd->RegOff)) {
+			_XAie_RegShadowCheckColRst(DevInst, Cmd->RegOff);
+		} else if(Cmd->Mask == 0U) {
+			_XAie_RegShadowSet(Table, Cmd->RegOff, Cmd->Value);
+		} else if(_XAie_RegShadowLookup(Table, Cmd->RegOff, &Old)) {
+			_XAie_RegShadowSet(Table, Cmd->RegOff,
+					(Old & ~Cmd->Mask) |
+					(Cmd->Value & Cmd->Mask));
+		}
+		_XAie_MutexUnlock(Lock);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API drops all the registers of the register shadow of a device
+* instance. It is called when the registers may have changed without a write
+* through the driver, such as on a reset of the partition.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None
+*
+* @note         Internal only. Must not be called with a register lock held.
+*
+******************************************************************************/
+void _XAie_RegShadowInvalidate(XAie_DevInst *DevInst)
+{
+	XAie_RegShadow *Shadow = DevInst->RegShadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	for(u32 i = 0U; i < Shadow->NumTables; i++) {
+		XAie_Mutex *Lock = (DevInst->RegLocks == NULL) ? NULL :
+			&DevInst->RegLocks->Shards[i];
+
+		_XAie_MutexLock(Lock);
+		_XAie_RegShadowClear(&Shadow->Tables[i]);
+		_XAie_MutexUnlock(Lock);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API releases the register shadow of a device instance.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_RegShadowDestroy(XAie_DevInst *DevInst)
+{
+	XAie_RegShadow *Shadow = DevInst->RegShadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	DevInst->RegShadow = NULL;
+	for(u32 i = 0U; i < Shadow->NumTables; i++) {
+		free(Shadow->Tables[i].Entries);
+	}
+	free(Shadow);
+}
+
+/*****************************************************************************/
+/**
+* This API writes a register through the backend with the register lock of its
+* column held. The write goes through the register shadow when it is enabled.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+* @param        Value: Value to write
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IOWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
+{
+	XAie_Mutex *Lock = _XAie_RegLockOf(DevInst, RegOff);
+	AieRC RC;
+
+	_XAie_MutexLock(Lock);
+	if(DevInst->RegShadow != NULL) {
+		RC = _XAie_RegShadowWrite32(DevInst, RegOff, Value);
+	} else {
+		RC = DevInst->Backend->Ops.Write32(DevInst->IOInst, RegOff,
+				Value);
+	}
+	_XAie_MutexUnlock(Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API writes masked bits of a register through the backend with the
+* register lock of its column held, so that read-modify-write sequences of
+* backends are not interleaved. The write goes through the register shadow
+* when it is enabled.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+* @param        Mask: Mask of the bits to write
+* @param        Value: Value to write
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IOMaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	XAie_Mutex *Lock = _XAie_RegLockOf(DevInst, RegOff);
+	AieRC RC;
+
+	_XAie_MutexLock(Lock);
+	if(DevInst->RegShadow != NULL) {
+		RC = _XAie_RegShadowMaskWrite32(DevInst, RegOff, Mask, Value);
+	} else {
+		RC = DevInst->Backend->Ops.MaskWrite32(DevInst->IOInst, RegOff,
+				Mask, Value);
+	}
+	_XAie_MutexUnlock(Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API writes a block of registers through the backend with the register
+* lock of their column held. The write goes through the register shadow when
+* it is enabled.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Offset of the first register
+* @param        Data: Pointer to the data
+* @param        Size: Number of words
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IOBlockWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	XAie_Mutex *Lock = _XAie_RegLockOf(DevInst, RegOff);
+	AieRC RC;
+
+	_XAie_MutexLock(Lock);
+	if(DevInst->RegShadow != NULL) {
+		RC = _XAie_RegShadowBlockWrite32(DevInst, RegOff, Data, 0U,
+				Size);
+	} else {
+		RC = DevInst->Backend->Ops.BlockWrite32(DevInst->IOInst,
+				RegOff, Data, Size);
+	}
+	_XAie_MutexUnlock(Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API sets a block of registers through the backend with the register lock
+* of their column held. The write goes through the register shadow when it is
+* enabled.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Offset of the first register
+* @param        Data: Value to set
+* @param        Size: Number of words
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IOBlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	XAie_Mutex *Lock = _XAie_RegLockOf(DevInst, RegOff);
+	AieRC RC;
+
+	_XAie_MutexLock(Lock);
+	if(DevInst->RegShadow != NULL) {
+		RC = _XAie_RegShadowBlockWrite32(DevInst, RegOff, NULL, Data,
+				Size);
+	} else {
+		RC = DevInst->Backend->Ops.BlockSet32(DevInst->IOInst, RegOff,
+				Data, Size);
+	}
+	_XAie_MutexUnlock(Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API writes a command through the backend with the register lock of the
+* tile column held.
+*
+* @param        DevInst: Device instance pointer
+* @param        Col: Column of the tile
+* @param        Row: Row of the tile
+* @param        Command: Command
+* @param        CmdWd0: First command word
+* @param        CmdWd1: Second command word
+* @param        CmdStr: Command string
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IOCmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row,
+		u8 Command, u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	XAie_Mutex *Lock = _XAie_RegLockOf(DevInst,
+			XAie_GetTileAddr(DevInst, Row, Col));
+	AieRC RC;
+
+	_XAie_MutexLock(Lock);
+	RC = DevInst->Backend->Ops.CmdWrite(DevInst->IOInst, Col, Row, Command,
+			CmdWd0, CmdWd1, CmdStr);
+	_XAie_MutexUnlock(Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API reads a register through the backend with the register lock of its
+* column held, so that the read is not interleaved with read-modify-write
+* sequences of backends on the same column.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+* @param        Data: Pointer to store the value
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IORead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
+{
+	XAie_Mutex *Lock = _XAie_RegLockOf(DevInst, RegOff);
+	AieRC RC;
+
+	_XAie_MutexLock(Lock);
+	RC = DevInst->Backend->Ops.Read32(DevInst->IOInst, RegOff, Data);
+	_XAie_MutexUnlock(Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API reads a block of registers through the backend with the register
+* lock of their column held. Backends without a block read operation are read
+* one word at a time.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Offset of the first register
+* @param        Data: Pointer to store the words
+* @param        Size: Number of words
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IOBlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+	XAie_Mutex *Lock = _XAie_RegLockOf(DevInst, RegOff);
+	AieRC RC = XAIE_OK;
+
+	_XAie_MutexLock(Lock);
+	if(Backend->Ops.BlockRead32 != NULL) {
+		RC = Backend->Ops.BlockRead32(DevInst->IOInst, RegOff, Data,
+				Size);
+	} else {
+		for(u32 i = 0U; (RC == XAIE_OK) && (i < Size); i++) {
+			RC = Backend->Ops.Read32(DevInst->IOInst,
+					RegOff + i * 4U, &Data[i]);
+		}
+	}
+	_XAie_MutexUnlock(Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API polls a register through the backend. The register lock of the
+* column is not taken, so that other threads can write the registers of the
+* same lock shard while the poll waits, including the write the poll waits
+* for.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+* @param        Mask: Mask of the polled bits
+* @param        Value: Value to wait for
+* @param        TimeOutUs: Timeout in microseconds
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. A poll only reads the register. A read racing
+*		with a read-modify-write sequence of a backend returns the value
+*		before or after it, which the poll retries on anyway.
+*
+******************************************************************************/
+static AieRC _XAie_IOMaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask,
+		u32 Value, u32 TimeOutUs)
+{
+	return DevInst->Backend->Ops.MaskPoll(DevInst->IOInst, RegOff, Mask,
+			Value, TimeOutUs);
+}
+
+/*****************************************************************************/
+/**
+* This API moves the transaction list of the device instance to a new
+* generation. It invalidates the per thread lookup caches of all threads.
+*
+* @param        DevInst: Device Instance
+*
+* @return       None
+*
+* @note         Internal only. Must be called with TxnListLock held.
+*
+******************************************************************************/
+static inline void _XAie_TxnListNextGen(XAie_DevInst *DevInst)
+{
+	XAIE_ATOMIC_STORE(&DevInst->TxnListGen,
+			XAIE_ATOMIC_INC(&TxnListGenCounter));
+}
+
+/*****************************************************************************/
+/**
+* This API initializes the empty transaction list of a device instance. The
+* list gets a generation no lookup cache entry refers to, even if the device
+* instance is initialized again at the same address.
+*
+* @param        DevInst: Device Instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnListInit(XAie_DevInst *DevInst)
+{
+	DevInst->TxnList.Next = NULL;
+	_XAie_TxnListNextGen(DevInst);
+}
+
+/*****************************************************************************/
+/**
+* This API fills the lookup cache entry of the calling thread.
+*
+* @param        DevInst: Device Instance
+* @param        Tid: Thread id of the calling thread
+* @param        Gen: Generation of the transaction list at the lookup
+* @param        Inst: Transaction instance of the thread or NULL
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline void _XAie_TxnLookupCacheSet(const XAie_DevInst *DevInst,
+		u64 Tid, u32 Gen, XAie_TxnInst *Inst)
+{
+	TxnLookupCache.DevInst = DevInst;
+	TxnLookupCache.Tid = Tid;
+	TxnLookupCache.Gen = Gen;
+	TxnLookupCache.Inst = Inst;
+}
+
+/*****************************************************************************/
+/**
+* This API inserts a transaction node to the linked list.
+*
+* @param        DevInst: Device Instance
+* @param        TxnNode: Pointer to the transaction node to be inserted
+*
+* @return       None
+*
+* @note         Internal only. Must be called by the thread of the transaction
+*		instance.
+*
+******************************************************************************/
+static void _XAie_AppendTxnInstToList(XAie_DevInst *DevInst, XAie_TxnInst *Inst)
+{
+	XAie_List *Node = &DevInst->TxnList;
+
+	_XAie_MutexLock(DevInst->TxnListLock);
+
+	while(Node->Next != NULL) {
+		Node = Node->Next;
+	}
+
+	Inst->Node.Next = NULL;
+	XAIE_ATOMIC_STORE(&Node->Next, &Inst->Node);
+	_XAie_TxnLookupCacheSet(DevInst, Inst->Tid, DevInst->TxnListGen, Inst);
+
+	_XAie_MutexUnlock(DevInst->TxnListLock);
+}
+
+/*****************************************************************************/
+/**
+* This API returns the transaction list from the linked list based on the thread
+* id.
+*
+* @param        DevInst: Device instance pointer
+* @param	Tid: Thread id.
+*
+* @return       Pointer to transaction instance on success and NULL on failure
+*
+* @note         Internal only. The result of the last lookup is cached per
+*		thread. A thread can only start or submit its own transaction
+*		and updates its cache entry when it does, so the cached
+*		instance cannot be released by another thread while the
+*		generation of the list is unchanged.
+*
+******************************************************************************/
+static XAie_TxnInst *_XAie_GetTxnInst(XAie_DevInst *DevInst, u64 Tid)
+{
+	XAie_TxnLookupCache *Cache = &TxnLookupCache;
+	XAie_List *NodePtr;
+	XAie_TxnInst *TxnInst, *Found = NULL;
+	u32 Gen;
+
+	Gen = XAIE_ATOMIC_LOAD(&DevInst->TxnListGen);
+	if((Cache->DevInst == DevInst) && (Cache->Tid == Tid) &&
+			(Cache->Gen == Gen)) {
+		return Cache->Inst;
+	}
+
+	_XAie_MutexLock(DevInst->TxnListLock);
+
+	Gen = DevInst->TxnListGen;
+	NodePtr = DevInst->TxnList.Next;
+	while(NodePtr != NULL) {
+		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, Node);
+		if(TxnInst->Tid == Tid) {
+			Found = TxnInst;
+			break;
+		}
+
+		NodePtr = NodePtr->Next;
+	}
+
+	_XAie_MutexUnlock(DevInst->TxnListLock);
+
+	_XAie_TxnLookupCacheSet(DevInst, Tid, Gen, Found);
+
+	return Found;
+}
+
+/*****************************************************************************/
+/**
+* This API removes a node from the linked list if the thread id is found.
+*
+* @param        DevInst: Device instance pointer
+* @param	Tid: Thread id.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. Must be called by the thread of Tid.
+*
+******************************************************************************/
+static AieRC _XAie_RemoveTxnInstFromList(XAie_DevInst *DevInst, u64 Tid)
+{
+	XAie_List *NodePtr;
+	XAie_List *Prev = &DevInst->TxnList;
+	XAie_TxnInst *Inst;
+
+	_XAie_MutexLock(DevInst->TxnListLock);
+
+	NodePtr = DevInst->TxnList.Next;
+	while(NodePtr != NULL) {
+		Inst = (XAie_TxnInst *)XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst,
+				Node);
+		if(Inst->Tid == Tid) {
+			break;
+		}
+
+		Prev = NodePtr;
+		NodePtr = NodePtr->Next;
+	}
+
+	if(NodePtr == NULL) {
+		_XAie_MutexUnlock(DevInst->TxnListLock);
+		XAIE_ERROR("Cannot find node to delete from list\n");
+		return XAIE_ERR;
+	}
+
+	XAIE_ATOMIC_STORE(&Prev->Next, NodePtr->Next);
+	_XAie_TxnLookupCacheSet(DevInst, Tid, DevInst->TxnListGen, NULL);
+
+	_XAie_MutexUnlock(DevInst->TxnListLock);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the transaction instance recorded by the calling thread.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       Pointer to the transaction instance or NULL if the calling
+*		thread has not started a transaction.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+XAie_TxnInst* _XAie_TxnGetCurrentInst(XAie_DevInst *DevInst)
+{
+	return _XAie_GetTxnInst(DevInst, DevInst->Backend->Ops.GetTid());
+}
+
+/*****************************************************************************/
+/**
+* This API runs the transaction optimizer on a transaction instance if the
+* instance was started with XAIE_TRANSACTION_ENABLE_OPTIMIZE.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnOptimizeIfEnabled(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
+{
+	XAie_TxnOptStats Stats;
+	AieRC RC;
+
+	if(!(TxnInst->Flags & XAIE_TXN_OPTIMIZE_MASK)) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_TxnOptimize(DevInst, TxnInst, XAIE_TXN_OPT_ALL, &Stats);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to optimize transaction\n");
+		return RC;
+	}
+
+	XAIE_DBG("Transaction optimized from %d to %d commands (coalesced %d, "
+			"folded %d, dropped %d)\n", Stats.NumOpsBefore,
+			Stats.NumOpsAfter, Stats.NumCoalesced, Stats.NumFolded,
+			Stats.NumDropped);
+
+	return XAIE_OK;
+}
+
+void BuffHexDump(char* buff,u32 size) {
+	XAIE_DBG("Buff Info %p %d\n",buff,size);
+	for (u32 i = 0; i < size; ++i) {
+		printf("0x%x ",(u8)buff[i]&0xffU);
+	}
+	printf("\n");
+}
+
+static int TxnCmdDump(XAie_TxnCmd* cmd) {
+	XAIE_DBG("TxnCmdDump Called for %d and size %d\n",cmd->Opcode,cmd->Size);
+	BuffHexDump((char *)(uintptr_t)(cmd->DataPtr),cmd->Size);
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+* This API rellaocates the command buffer associated with the given transaction
+* instance. The capacity of the command buffer is doubled so that recording a
+* transaction of N commands copies the buffer only log(N) times.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only. The command buffer is not taken from the
+*		payload chunks on purpose. It must stay one contiguous array
+*		that grows, while chunk memory is bump allocated and can't be
+*		extended or released on its own. Growing it in the chunks
+*		would strand every previous copy until the next reset, and
+*		the reset on auto-flush recycles the chunks but keeps the
+*		command buffer. realloc() can also grow it in place.
+*
+******************************************************************************/
+static AieRC _XAie_ReallocCmdBuf(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnCmd *CmdBuf;
+	u32 MaxCmds = TxnInst->MaxCmds * 2U;
+
+	if(MaxCmds < XAIE_DEFAULT_NUM_CMDS) {
+		MaxCmds = XAIE_DEFAULT_NUM_CMDS;
+	}
+
+	CmdBuf = (XAie_TxnCmd *)realloc((void *)TxnInst->CmdBuf,
+			sizeof(XAie_TxnCmd) * (u64)MaxCmds);
+	if(CmdBuf == NULL) {
+		XAIE_ERROR("Failed reallocate memory for transaction buffer "
+				"with id: %d\n", TxnInst->Tid);
+		return XAIE_ERR;
+	}
+
+	TxnInst->CmdBuf = CmdBuf;
+	TxnInst->MaxCmds = MaxCmds;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API appends a zeroed command to the command buffer of a transaction
+* instance.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       Pointer to the new command on success, NULL on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+XAie_TxnCmd* _XAie_TxnAllocCmd(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnCmd *Cmd;
+
+	if(TxnInst->NumCmds == TxnInst->MaxCmds) {
+		if(_XAie_ReallocCmdBuf(TxnInst) != XAIE_OK) {
+			return NULL;
+		}
+	}
+
+	Cmd = &TxnInst->CmdBuf[TxnInst->NumCmds++];
+	memset((void *)Cmd, 0, sizeof(*Cmd));
+
+	return Cmd;
+}
+
+/*****************************************************************************/
+/**
+* This API allocates memory for a command payload from the payload chunks of
+* the transaction instance. Requests larger than the default chunk size get a
+* dedicated chunk, which is linked behind the current chunk so that the free
+* space of the current chunk is still used by later requests.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Size: Size of the payload in bytes
+*
+* @return       Pointer to the payload on success and NULL on failure
+*
+* @note         Internal only. The memory is owned by the transaction instance
+*		and released by _XAie_Txn_ResetCmdBuf() or _XAie_TxnInstFree().
+*
+******************************************************************************/
+void* _XAie_TxnPayloadAlloc(XAie_TxnInst *TxnInst, u64 Size)
+{
+	XAie_TxnChunk *Chunk = TxnInst->Chunks;
+	u64 ChunkSize;
+	void *Ptr;
+
+	Size = (Size + XAIE_TXN_PAYLOAD_ALIGN - 1U) &
+		~((u64)XAIE_TXN_PAYLOAD_ALIGN - 1U);
+
+	if((Chunk != NULL) && (Chunk->Size - Chunk->Used >= Size)) {
+		Ptr = (u8 *)Chunk->Payload + Chunk->Used;
+		Chunk->Used += Size;
+		return Ptr;
+	}
+
+	ChunkSize = (Size > XAIE_TXN_PAYLOAD_CHUNK_SIZE) ? Size :
+		XAIE_TXN_PAYLOAD_CHUNK_SIZE;
+	Chunk = (XAie_TxnChunk *)malloc(sizeof(*Chunk) + ChunkSize);
+	if(Chunk == NULL) {
+		XAIE_ERROR("Failed to allocate memory for transaction "
+				"payload\n");
+		return NULL;
+	}
+
+	Chunk->Size = ChunkSize;
+	Chunk->Used = Size;
+	if((TxnInst->Chunks != NULL) && (Size > XAIE_TXN_PAYLOAD_CHUNK_SIZE)) {
+		Chunk->Next = TxnInst->Chunks->Next;
+		TxnInst->Chunks->Next = Chunk;
+	} else {
+		Chunk->Next = TxnInst->Chunks;
+		TxnInst->Chunks = Chunk;
+	}
+
+	return (void *)Chunk->Payload;
+}
+
+/*****************************************************************************/
+/**
+* This API resets the command buffer of a transaction instance once its
+* commands are executed. The current payload chunk is kept for reuse and all
+* the other chunks are released.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_Txn_ResetCmdBuf(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnChunk *Chunk = TxnInst->Chunks;
+	XAie_TxnChunk *Next;
+
+	TxnInst->NumCmds = 0U;
+	_XAie_TxnShadowReset(TxnInst);
+	_XAie_TxnTagsReset(TxnInst);
+	if(Chunk == NULL) {
+		return;
+	}
+
+	Next = Chunk->Next;
+	while(Next != NULL) {
+		XAie_TxnChunk *Tmp = Next->Next;
+
+		free(Next);
+		Next = Tmp;
+	}
+
+	Chunk->Next = NULL;
+	Chunk->Used = 0U;
+}
+
+/*****************************************************************************/
+/**
+* This API releases a transaction instance along with its command buffer and
+* all its payload chunks.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnInstFree(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnChunk *Chunk = TxnInst->Chunks;
+
+	while(Chunk != NULL) {
+		XAie_TxnChunk *Next = Chunk->Next;
+
+		free(Chunk);
+		Chunk = Next;
+	}
+
+	_XAie_TxnShadowFree(TxnInst);
+	_XAie_TxnTagsFree(TxnInst);
+	free(TxnInst->CmdBuf);
+	free(TxnInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api allocates the memory to store the IO transaction commands
+* when the driver is configured to execute in transaction mode.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Flags - Flags passed by the user.
+*
+* @return	Pointer to transaction instance on success and NULL on error.
+*
+* @note		Internal Only.
+*
+******************************************************************************/
+AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags)
+{
+	XAie_TxnInst *Inst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	Inst = (XAie_TxnInst*)malloc(sizeof(*Inst));
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to allocate memory for txn instance\n");
+		return XAIE_ERR;
+	}
+
+	Inst->CmdBuf = (XAie_TxnCmd*)calloc(XAIE_DEFAULT_NUM_CMDS,
+			sizeof(*Inst->CmdBuf));
+	if(Inst->CmdBuf == NULL) {
+		XAIE_ERROR("Failed to allocate memory for command buffer\n");
+		free(Inst);
+		return XAIE_ERR;
+	}
+
+	Inst->NumCmds = 0U;
+	Inst->MaxCmds = XAIE_DEFAULT_NUM_CMDS;
+	Inst->Chunks = NULL;
+	Inst->Shadow = NULL;
+	Inst->Tags = NULL;
+	Inst->NumTemplates = 0U;
+	Inst->Tid = Backend->Ops.GetTid();
+	Inst->NextCustomOp = (u8)XAIE_IO_CUSTOM_OP_NEXT;
+
+	XAIE_DBG("Transaction buffer allocated with id: %ld\n", Inst->Tid);
+	Inst->Flags = Flags;
+	if(Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
+		XAIE_DBG("Auto flush is enabled for transaction buffer with "
+				"id: %ld\n", Inst->Tid);
+	} else {
+		XAIE_DBG("Auto flush is disabled for transaction buffer with "
+				"id: %ld\n", Inst->Tid);
+	}
+
+	_XAie_AppendTxnInstToList(DevInst, Inst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the handler registered for a custom operation.
+*
+* @param        DevInst: Device instance pointer
+* @param        Opcode: Custom operation code
+*
+* @return       Pointer to the handler entry or NULL if no handler is
+*		registered for the operation.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static const XAie_TxnCustomOpEntry* _XAie_TxnGetCustomOpHandler(
+		XAie_DevInst *DevInst, XAie_TxnOpcode Opcode)
+{
+	const XAie_TxnCustomOps *CustomOps =
+		XAIE_ATOMIC_LOAD(&DevInst->TxnCustomOps);
+	const XAie_TxnCustomOpEntry *Entry;
+
+	if((CustomOps == NULL) || (Opcode < XAIE_IO_CUSTOM_OP_BEGIN) ||
+			(Opcode > XAIE_IO_CUSTOM_OP_MAX)) {
+		return NULL;
+	}
+
+	Entry = &CustomOps->Ops[Opcode - XAIE_IO_CUSTOM_OP_BEGIN];
+	if(Entry->Handler == NULL) {
+		return NULL;
+	}
+
+	return Entry;
+}
+
+/*****************************************************************************/
+/**
+* This API runs the handler registered for a custom operation command.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmd: Pointer to the custom operation command
+*
+* @return       XAIE_OK if the handler succeeds or no handler is registered,
+*		error code returned by the handler otherwise.
+*
+* @note         Internal only. Register accesses done by the handler are
+*		issued to the backend directly.
+*
+******************************************************************************/
+static AieRC _XAie_TxnRunCustomOp(XAie_DevInst *DevInst,
+		const XAie_TxnCmd *Cmd)
+{
+	const XAie_TxnCustomOpEntry *Entry;
+	AieRC RC;
+
+	Entry = _XAie_TxnGetCustomOpHandler(DevInst, Cmd->Opcode);
+	if(Entry == NULL) {
+		XAIE_WARN("No handler registered for custom op %d\n",
+				Cmd->Opcode);
+		return XAIE_OK;
+	}
+
+	TxnCustomOpDepth++;
+	RC = Entry->Handler(DevInst, (u8)Cmd->Opcode,
+			(const void *)(uintptr_t)Cmd->DataPtr, Cmd->Size,
+			Entry->Priv);
+	TxnCustomOpDepth--;
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Custom op %d handler failed\n", Cmd->Opcode);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API decodes the command type and executes the IO operation.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmd: Pointer to the transaction command structure
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note         Internal only. Payloads of the commands are owned by the
+*		transaction instance and are not released here.
+*
+******************************************************************************/
+static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd)
+{
+	AieRC RC;
+
+	if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+		return _XAie_TxnRunCustomOp(DevInst, Cmd);
+	}
+
+	switch(Cmd->Opcode)
+	{
+		case XAIE_IO_WRITE:
+			if(Cmd->Mask == 0U) {
+				RC = _XAie_IOWrite32(DevInst, Cmd->RegOff,
+						Cmd->Value);
+			} else {
+
+				RC = _XAie_IOMaskWrite32(DevInst, Cmd->RegOff,
+						Cmd->Mask, Cmd->Value);
+			}
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Wr failed. Addr: 0x%lx, Mask: 0x%x,"
+						"Value: 0x%x\n", Cmd->RegOff,
+						Cmd->Mask, Cmd->Value);
+				return RC;
+			}
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			RC = _XAie_IOBlockWrite32(DevInst, Cmd->RegOff,
+					(u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
+						Cmd->RegOff);
+				return RC;
+			}
+			break;
+		case XAIE_IO_BLOCKSET:
+			RC = _XAie_IOBlockSet32(DevInst, Cmd->RegOff,
+					Cmd->Value, Cmd->Size);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
+						Cmd->RegOff);
+				return RC;
+			}
+			break;
+		case XAIE_IO_MASKPOLL:
+			/* Force timeout to default value */
+			RC = _XAie_IOMaskPoll(DevInst, Cmd->RegOff,
+					Cmd->Mask, Cmd->Value, 0U);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("MP failed. Addr: 0x%lx, Mask: 0x%x, Value: 0x%x\n",
+						Cmd->RegOff, Cmd->Mask,
+						Cmd->Value);
+				return RC;
+			}
+			break;
+
+		default:
+			XAIE_ERROR("Invalid transaction opcode\n");
+			return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if two commands of a run of vectored commands may be passed
+* to the backend in the same call: either both are mask polls, or none is and
+* both are protected by the same register lock.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmd: Pointer to the first command of the call
+* @param        Next: Pointer to the command to add to the call
+*
+* @return       XAIE_ENABLE if the commands can be grouped, XAIE_DISABLE
+*		otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_IOExecCmdsGroup(XAie_DevInst *DevInst, const XAie_TxnCmd *Cmd,
+		const XAie_TxnCmd *Next)
+{
+	if(DevInst->RegLocks == NULL) {
+		return XAIE_ENABLE;
+	}
+
+	if(Cmd->Opcode == XAIE_IO_MASKPOLL) {
+		return Next->Opcode == XAIE_IO_MASKPOLL;
+	}
+
+	return (Next->Opcode != XAIE_IO_MASKPOLL) &&
+		(_XAie_RegLockOf(DevInst, Next->RegOff) ==
+		 _XAie_RegLockOf(DevInst, Cmd->RegOff));
+}
+
+/*****************************************************************************/
+/**
+* This API executes a run of write, block write, block set and mask poll
+* commands with the vectored operation of the backend. The run is split into
+* groups of consecutive commands of the same register lock shard, each passed
+* to the backend with its register lock held, and groups of consecutive mask
+* polls, passed to the backend without any lock as in _XAie_IOMaskPoll().
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmds: Pointer to the first command
+* @param        NumCmds: Number of commands
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. Must not be used with the register shadow
+*		enabled, as the shadow is not updated.
+*
+******************************************************************************/
+static AieRC _XAie_IOExecCmds(XAie_DevInst *DevInst, const XAie_TxnCmd *Cmds,
+		u32 NumCmds)
+{
+	u32 Start = 0U;
+	AieRC RC = XAIE_OK;
+
+	while((RC == XAIE_OK) && (Start < NumCmds)) {
+		XAie_Mutex *Lock = NULL;
+		u32 End = Start + 1U;
+
+		while((End < NumCmds) && _XAie_IOExecCmdsGroup(DevInst,
+					&Cmds[Start], &Cmds[End])) {
+			End++;
+		}
+
+		if(Cmds[Start].Opcode != XAIE_IO_MASKPOLL) {
+			Lock = _XAie_RegLockOf(DevInst, Cmds[Start].RegOff);
+		}
+
+		_XAie_MutexLock(Lock);
+		RC = DevInst->Backend->Ops.ExecCmds(DevInst->IOInst,
+				&Cmds[Start], End - Start);
+		_XAie_MutexUnlock(Lock);
+
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to execute %u commands. Addr: "
+					"0x%lx\n", End - Start,
+					Cmds[Start].RegOff);
+		}
+		Start = End;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API executes an array of commands. Runs of write, block write, block set
+* and mask poll commands are passed to the vectored operation of the backend
+* when the backend provides one, other commands are executed one by one.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmds: Pointer to the first command
+* @param        NumCmds: Number of commands
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. Commands are executed one by one when the
+*		register shadow is enabled, so that writes go through it.
+*
+******************************************************************************/
+static AieRC _XAie_ExecuteCmds(XAie_DevInst *DevInst, XAie_TxnCmd *Cmds,
+		u32 NumCmds)
+{
+	u8 Vectored = (DevInst->Backend->Ops.ExecCmds != NULL) &&
+		(DevInst->RegShadow == NULL);
+	u32 Start = 0U;
+	AieRC RC;
+
+	for(u32 i = 0U; i <= NumCmds; i++) {
+		if(Vectored && (i < NumCmds) &&
+				((Cmds[i].Opcode == XAIE_IO_WRITE) ||
+				 (Cmds[i].Opcode == XAIE_IO_BLOCKWRITE) ||
+				 (Cmds[i].Opcode == XAIE_IO_BLOCKSET) ||
+				 (Cmds[i].Opcode == XAIE_IO_MASKPOLL))) {
+			continue;
+		}
+
+		if(i > Start) {
+			RC = _XAie_IOExecCmds(DevInst, &Cmds[Start],
+					i - Start);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		if(i < NumCmds) {
+			RC = _XAie_ExecuteCmd(DevInst, &Cmds[i]);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+		Start = i + 1U;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API submits the commands of a transaction instance to the backend in a
+* single call and updates the register shadow with them.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and error code on failure
+*
+* @note         Internal only. The register shadow is invalidated if the
+*		submission fails, as the commands may be partially executed.
+*
+******************************************************************************/
+static AieRC _XAie_TxnSubmitSegment(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
+{
+	AieRC RC;
+
+	RC = DevInst->Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst);
+	if(DevInst->RegShadow != NULL) {
+		if(RC == XAIE_OK) {
+			_XAie_RegShadowUpdateTxn(DevInst, TxnInst->CmdBuf,
+					TxnInst->NumCmds);
+		} else {
+			_XAie_RegShadowInvalidate(DevInst);
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API submits the commands of a transaction instance to the backend. The
+* submission is split at the custom operations with a registered handler, the
+* handlers run on the host in between the submitted segments.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and error code on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_Txn_SubmitToBackend(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
+{
+	XAie_TxnInst Segment;
+	u32 Start = 0U;
+	AieRC RC;
+
+	if(DevInst->TxnCustomOps == NULL) {
+		return _XAie_TxnSubmitSegment(DevInst, TxnInst);
+	}
+
+	Segment = *TxnInst;
+	for(u32 i = 0U; i <= TxnInst->NumCmds; i++) {
+		if((i < TxnInst->NumCmds) && (_XAie_TxnGetCustomOpHandler(
+				DevInst, TxnInst->CmdBuf[i].Opcode) == NULL)) {
+			continue;
+		}
+
+		if(i > Start) {
+			Segment.CmdBuf = &TxnInst->CmdBuf[Start];
+			Segment.NumCmds = i - Start;
+			RC = _XAie_TxnSubmitSegment(DevInst, &Segment);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		if(i < TxnInst->NumCmds) {
+			RC = _XAie_TxnRunCustomOp(DevInst, &TxnInst->CmdBuf[i]);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+		Start = i + 1U;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a command orders the commands of all the columns. Custom
+* operations, shim DMA buffer descriptor operations, polls and accesses
+* outside of the partition columns are barriers. Polls may wait for writes of
+* other columns, such as the ones of a DMA feeding the polled tile.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmd: Pointer to the transaction command
+*
+* @return       XAIE_ENABLE if the command is a barrier, XAIE_DISABLE
+*		otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TxnIsColBarrier(XAie_DevInst *DevInst, const XAie_TxnCmd *Cmd)
+{
+	if((Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) ||
+			(Cmd->Opcode == XAIE_CONFIG_SHIMDMA_BD) ||
+			(Cmd->Opcode == XAIE_CONFIG_SHIMDMA_DMABUF_BD) ||
+			(Cmd->Opcode == XAIE_IO_MASKPOLL)) {
+		return XAIE_ENABLE;
+	}
+
+	if((Cmd->RegOff >> DevInst->DevProp.ColShift) >= DevInst->NumCols) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API executes a run of commands of a transaction instance, either by
+* submitting them to the backend or with _XAie_ExecuteCmds().
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Cmds: Pointer to the first command of the run
+* @param        NumCmds: Number of commands of the run
+*
+* @return       XAIE_OK on success and error code on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnExecCmds(XAie_DevInst *DevInst,
+		const XAie_TxnInst *TxnInst, XAie_TxnCmd *Cmds, u32 NumCmds)
+{
+	if(DevInst->Backend->Ops.SubmitTxn != NULL) {
+		XAie_TxnInst Segment = *TxnInst;
+
+		Segment.CmdBuf = Cmds;
+		Segment.NumCmds = NumCmds;
+		return _XAie_Txn_SubmitToBackend(DevInst, &Segment);
+	}
+
+	return _XAie_ExecuteCmds(DevInst, Cmds, NumCmds);
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+* This API executes the commands of the current section of a parallel flush,
+* taking columns until all of them are taken.
+*
+* @param        Flush: Pointer to the parallel flush state
+*
+* @return       None
+*
+* @note         Internal only. Runs on the flushing thread and on the
+*		workers. The first error is recorded in the flush state.
+*
+******************************************************************************/
+static void _XAie_TxnFlushColumns(XAie_TxnParallelFlush *Flush)
+{
+	XAie_DevInst *DevInst = Flush->DevInst;
+	u32 Col;
+
+	while((Col = XAIE_ATOMIC_INC(&Flush->NextCol) - 1U) <
+			DevInst->NumCols) {
+		u32 Start = Flush->ColStart[Col];
+		u32 NumCmds = Flush->ColStart[Col + 1U] - Start;
+		AieRC RC;
+
+		if((NumCmds == 0U) ||
+				(XAIE_ATOMIC_LOAD(&Flush->RC) != XAIE_OK)) {
+			continue;
+		}
+
+		RC = _XAie_TxnExecCmds(DevInst, Flush->TxnInst,
+				&Flush->Sorted[Start], NumCmds);
+		if(RC != XAIE_OK) {
+			XAIE_ATOMIC_STORE(&Flush->RC, RC);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API is the entry of the worker threads of a parallel flush pool. A
+* worker executes columns of every section released to the pool until it is
+* asked to exit.
+*
+* @param        Arg: Pointer to the parallel flush pool
+*
+* @return       NULL
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void* _XAie_TxnFlushWorker(void *Arg)
+{
+	XAie_TxnFlushPool *Pool = (XAie_TxnFlushPool *)Arg;
+	XAie_TxnParallelFlush *Flush;
+	u32 Gen = 0U;
+
+	for(;;) {
+		pthread_mutex_lock(&Pool->Lock);
+		while((Pool->Gen == Gen) && (Pool->Exit == 0U)) {
+			pthread_cond_wait(&Pool->StartCond, &Pool->Lock);
+		}
+		if(Pool->Exit != 0U) {
+			pthread_mutex_unlock(&Pool->Lock);
+			return NULL;
+		}
+		Gen = Pool->Gen;
+		Flush = Pool->Flush;
+		pthread_mutex_unlock(&Pool->Lock);
+
+		_XAie_TxnFlushColumns(Flush);
+
+		pthread_mutex_lock(&Pool->Lock);
+		Pool->NumBusy--;
+		if(Pool->NumBusy == 0U) {
+			pthread_cond_signal(&Pool->DoneCond);
+		}
+		pthread_mutex_unlock(&Pool->Lock);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API initializes the locks and conditions of a parallel flush pool.
+*
+* @param        Pool: Pointer to the parallel flush pool
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure, in which case
+*		nothing is left initialized.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnFlushPoolInit(XAie_TxnFlushPool *Pool)
+{
+	if(pthread_mutex_init(&Pool->Owner, NULL) != 0) {
+		XAIE_ERROR("Failed to initialize parallel flush\n");
+		return XAIE_ERR;
+	}
+
+	if(pthread_mutex_init(&Pool->Lock, NULL) != 0) {
+		XAIE_ERROR("Failed to initialize parallel flush\n");
+		pthread_mutex_destroy(&Pool->Owner);
+		return XAIE_ERR;
+	}
+
+	if(pthread_cond_init(&Pool->StartCond, NULL) != 0) {
+		XAIE_ERROR("Failed to initialize parallel flush\n");
+		pthread_mutex_destroy(&Pool->Lock);
+		pthread_mutex_destroy(&Pool->Owner);
+		return XAIE_ERR;
+	}
+
+	if(pthread_cond_init(&Pool->DoneCond, NULL) != 0) {
+		XAIE_ERROR("Failed to initialize parallel flush\n");
+		pthread_cond_destroy(&Pool->StartCond);
+		pthread_mutex_destroy(&Pool->Lock);
+		pthread_mutex_destroy(&Pool->Owner);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the parallel flush pool of a device instance, starting it
+* on first use.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       Pointer to the pool, NULL if it could not be set up.
+*
+* @note         Internal only. The pool may have no worker if no thread could
+*		be started, its sections are then executed by the calling
+*		thread.
+*
+******************************************************************************/
+static XAie_TxnFlushPool* _XAie_TxnFlushPoolGet(XAie_DevInst *DevInst)
+{
+	XAie_TxnFlushPool *Pool;
+	u32 MaxWorkers;
+
+	Pool = XAIE_ATOMIC_LOAD(&DevInst->TxnFlushPool);
+	if(Pool != NULL) {
+		return Pool;
+	}
+
+	_XAie_MutexLock(DevInst->TxnListLock);
+	Pool = DevInst->TxnFlushPool;
+	if(Pool == NULL) {
+		Pool = (XAie_TxnFlushPool *)calloc(1U, sizeof(*Pool));
+		if(Pool == NULL) {
+			_XAie_MutexUnlock(DevInst->TxnListLock);
+			XAIE_ERROR("Failed to allocate memory for parallel "
+					"flush\n");
+			return NULL;
+		}
+
+		if(_XAie_TxnFlushPoolInit(Pool) != XAIE_OK) {
+			_XAie_MutexUnlock(DevInst->TxnListLock);
+			free(Pool);
+			return NULL;
+		}
+
+		MaxWorkers = DevInst->RegLocks->NumShards;
+		if(MaxWorkers > DevInst->NumCols) {
+			MaxWorkers = DevInst->NumCols;
+		}
+		for(; Pool->NumWorkers < MaxWorkers - 1U; Pool->NumWorkers++) {
+			if(pthread_create(&Pool->Workers[Pool->NumWorkers],
+					NULL, _XAie_TxnFlushWorker,
+					Pool) != 0) {
+				XAIE_WARN("Flushing with %d worker threads\n",
+						Pool->NumWorkers);
+				break;
+			}
+		}
+		XAIE_ATOMIC_STORE(&DevInst->TxnFlushPool, Pool);
+	}
+	_XAie_MutexUnlock(DevInst->TxnListLock);
+
+	return Pool;
+}
+#endif
+
+/*****************************************************************************/
+/**
+* This API stops the parallel flush workers of a device instance, if any.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None
+*
+* @note         Internal only. No flush may be in progress.
+*
+******************************************************************************/
+void _XAie_TxnFlushPoolFree(XAie_DevInst *DevInst)
+{
+#ifdef __linux__
+	XAie_TxnFlushPool *Pool = DevInst->TxnFlushPool;
+
+	if(Pool == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&Pool->Lock);
+	Pool->Exit = 1U;
+	pthread_cond_broadcast(&Pool->StartCond);
+	pthread_mutex_unlock(&Pool->Lock);
+	for(u32 w = 0U; w < Pool->NumWorkers; w++) {
+		pthread_join(Pool->Workers[w], NULL);
+	}
+
+	pthread_cond_destroy(&Pool->DoneCond);
+	pthread_cond_destroy(&Pool->StartCond);
+	pthread_mutex_destroy(&Pool->Lock);
+	pthread_mutex_destroy(&Pool->Owner);
+	free(Pool);
+	DevInst->TxnFlushPool = NULL;
+#else
+	(void)DevInst;
+#endif
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+* This API sorts the commands of a section between two barriers by column,
+* keeping the order of the commands of each column.
+*
+* @param        Flush: Pointer to the parallel flush state
+* @param        Cmds: Pointer to the first command of the section
+* @param        NumCmds: Number of commands of the section
+*
+* @return       Number of columns with commands.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u32 _XAie_TxnSortByCol(XAie_TxnParallelFlush *Flush,
+		const XAie_TxnCmd *Cmds, u32 NumCmds)
+{
+	XAie_DevInst *DevInst = Flush->DevInst;
+	u32 *ColStart = Flush->ColStart;
+	u32 NumActive = 0U;
+
+	memset(ColStart, 0, ((u32)DevInst->NumCols + 1U) * sizeof(*ColStart));
+	for(u32 i = 0U; i < NumCmds; i++) {
+		u8 Col = _XAie_GetColfromRegOff(DevInst, Cmds[i].RegOff);
+
+		if(ColStart[Col + 1U]++ == 0U) {
+			NumActive++;
+		}
+	}
+
+	for(u32 Col = 0U; Col < DevInst->NumCols; Col++) {
+		ColStart[Col + 1U] += ColStart[Col];
+	}
+
+	/* Place the commands using the column starts as cursors */
+	for(u32 i = 0U; i < NumCmds; i++) {
+		u8 Col = _XAie_GetColfromRegOff(DevInst, Cmds[i].RegOff);
+
+		Flush->Sorted[ColStart[Col]++] = Cmds[i];
+	}
+
+	/* Cursors end at the start of the next column */
+	for(u32 Col = DevInst->NumCols; Col > 0U; Col--) {
+		ColStart[Col] = ColStart[Col - 1U];
+	}
+	ColStart[0U] = 0U;
+
+	return NumActive;
+}
+
+/*****************************************************************************/
+/**
+* This API executes a sorted section of a parallel flush with the workers of
+* the parallel flush pool.
+*
+* @param        Pool: Pointer to the parallel flush pool
+* @param        Flush: Pointer to the sorted section
+*
+* @return       XAIE_OK on success and error code on failure
+*
+* @note         Internal only. The calling thread owns the pool.
+*
+******************************************************************************/
+static AieRC _XAie_TxnFlushSection(XAie_TxnFlushPool *Pool,
+		XAie_TxnParallelFlush *Flush)
+{
+	Flush->NextCol = 0U;
+	Flush->RC = XAIE_OK;
+
+	pthread_mutex_lock(&Pool->Lock);
+	Pool->Flush = Flush;
+	Pool->NumBusy = Pool->NumWorkers;
+	Pool->Gen++;
+	pthread_cond_broadcast(&Pool->StartCond);
+	pthread_mutex_unlock(&Pool->Lock);
+
+	_XAie_TxnFlushColumns(Flush);
+
+	pthread_mutex_lock(&Pool->Lock);
+	while(Pool->NumBusy != 0U) {
+		pthread_cond_wait(&Pool->DoneCond, &Pool->Lock);
+	}
+	Pool->Flush = NULL;
+	pthread_mutex_unlock(&Pool->Lock);
+
+	return Flush->RC;
+}
+
+/*****************************************************************************/
+/**
+* This API executes the commands of a transaction instance split in per column
+* streams. The commands between two barriers are sorted by column and the
+* columns are executed concurrently by the workers of the parallel flush pool,
+* the barriers are executed alone in order.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and error code on failure
+*
+* @note         Internal only. Sections with less than
+*		XAIE_TXN_PARALLEL_MIN_CMDS commands or a single column are
+*		executed by the calling thread, as are the sections released
+*		while the pool is busy with another flush. Neither the pool
+*		nor the sort buffers are set up unless a section qualifies.
+*
+******************************************************************************/
+static AieRC _XAie_Txn_FlushParallel(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
+{
+	XAie_TxnParallelFlush Flush;
+	XAie_TxnFlushPool *Pool = NULL;
+	AieRC RC = XAIE_OK;
+	u8 Serial = 0U;
+	u32 i = 0U;
+
+	memset(&Flush, 0, sizeof(Flush));
+	Flush.DevInst = DevInst;
+	Flush.TxnInst = TxnInst;
+
+	while((i < TxnInst->NumCmds) && (RC == XAIE_OK)) {
+		u32 End = i + 1U;
+
+		if(_XAie_TxnIsColBarrier(DevInst, &TxnInst->CmdBuf[i])) {
+			while((End < TxnInst->NumCmds) &&
+					_XAie_TxnIsColBarrier(DevInst,
+						&TxnInst->CmdBuf[End])) {
+				End++;
+			}
+			RC = _XAie_TxnExecCmds(DevInst, TxnInst,
+					&TxnInst->CmdBuf[i], End - i);
+			i = End;
+			continue;
+		}
+
+		while((End < TxnInst->NumCmds) && !_XAie_TxnIsColBarrier(
+					DevInst, &TxnInst->CmdBuf[End])) {
+			End++;
+		}
+
+		if((Pool == NULL) && (Serial == 0U) &&
+				(End - i >= XAIE_TXN_PARALLEL_MIN_CMDS)) {
+			Flush.Sorted = (XAie_TxnCmd *)malloc(
+					TxnInst->NumCmds *
+					sizeof(*Flush.Sorted));
+			Flush.ColStart = (u32 *)malloc(
+					((u32)DevInst->NumCols + 1U) *
+					sizeof(*Flush.ColStart));
+			if((Flush.Sorted != NULL) && (Flush.ColStart != NULL)) {
+				Pool = _XAie_TxnFlushPoolGet(DevInst);
+			}
+			if(Pool == NULL) {
+				XAIE_WARN("Flushing serially\n");
+				Serial = 1U;
+			}
+		}
+
+		if((Pool == NULL) ||
+				(End - i < XAIE_TXN_PARALLEL_MIN_CMDS) ||
+				(Pool->NumWorkers == 0U) ||
+				(_XAie_TxnSortByCol(&Flush,
+					&TxnInst->CmdBuf[i], End - i) < 2U) ||
+				(pthread_mutex_trylock(&Pool->Owner) != 0)) {
+			RC = _XAie_TxnExecCmds(DevInst, TxnInst,
+					&TxnInst->CmdBuf[i], End - i);
+			i = End;
+			continue;
+		}
+
+		RC = _XAie_TxnFlushSection(Pool, &Flush);
+		pthread_mutex_unlock(&Pool->Owner);
+		i = End;
+	}
+
+	free(Flush.Sorted);
+	free(Flush.ColStart);
+
+	return RC;
+}
+#endif
+
+/*****************************************************************************/
+/**
+* This API executes all the commands in the command buffer and resets the number
+* of commands.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only. This API does not allocate, reallocate or free
+*		any buffer.
+*
+******************************************************************************/
+AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	AieRC RC;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	RC = _XAie_TxnOptimizeIfEnabled(DevInst, TxnInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	XAIE_DBG("Flushing %d commands from transaction buffer\n",
+			TxnInst->NumCmds);
+
+	/* Keep the order with pending asynchronous submissions */
+	_XAie_TxnAsyncDrain(DevInst);
+
+#ifdef __linux__
+	if((TxnInst->Flags & XAIE_TXN_PARALLEL_SUBMIT_MASK) &&
+			(DevInst->RegLocks != NULL) &&
+			(DevInst->RegLocks->NumShards > 1U) &&
+			(DevInst->NumCols > 1U)) {
+		return _XAie_Txn_FlushParallel(DevInst, TxnInst);
+	}
+#endif
+
+	if(Backend->Ops.SubmitTxn != NULL) {
+		return _XAie_Txn_SubmitToBackend(DevInst, TxnInst);
+	}
+
+	return _XAie_ExecuteCmds(DevInst, TxnInst->CmdBuf, TxnInst->NumCmds);
+}
+
+/*****************************************************************************/
+/**
+* This API executes all the commands in the command buffer and frees the
+* transaction instance unless it is exported to the user.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	AieRC RC;
+	u64 Tid = 0;
+	XAie_TxnInst *Inst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(TxnInst == NULL) {
+		Tid = Backend->Ops.GetTid();
+		Inst = _XAie_GetTxnInst(DevInst, Tid);
+		if(Inst == NULL) {
+			XAIE_ERROR("Failed to get the correct transaction "
+					"instance\n");
+			return XAIE_ERR;
+		}
+	} else {
+		if(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK) {
+			Inst = TxnInst;
+		} else {
+			XAIE_ERROR("Transaction instance was not exported.\n");
+			return XAIE_ERR;
+		}
+	}
+
+	RC =  _XAie_Txn_FlushCmdBuf(DevInst, Inst);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Flushing the buffer failed\n");
+		return RC;
+	}
+
+	/* Do not free resources if transaction is exported */
+	if(Inst->Flags & XAIE_TXN_INST_EXPORTED_MASK) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_RemoveTxnInstFromList(DevInst, Tid);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	_XAie_TxnInstFree(Inst);
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API copies a transaction instance with its commands, payloads and tags.
+*
+* @param        TmpInst: Pointer to the transaction instance to copy
+*
+* @return       Pointer to the copy on success and NULL on error.
+*
+* @note         Internal only. The copy is not added to the transaction list.
+*
+******************************************************************************/
+static XAie_TxnInst* _XAie_TxnInstCopy(const XAie_TxnInst *TmpInst)
+{
+	XAie_TxnInst *Inst;
+
+	Inst = (XAie_TxnInst *)malloc(sizeof(*Inst));
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to allocate memory for txn instance\n");
+		return NULL;
+	}
+
+	Inst->Chunks = NULL;
+	Inst->Shadow = NULL;
+	Inst->Tags = NULL;
+	Inst->NumTemplates = 0U;
+	Inst->CmdBuf = (XAie_TxnCmd *)calloc(TmpInst->NumCmds,
+			sizeof(*Inst->CmdBuf));
+	if(Inst->CmdBuf == NULL) {
+		XAIE_ERROR("Failed to allocate memory for command buffer\n");
+		free(Inst);
+		return NULL;
+	}
+
+	Inst->CmdBuf = (XAie_TxnCmd *)memcpy((void *)Inst->CmdBuf,
+			(void *)TmpInst->CmdBuf,
+			TmpInst->NumCmds * sizeof(*Inst->CmdBuf));
+
+	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
+		XAie_TxnCmd *TmpCmd = &TmpInst->CmdBuf[i];
+		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
+		u64 Size;
+		void *Buf;
+
+		if(TmpCmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			Size = sizeof(u32) * (u64)TmpCmd->Size;
+		} else if(TmpCmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+			Size = TmpCmd->Size;
+		} else {
+			continue;
+		}
+
+		Buf = _XAie_TxnPayloadAlloc(Inst, Size);
+		if(Buf == NULL) {
+			XAIE_ERROR("Failed to allocate memory to copy "
+					"command %d\n", i);
+			_XAie_TxnInstFree(Inst);
+			return NULL;
+		}
+
+		Cmd->DataPtr = (u64)(uintptr_t)memcpy(Buf,
+				(void *)(uintptr_t)TmpCmd->DataPtr, Size);
+	}
+
+	Inst->Tid = TmpInst->Tid;
+	Inst->Flags = TmpInst->Flags;
+	Inst->NextCustomOp = TmpInst->NextCustomOp;
+	Inst->NumCmds = TmpInst->NumCmds;
+	Inst->MaxCmds = TmpInst->NumCmds;
+	Inst->Node.Next = NULL;
+
+	if(_XAie_TxnTagsCopy(Inst, TmpInst) != XAIE_OK) {
+		_XAie_TxnInstFree(Inst);
+		return NULL;
+	}
+
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api copies an existing transaction instance and returns a copy of the
+* instance with all the commands for users to save the commands and use them
+* at a later point.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	Pointer to copy of transaction instance on success and NULL
+*		on error.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
+{
+	XAie_TxnInst *Inst, *TmpInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	TmpInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if(TmpInst == NULL) {
+		XAIE_ERROR("Failed to get the correct transaction instance "
+				"from internal list\n");
+		return NULL;
+	}
+
+	Inst = _XAie_TxnInstCopy(TmpInst);
+	if(Inst == NULL) {
+		return NULL;
+	}
+	Inst->Flags |= XAIE_TXN_INSTANCE_EXPORTED;
+
+	return Inst;
+}
+
+static inline void _XAie_CreateTxnHeader(XAie_DevInst *DevInst,
+		XAie_TxnHeader *Header)
 {
 	Header->Major = TransactionHeaderVersion_Major;
 	Header->Minor = TransactionHeaderVersion_Minor;
@@ -1049,304 +3709,913 @@ static inline void _XAie_CreateTxnHeader(XAie_DevInst *DevInst,
 			Header->NumRows, Header->NumMemTileRows);
 }
 
-static inline u8 _XAie_GetRowfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
-{
-	return RegOff &(u64)(~(ULONG_MAX << DevInst->DevProp.RowShift));
+/*
+ * Column and row bytes of the op headers of serialized transactions, as
+ * recorded by earlier versions of the driver: the column byte holds the row of
+ * the tile and the row byte the low byte of the offset within the tile.
+ */
+static inline u8 _XAie_TxnOpHdrRow(XAie_DevInst *DevInst, u64 RegOff)
+{
+	return RegOff &(u64)(~(ULONG_MAX << DevInst->DevProp.RowShift));
+}
+
+static inline u8 _XAie_TxnOpHdrCol(XAie_DevInst *DevInst, u64 RegOff)
+{
+	u64 Mask = (u64)(((1U << DevInst->DevProp.ColShift) - 1U) &
+			~((1U << DevInst->DevProp.RowShift) - 1U));
+
+	return (u8)((RegOff & Mask) >> (u64)(DevInst->DevProp.RowShift));
+}
+
+static inline void _XAie_AppendWrite32(XAie_DevInst *DevInst,
+		XAie_TxnCmd *Cmd, u8 *TxnPtr)
+{
+	XAie_Write32Hdr *Hdr = (XAie_Write32Hdr*)TxnPtr;
+	Hdr->RegOff = Cmd->RegOff;
+	Hdr->Value = Cmd->Value;
+	Hdr->Size = (u32)sizeof(*Hdr);
+	Hdr->OpHdr.Col = _XAie_TxnOpHdrCol(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Row = _XAie_TxnOpHdrRow(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Op = (u8)XAIE_IO_WRITE;
+}
+
+static inline void _XAie_AppendMaskWrite32(XAie_DevInst *DevInst,
+		XAie_TxnCmd *Cmd, u8 *TxnPtr)
+{
+	XAie_MaskWrite32Hdr *Hdr = (XAie_MaskWrite32Hdr*)TxnPtr;
+
+	Hdr->RegOff = Cmd->RegOff;
+	Hdr->Mask = Cmd->Mask;
+	Hdr->Value = Cmd->Value;
+	Hdr->Size = (u32)sizeof(*Hdr);
+	Hdr->OpHdr.Col = _XAie_TxnOpHdrCol(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Row = _XAie_TxnOpHdrRow(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Op = (u8)XAIE_IO_MASKWRITE;
+}
+
+static inline void _XAie_AppendMaskPoll32(XAie_DevInst *DevInst,
+		XAie_TxnCmd *Cmd, uint8_t *TxnPtr)
+{
+	XAie_MaskPoll32Hdr *Hdr = (XAie_MaskPoll32Hdr*)TxnPtr;
+
+	Hdr->RegOff = Cmd->RegOff;
+	Hdr->Mask = Cmd->Mask;
+	Hdr->Value = Cmd->Value;
+	Hdr->Size = (u32)sizeof(*Hdr);
+	Hdr->OpHdr.Col = _XAie_TxnOpHdrCol(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Row = _XAie_TxnOpHdrRow(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Op = (u8)XAIE_IO_MASKPOLL;
+}
+
+static inline void _XAie_AppendBlockWrite32(XAie_DevInst *DevInst,
+		XAie_TxnCmd *Cmd, u8 *TxnPtr)
+{
+	u8 *Payload = TxnPtr + sizeof(XAie_BlockWrite32Hdr);
+	XAie_BlockWrite32Hdr *Hdr = (XAie_BlockWrite32Hdr*)TxnPtr;
+
+	Hdr->RegOff = (u32)Cmd->RegOff;
+	Hdr->Size = (u32)sizeof(*Hdr) + Cmd->Size * (u32)sizeof(u32);
+	Hdr->OpHdr.Col = _XAie_TxnOpHdrCol(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Row = _XAie_TxnOpHdrRow(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Op = (u8)XAIE_IO_BLOCKWRITE;
+
+	memcpy((void *)Payload, (void *)(uintptr_t)Cmd->DataPtr,
+			Cmd->Size * sizeof(u32));
+}
+
+static inline void _XAie_AppendBlockSet32(XAie_DevInst *DevInst,
+		XAie_TxnCmd *Cmd, u8 *TxnPtr)
+{
+	u8 *Payload = TxnPtr + sizeof(XAie_BlockWrite32Hdr);
+	XAie_BlockWrite32Hdr *Hdr = (XAie_BlockWrite32Hdr*)TxnPtr;
+
+	Hdr->RegOff = (u32)Cmd->RegOff;
+	Hdr->Size = (u32)sizeof(*Hdr) + Cmd->Size * (u32)sizeof(u32);
+	Hdr->OpHdr.Col = _XAie_TxnOpHdrCol(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Row = _XAie_TxnOpHdrRow(DevInst,Cmd->RegOff);
+	Hdr->OpHdr.Op = (u8)XAIE_IO_BLOCKWRITE;
+
+	for (u32 i = 0U; i < Cmd->Size; i++) {
+		*((u32 *)Payload) = Cmd->Value;
+		Payload += 4;
+	}
+}
+
+static inline void _XAie_AppendCustomOp(XAie_TxnCmd *Cmd, u8 *TxnPtr)
+{
+	u8 *Payload = TxnPtr + sizeof(XAie_CustomOpHdr);
+	XAie_CustomOpHdr *Hdr = (XAie_CustomOpHdr*)TxnPtr;
+
+	Hdr->Size = (u32)sizeof(*Hdr) + Cmd->Size * (u32)sizeof(u8);
+	Hdr->OpHdr.Op = (u8)Cmd->Opcode;
+
+	for (u32 i = 0U; i < Cmd->Size; ++i, ++Payload) {
+		*(Payload) = *((u8*)(uintptr_t)Cmd->DataPtr + i);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API returns the size of the serialized record of a command.
+*
+* @param        Cmd: Pointer to the transaction command
+*
+* @return       Size of the record in bytes. 0 for commands that are not
+*		serialized.
+*
+* @note         Internal only. Block sets are serialized as block writes.
+*
+******************************************************************************/
+u64 _XAie_TxnCmdSerializedSize(const XAie_TxnCmd *Cmd)
+{
+	switch(Cmd->Opcode) {
+	case XAIE_IO_WRITE:
+		if(Cmd->Mask == 0U) {
+			return sizeof(XAie_Write32Hdr);
+		}
+		return sizeof(XAie_MaskWrite32Hdr);
+	case XAIE_IO_MASKPOLL:
+		return sizeof(XAie_MaskPoll32Hdr);
+	case XAIE_IO_BLOCKWRITE:
+	case XAIE_IO_BLOCKSET:
+		return sizeof(XAie_BlockWrite32Hdr) +
+			(u64)Cmd->Size * sizeof(u32);
+	default:
+		if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+			return sizeof(XAie_CustomOpHdr) + (u64)Cmd->Size;
+		}
+		return 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API resolves the transaction instance to serialize. If the optimizer is
+* enabled for the instance, an optimized copy is serialized, so that the
+* commands of the instance are left as recorded.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance or to NULL for the
+*		transaction of the calling thread. Set to the resolved
+*		instance.
+*
+* @return       Pointer to the instance to serialize on success, NULL on
+*		failure. Must be released with _XAie_TxnPutSerializeInst().
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static XAie_TxnInst* _XAie_TxnGetSerializeInst(XAie_DevInst *DevInst,
+		XAie_TxnInst **TxnInst)
+{
+	XAie_TxnInst *Inst;
+
+	if(*TxnInst == NULL) {
+		*TxnInst = _XAie_TxnGetCurrentInst(DevInst);
+		if(*TxnInst == NULL) {
+			XAIE_ERROR("Failed to get the correct transaction "
+					"instance from internal list\n");
+			return NULL;
+		}
+	}
+
+	if(!((*TxnInst)->Flags & XAIE_TXN_OPTIMIZE_MASK) ||
+			((*TxnInst)->NumCmds == 0U)) {
+		return *TxnInst;
+	}
+
+	Inst = _XAie_TxnInstCopy(*TxnInst);
+	if(Inst == NULL) {
+		return NULL;
+	}
+
+	if(_XAie_TxnOptimizeIfEnabled(DevInst, Inst) != XAIE_OK) {
+		_XAie_TxnInstFree(Inst);
+		return NULL;
+	}
+
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+* This API releases the instance returned by _XAie_TxnGetSerializeInst().
+*
+* @param        TxnInst: Pointer to the resolved transaction instance
+* @param        Inst: Pointer to the serialized instance
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnPutSerializeInst(XAie_TxnInst *TxnInst,
+		XAie_TxnInst *Inst)
+{
+	if(Inst != TxnInst) {
+		_XAie_TxnInstFree(Inst);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API computes the exact size of the serialized form of a transaction
+* instance.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Flags: XAIE_TRANSACTION_EXPORT_* flags
+* @param        Size: Pointer to return the size in bytes.
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note         Internal only. The size includes the transaction header and the
+*		padding to a multiple of 4 bytes.
+*
+******************************************************************************/
+static AieRC _XAie_TxnComputeSerializedSize(const XAie_TxnInst *TxnInst,
+		u32 Flags, u32 *Size)
+{
+	u64 BuffSize = sizeof(XAie_TxnHeader);
+	u32 NumRecs;
+
+	if(Flags & XAIE_TXN_EXPORT_COMPACT_MASK) {
+		BuffSize += _XAie_TxnCompactEncode(TxnInst, NULL, &NumRecs);
+	} else {
+		for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+			BuffSize += _XAie_TxnCmdSerializedSize(
+					&TxnInst->CmdBuf[i]);
+		}
+	}
+
+	BuffSize = (BuffSize + sizeof(u32) - 1U) & ~((u64)sizeof(u32) - 1U);
+	if(BuffSize > UINT32_MAX) {
+		XAIE_ERROR("Serialized transaction exceeds 4GB\n");
+		return XAIE_ERR;
+	}
+
+	*Size = (u32)BuffSize;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API serializes the commands of a transaction instance into a buffer of
+* the size computed by _XAie_TxnComputeSerializedSize().
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Flags: XAIE_TRANSACTION_EXPORT_* flags
+* @param        Buf: Pointer to the destination buffer
+* @param        Size: Serialized size of the transaction in bytes
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnSerializeCmds(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u32 Flags, u8 *Buf, u32 Size)
+{
+	XAie_TxnHeader *Header = (XAie_TxnHeader *)Buf;
+	u8 *TxnPtr = Buf + sizeof(XAie_TxnHeader);
+	u32 NumOps = 0U;
+
+	_XAie_CreateTxnHeader(DevInst, Header);
+	XAIE_DBG("number of cmd %d\n", TxnInst->NumCmds);
+
+	if(Flags & XAIE_TXN_EXPORT_COMPACT_MASK) {
+		Header->Major = TransactionHeaderVersion_Compact_Major;
+		Header->Minor = TransactionHeaderVersion_Compact_Minor;
+		TxnPtr += _XAie_TxnCompactEncode(TxnInst, TxnPtr, &NumOps);
+	} else {
+		for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+			XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+			u64 RecSize = _XAie_TxnCmdSerializedSize(Cmd);
+
+			if(RecSize == 0U) {
+				continue;
+			}
+
+			if(Cmd->Opcode == XAIE_IO_WRITE && Cmd->Mask == 0U) {
+				_XAie_AppendWrite32(DevInst, Cmd, TxnPtr);
+			} else if(Cmd->Opcode == XAIE_IO_WRITE) {
+				_XAie_AppendMaskWrite32(DevInst, Cmd, TxnPtr);
+			} else if(Cmd->Opcode == XAIE_IO_MASKPOLL) {
+				_XAie_AppendMaskPoll32(DevInst, Cmd, TxnPtr);
+			} else if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+				_XAie_AppendBlockWrite32(DevInst, Cmd, TxnPtr);
+			} else if(Cmd->Opcode == XAIE_IO_BLOCKSET) {
+				_XAie_AppendBlockSet32(DevInst, Cmd, TxnPtr);
+			} else {
+				if (TX_DUMP_ENABLE) {
+					TxnCmdDump(Cmd);
+				}
+				_XAie_AppendCustomOp(Cmd, TxnPtr);
+			}
+
+			TxnPtr += RecSize;
+			NumOps++;
+		}
+	}
+
+	/* Zero the padding to the 4 byte aligned size */
+	memset(TxnPtr, 0, (size_t)(Buf + Size - TxnPtr));
+
+	XAIE_DBG("Size of the Txn Hdr being exported: %u bytes\n",
+			sizeof(XAie_TxnHeader));
+	XAIE_DBG("Size of the transaction buffer being exported: %u bytes\n",
+			Size);
+	XAIE_DBG("Num of Operations in the transaction buffer: %u\n",
+			NumOps);
+
+	Header->NumOps = NumOps;
+	Header->TxnSize = Size;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api computes the exact size of the serialized form of a transaction.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnInst - Pointer to the transaction instance. If NULL, the
+*		transaction being recorded by the calling thread is used.
+* @param	Flags - XAIE_TRANSACTION_EXPORT_* flags.
+* @param	Size - Pointer to return the size in bytes.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnGetSerializedSize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u32 *Size)
+{
+	XAie_TxnInst *Inst;
+	AieRC RC;
+
+	Inst = _XAie_TxnGetSerializeInst(DevInst, &TxnInst);
+	if(Inst == NULL) {
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_TxnComputeSerializedSize(Inst, Flags, Size);
+	_XAie_TxnPutSerializeInst(TxnInst, Inst);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api serializes a transaction into a buffer. The buffer must be at least
+* of the size returned by _XAie_TxnGetSerializedSize().
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnInst - Pointer to the transaction instance. If NULL, the
+*		transaction being recorded by the calling thread is used.
+* @param	Flags - XAIE_TRANSACTION_EXPORT_* flags.
+* @param	Buf - Pointer to the destination buffer.
+* @param	BufSize - Size of the destination buffer in bytes.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if the buffer
+*		is too small and error code on other failures.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnSerialize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u8 *Buf, u32 BufSize)
+{
+	XAie_TxnInst *Inst;
+	u32 Size;
+	AieRC RC;
+
+	Inst = _XAie_TxnGetSerializeInst(DevInst, &TxnInst);
+	if(Inst == NULL) {
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_TxnComputeSerializedSize(Inst, Flags, &Size);
+	if(RC == XAIE_OK) {
+		if(BufSize < Size) {
+			XAIE_ERROR("Buffer of %u bytes is too small, %u bytes "
+					"are required\n", BufSize, Size);
+			RC = XAIE_INSUFFICIENT_BUFFER_SIZE;
+		} else {
+			_XAie_TxnSerializeCmds(DevInst, Inst, Flags, Buf,
+					Size);
+		}
+	}
+	_XAie_TxnPutSerializeInst(TxnInst, Inst);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api serializes a transaction into a newly allocated buffer of the exact
+* size of the serialized transaction. The size and the contents come from the
+* same optimized copy of the transaction.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnInst - Pointer to the transaction instance. If NULL, the
+*		transaction being recorded by the calling thread is used.
+* @param	Flags - XAIE_TRANSACTION_EXPORT_* flags.
+* @param	MaxSize - Maximum size of the serialized transaction in bytes.
+* @param	Buf - Pointer to return the buffer allocated with malloc().
+* @param	Size - Pointer to return the size of the transaction in bytes.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if the
+*		transaction is larger than MaxSize and error code on other
+*		failures.
+*
+* @note		Internal only. Size is set when XAIE_INSUFFICIENT_BUFFER_SIZE
+*		is returned.
+*
+******************************************************************************/
+AieRC _XAie_TxnSerializeAlloc(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u64 MaxSize, u8 **Buf, u32 *Size)
+{
+	XAie_TxnInst *Inst;
+	AieRC RC;
+
+	Inst = _XAie_TxnGetSerializeInst(DevInst, &TxnInst);
+	if(Inst == NULL) {
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_TxnComputeSerializedSize(Inst, Flags, Size);
+	if((RC == XAIE_OK) && (*Size > MaxSize)) {
+		RC = XAIE_INSUFFICIENT_BUFFER_SIZE;
+	}
+
+	if(RC == XAIE_OK) {
+		*Buf = (u8 *)malloc(*Size);
+		if(*Buf == NULL) {
+			XAIE_ERROR("Malloc failed\n");
+			RC = XAIE_ERR;
+		} else {
+			_XAie_TxnSerializeCmds(DevInst, Inst, Flags, *Buf,
+					*Size);
+		}
+	}
+	_XAie_TxnPutSerializeInst(TxnInst, Inst);
+
+	return RC;
 }
 
-static inline u8 _XAie_GetColfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
+/*****************************************************************************/
+/**
+*
+* This api serializes the transaction of the calling thread into a newly
+* allocated buffer of the exact size of the serialized transaction.
+*
+* @param	DevInst - Device instance pointer.
+* @param	NumConsumers - Number of consumers for the generated
+*		transactions (Unused for now)
+* @param	Flags - XAIE_TRANSACTION_EXPORT_* flags.
+*
+* @return	Pointer to the serialized transaction on success and NULL on
+*		error.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u8* _XAie_TxnExportSerialized(XAie_DevInst *DevInst, u8 NumConsumers,
+		u32 Flags)
 {
-	u64 Mask = (u64)(((1U << DevInst->DevProp.ColShift) - 1U) &
-			~((1U << DevInst->DevProp.RowShift) - 1U));
+	u8 *TxnPtr;
+	u32 Size;
+	(void)NumConsumers;
 
-	return (u8)((RegOff & Mask) >> (u64)(DevInst->DevProp.RowShift));
-}
+	if(_XAie_TxnSerializeAlloc(DevInst, NULL, Flags, UINT32_MAX, &TxnPtr,
+				&Size) != XAIE_OK) {
+		return NULL;
+	}
 
-static inline void _XAie_AppendWrite32(XAie_DevInst *DevInst,
-		XAie_TxnCmd *Cmd, u8 *TxnPtr)
-{
-	XAie_Write32Hdr *Hdr = (XAie_Write32Hdr*)TxnPtr;
-	Hdr->RegOff = Cmd->RegOff;
-	Hdr->Value = Cmd->Value;
-	Hdr->Size = (u32)sizeof(*Hdr);
-	Hdr->OpHdr.Col = _XAie_GetColfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Row = _XAie_GetRowfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Op = (u8)XAIE_IO_WRITE;
+	return TxnPtr;
 }
 
-static inline void _XAie_AppendMaskWrite32(XAie_DevInst *DevInst,
-		XAie_TxnCmd *Cmd, u8 *TxnPtr)
+void _XAie_FreeTxnPtr(void *Ptr)
 {
-	XAie_MaskWrite32Hdr *Hdr = (XAie_MaskWrite32Hdr*)TxnPtr;
-
-	Hdr->RegOff = Cmd->RegOff;
-	Hdr->Mask = Cmd->Mask;
-	Hdr->Value = Cmd->Value;
-	Hdr->Size = (u32)sizeof(*Hdr);
-	Hdr->OpHdr.Col = _XAie_GetColfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Row = _XAie_GetRowfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Op = (u8)XAIE_IO_MASKWRITE;
+	free(Ptr);
 }
 
-static inline void _XAie_AppendMaskPoll32(XAie_DevInst *DevInst,
-		XAie_TxnCmd *Cmd, uint8_t *TxnPtr)
+/*****************************************************************************/
+/**
+*
+* This api checks if a serialized transaction uses the compact format.
+*
+* @param	Header - Pointer to the transaction header.
+*
+* @return	XAIE_ENABLE for the compact format, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_TxnIsCompact(const XAie_TxnHeader *Header)
 {
-	XAie_MaskPoll32Hdr *Hdr = (XAie_MaskPoll32Hdr*)TxnPtr;
-
-	Hdr->RegOff = Cmd->RegOff;
-	Hdr->Mask = Cmd->Mask;
-	Hdr->Value = Cmd->Value;
-	Hdr->Size = (u32)sizeof(*Hdr);
-	Hdr->OpHdr.Col = _XAie_GetColfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Row = _XAie_GetRowfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Op = (u8)XAIE_IO_MASKPOLL;
+	return (Header->Major == TransactionHeaderVersion_Compact_Major) &&
+		(Header->Minor == TransactionHeaderVersion_Compact_Minor);
 }
 
-static inline void _XAie_AppendBlockWrite32(XAie_DevInst *DevInst,
-		XAie_TxnCmd *Cmd, u8 *TxnPtr)
+/*****************************************************************************/
+/**
+*
+* This api validates the header of a serialized transaction against the device
+* instance it is going to be replayed on.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnPtr - Pointer to the serialized transaction.
+* @param	Size - Size of the buffer pointed by TxnPtr in bytes.
+* @param	Header - Pointer to return a copy of the header.
+*
+* @return	XAIE_OK on success or error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnValidateHeader(XAie_DevInst *DevInst, const u8 *TxnPtr,
+		u32 Size, XAie_TxnHeader *Header)
 {
-	u8 *Payload = TxnPtr + sizeof(XAie_BlockWrite32Hdr);
-	XAie_BlockWrite32Hdr *Hdr = (XAie_BlockWrite32Hdr*)TxnPtr;
+	if(Size < sizeof(*Header)) {
+		XAIE_ERROR("Serialized transaction is too small\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-	Hdr->RegOff = (u32)Cmd->RegOff;
-	Hdr->Size = (u32)sizeof(*Hdr) + Cmd->Size * (u32)sizeof(u32);
-	Hdr->OpHdr.Col = _XAie_GetColfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Row = _XAie_GetRowfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Op = (u8)XAIE_IO_BLOCKWRITE;
+	memcpy((void *)Header, (const void *)TxnPtr, sizeof(*Header));
 
-	memcpy((void *)Payload, (void *)(uintptr_t)Cmd->DataPtr,
-			Cmd->Size * sizeof(u32));
-}
+	if(((Header->Major != TransactionHeaderVersion_Major) ||
+			(Header->Minor != TransactionHeaderVersion_Minor)) &&
+			!_XAie_TxnIsCompact(Header)) {
+		XAIE_ERROR("Unsupported transaction header version %d.%d\n",
+				Header->Major, Header->Minor);
+		return XAIE_INVALID_ARGS;
+	}
 
-static inline void _XAie_AppendBlockSet32(XAie_DevInst *DevInst,
-		XAie_TxnCmd *Cmd, u8 *TxnPtr)
-{
-	u8 *Payload = TxnPtr + sizeof(XAie_BlockWrite32Hdr);
-	XAie_BlockWrite32Hdr *Hdr = (XAie_BlockWrite32Hdr*)TxnPtr;
+	if((Header->DevGen != DevInst->DevProp.DevGen) ||
+			(Header->NumRows != DevInst->NumRows) ||
+			(Header->NumCols > DevInst->NumCols) ||
+			(Header->NumMemTileRows != DevInst->MemTileNumRows)) {
+		XAIE_ERROR("Transaction was generated for a different device. "
+				"DevGen %d, Cols, Rows, MemTile rows : "
+				"(%d, %d, %d)\n", Header->DevGen,
+				Header->NumCols, Header->NumRows,
+				Header->NumMemTileRows);
+		return XAIE_INVALID_DEVICE;
+	}
 
-	Hdr->RegOff = (u32)Cmd->RegOff;
-	Hdr->Size = (u32)sizeof(*Hdr) + Cmd->Size * (u32)sizeof(u32);
-	Hdr->OpHdr.Col = _XAie_GetColfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Row = _XAie_GetRowfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Op = (u8)XAIE_IO_BLOCKWRITE;
+	if((Header->TxnSize < sizeof(*Header)) || (Header->TxnSize > Size)) {
+		XAIE_ERROR("Invalid transaction size %u, buffer size %u\n",
+				Header->TxnSize, Size);
+		return XAIE_INVALID_ARGS;
+	}
 
-	for (u32 i = 0U; i < Cmd->Size; i++) {
-		*((u32 *)Payload) = Cmd->Value;
-		Payload += 4;
+	/* Every record takes at least one byte */
+	if(Header->NumOps > Header->TxnSize - sizeof(*Header)) {
+		XAIE_ERROR("Transaction of %u bytes cannot hold %u records\n",
+				Header->TxnSize, Header->NumOps);
+		return XAIE_INVALID_ARGS;
 	}
+
+	return XAIE_OK;
 }
 
-static inline void _XAie_AppendCustomOp(XAie_TxnCmd *Cmd, u8 *TxnPtr)
+/*****************************************************************************/
+/**
+*
+* This api decodes one record of a serialized transaction into a transaction
+* command. Payloads are not copied, the DataPtr of the command points to the
+* payload within the serialized transaction.
+*
+* @param	TxnPtr - Pointer to the record.
+* @param	Remaining - Number of bytes left in the serialized transaction.
+* @param	Cmd - Pointer to the command to be populated.
+* @param	RecSize - Pointer to return the size of the record in bytes.
+*
+* @return	XAIE_OK on success or error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnDecodeRecord(const u8 *TxnPtr, u32 Remaining,
+		XAie_TxnCmd *Cmd, u32 *RecSize)
 {
-	u8 *Payload = TxnPtr + sizeof(XAie_CustomOpHdr);
-	XAie_CustomOpHdr *Hdr = (XAie_CustomOpHdr*)TxnPtr;
+	XAie_OpHdr OpHdr;
+	u32 HdrSize;
 
-	Hdr->Size = (u32)sizeof(*Hdr) + Cmd->Size * (u32)sizeof(u8);
-	Hdr->OpHdr.Op = (u8)Cmd->Opcode;
+	if(Remaining < sizeof(OpHdr)) {
+		XAIE_ERROR("Truncated transaction record\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-	for (u32 i = 0U; i < Cmd->Size; ++i, ++Payload) {
-		*(Payload) = *((u8*)(uintptr_t)Cmd->DataPtr + i);
+	memcpy((void *)&OpHdr, (const void *)TxnPtr, sizeof(OpHdr));
+	memset((void *)Cmd, 0, sizeof(*Cmd));
+
+	if(OpHdr.Op >= (u8)XAIE_IO_CUSTOM_OP_BEGIN) {
+		XAie_CustomOpHdr Hdr;
+
+		HdrSize = (u32)sizeof(Hdr);
+		if(Remaining < HdrSize) {
+			XAIE_ERROR("Truncated transaction record\n");
+			return XAIE_INVALID_ARGS;
+		}
+		memcpy((void *)&Hdr, (const void *)TxnPtr, HdrSize);
+		*RecSize = Hdr.Size;
+		Cmd->Opcode = (XAie_TxnOpcode)OpHdr.Op;
+		Cmd->Size = Hdr.Size - HdrSize;
+		Cmd->DataPtr = (u64)(uintptr_t)(TxnPtr + HdrSize);
+	} else {
+		switch(OpHdr.Op) {
+		case XAIE_IO_WRITE:
+		{
+			XAie_Write32Hdr Hdr;
+
+			HdrSize = (u32)sizeof(Hdr);
+			if(Remaining < HdrSize) {
+				break;
+			}
+			memcpy((void *)&Hdr, (const void *)TxnPtr, HdrSize);
+			*RecSize = Hdr.Size;
+			Cmd->Opcode = XAIE_IO_WRITE;
+			Cmd->RegOff = Hdr.RegOff;
+			Cmd->Value = Hdr.Value;
+			break;
+		}
+		case XAIE_IO_MASKWRITE:
+		{
+			XAie_MaskWrite32Hdr Hdr;
+
+			HdrSize = (u32)sizeof(Hdr);
+			if(Remaining < HdrSize) {
+				break;
+			}
+			memcpy((void *)&Hdr, (const void *)TxnPtr, HdrSize);
+			*RecSize = Hdr.Size;
+			/* Masked writes are recorded as writes with a mask */
+			Cmd->Opcode = XAIE_IO_WRITE;
+			Cmd->RegOff = Hdr.RegOff;
+			Cmd->Value = Hdr.Value;
+			Cmd->Mask = Hdr.Mask;
+			break;
+		}
+		case XAIE_IO_MASKPOLL:
+		{
+			XAie_MaskPoll32Hdr Hdr;
+
+			HdrSize = (u32)sizeof(Hdr);
+			if(Remaining < HdrSize) {
+				break;
+			}
+			memcpy((void *)&Hdr, (const void *)TxnPtr, HdrSize);
+			*RecSize = Hdr.Size;
+			Cmd->Opcode = XAIE_IO_MASKPOLL;
+			Cmd->RegOff = Hdr.RegOff;
+			Cmd->Value = Hdr.Value;
+			Cmd->Mask = Hdr.Mask;
+			break;
+		}
+		case XAIE_IO_BLOCKWRITE:
+		{
+			XAie_BlockWrite32Hdr Hdr;
+
+			HdrSize = (u32)sizeof(Hdr);
+			if(Remaining < HdrSize) {
+				break;
+			}
+			memcpy((void *)&Hdr, (const void *)TxnPtr, HdrSize);
+			*RecSize = Hdr.Size;
+			Cmd->Opcode = XAIE_IO_BLOCKWRITE;
+			Cmd->RegOff = Hdr.RegOff;
+			Cmd->Size = (Hdr.Size - HdrSize) / (u32)sizeof(u32);
+			Cmd->DataPtr = (u64)(uintptr_t)(TxnPtr + HdrSize);
+			if(((Hdr.Size - HdrSize) % sizeof(u32)) != 0U) {
+				XAIE_ERROR("Invalid block write record "
+						"size %u\n", Hdr.Size);
+				return XAIE_INVALID_ARGS;
+			}
+			break;
+		}
+		default:
+			XAIE_ERROR("Invalid transaction opcode %d\n",
+					OpHdr.Op);
+			return XAIE_INVALID_ARGS;
+		}
+
+		if(Remaining < HdrSize) {
+			XAIE_ERROR("Truncated transaction record\n");
+			return XAIE_INVALID_ARGS;
+		}
 	}
-}
 
-static u8* _XAie_ReallocTxnBuf(u8 *TxnPtr, u32 NewSize)
-{
-	u8 *Tmp;
-	Tmp =  (u8*)realloc((void*)TxnPtr, NewSize);
-	if(Tmp == NULL) {
-		XAIE_ERROR("Reallocation failed for txn buffer\n");
-		return NULL;
+	if((*RecSize < HdrSize) || (*RecSize > Remaining)) {
+		XAIE_ERROR("Invalid transaction record size %u\n", *RecSize);
+		return XAIE_INVALID_ARGS;
 	}
 
-	return Tmp;
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
 *
-* This api copies an existing transaction instance and returns a copy of the
-* instance with all the commands for users to save the commands and use them
-* at a later point.
+* This api decodes a serialized transaction into a new transaction instance.
+* The returned instance is marked as exported, it can be submitted any number
+* of times with XAie_SubmitTransaction() and must be released with
+* XAie_FreeTransactionInstance().
 *
 * @param	DevInst - Device instance pointer.
-* @param	NumConsumers - Number of consumers for the generated
-*		transactions (Unused for now)
-* @param	Flags - Flags (Unused for now)
+* @param	TxnPtr - Pointer to the serialized transaction.
+* @param	Size - Size of the buffer pointed by TxnPtr in bytes.
 *
-* @return	Pointer to copy of transaction instance on success and NULL
-*		on error.
+* @return	Pointer to transaction instance on success and NULL on error.
 *
 * @note		Internal only.
 *
 ******************************************************************************/
-u8* _XAie_TxnExportSerialized(XAie_DevInst *DevInst, u8 NumConsumers,
-		u32 Flags)
+XAie_TxnInst* _XAie_TxnImportSerialized(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size)
 {
 	const XAie_Backend *Backend = DevInst->Backend;
-	XAie_TxnInst *TmpInst;
-	u8 *TxnPtr;
-	u32 BuffSize = 0U, NumOps = 0;
-	u32 AllocatedBuffSize = XAIE_DEFAULT_TXN_BUFFER_SIZE;
-	(void)NumConsumers;
-	(void)Flags;
+	XAie_TxnHeader Header;
+	XAie_TxnInst *Inst;
+	u32 Offset = (u32)sizeof(Header);
+	AieRC RC;
 
-	TmpInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
-	if(TmpInst == NULL) {
-		XAIE_ERROR("Failed to get the correct transaction instance "
-				"from internal list\n");
+	RC = _XAie_TxnValidateHeader(DevInst, TxnPtr, Size, &Header);
+	if(RC != XAIE_OK) {
 		return NULL;
 	}
 
-	TxnPtr = malloc(AllocatedBuffSize);
-	if(TxnPtr == NULL) {
-		XAIE_ERROR("Malloc failed\n");
+	Inst = (XAie_TxnInst *)malloc(sizeof(*Inst));
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to allocate memory for txn instance\n");
 		return NULL;
 	}
 
-	_XAie_CreateTxnHeader(DevInst, (XAie_TxnHeader *)TxnPtr);
-	BuffSize += (u32)sizeof(XAie_TxnHeader);
-	TxnPtr += sizeof(XAie_TxnHeader);
-	XAIE_DBG("number of cmd %d\n", TmpInst->NumCmds);
+	Inst->Chunks = NULL;
+	Inst->Shadow = NULL;
+	Inst->Tags = NULL;
+	Inst->NumTemplates = 0U;
+	Inst->MaxCmds = (Header.NumOps > 0U) ? Header.NumOps : 1U;
+	Inst->CmdBuf = (XAie_TxnCmd *)calloc(Inst->MaxCmds,
+			sizeof(*Inst->CmdBuf));
+	if(Inst->CmdBuf == NULL) {
+		XAIE_ERROR("Failed to allocate memory for command buffer\n");
+		free(Inst);
+		return NULL;
+	}
 
-	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
-		NumOps++;
-		XAie_TxnCmd *Cmd = &TmpInst->CmdBuf[i];
-		if ((Cmd->Opcode == XAIE_IO_WRITE) && (Cmd->Mask == 0U)) {
-			if((BuffSize + sizeof(XAie_Write32Hdr)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2U);
-				if(TxnPtr == NULL){
-					return NULL;
-				}
-				AllocatedBuffSize *= 2U;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendWrite32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_Write32Hdr);
-			BuffSize += (u32)sizeof(XAie_Write32Hdr);
-			continue;
-		}
-		if ((Cmd->Opcode == XAIE_IO_WRITE) && ((Cmd->Mask)!=0U)) {
-			if((BuffSize + sizeof(XAie_MaskWrite32Hdr)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2U);
-				if(TxnPtr == NULL) {
-					return NULL;
-				}
-				AllocatedBuffSize *= 2U;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendMaskWrite32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_MaskWrite32Hdr);
-			BuffSize += (u32)sizeof(XAie_MaskWrite32Hdr);
-			continue;
+	Inst->NumCmds = 0U;
+	Inst->Tid = Backend->Ops.GetTid();
+	Inst->Flags = XAIE_TXN_INSTANCE_EXPORTED;
+	Inst->NextCustomOp = (u8)XAIE_IO_CUSTOM_OP_NEXT;
+	Inst->Node.Next = NULL;
+
+	if(_XAie_TxnIsCompact(&Header)) {
+		RC = _XAie_TxnCompactDecode(Inst, TxnPtr + Offset,
+				Header.TxnSize - Offset, Header.NumOps);
+		if(RC != XAIE_OK) {
+			_XAie_TxnInstFree(Inst);
+			return NULL;
 		}
-		if (Cmd->Opcode == XAIE_IO_MASKPOLL) {
-			if((BuffSize + sizeof(XAie_MaskPoll32Hdr)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2U);
-				if(TxnPtr == NULL) {
-					return NULL;
-				}
-				AllocatedBuffSize *= 2U;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendMaskPoll32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_MaskPoll32Hdr);
-			BuffSize += (u32)sizeof(XAie_MaskPoll32Hdr);
-			continue;
+
+		return Inst;
+	}
+
+	while((Inst->NumCmds < Header.NumOps) && (Offset < Header.TxnSize)) {
+		XAie_TxnCmd *Cmd = &Inst->CmdBuf[Inst->NumCmds];
+		u64 PayloadSize = 0U;
+		u32 RecSize;
+		void *Buf;
+
+		RC = _XAie_TxnDecodeRecord(TxnPtr + Offset,
+				Header.TxnSize - Offset, Cmd, &RecSize);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to decode record %u\n",
+					Inst->NumCmds);
+			_XAie_TxnInstFree(Inst);
+			return NULL;
 		}
-		if (Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
-			if((BuffSize + sizeof(XAie_BlockWrite32Hdr) +
-						Cmd->Size * sizeof(u32)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2U);
-				if(TxnPtr == NULL) {
-					return NULL;
-				}
-				AllocatedBuffSize *= 2U;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendBlockWrite32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * sizeof(u32);
-			BuffSize += (u32)sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * (u32)sizeof(u32);
-			continue;
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			PayloadSize = sizeof(u32) * (u64)Cmd->Size;
+		} else if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+			PayloadSize = Cmd->Size;
 		}
-		if (Cmd->Opcode == XAIE_IO_BLOCKSET) {
-			/*
-			 * Blockset gets converted to blockwrite. so check for
-			 * blockwrite size
-			 */
-			if((BuffSize + sizeof(XAie_BlockWrite32Hdr) +
-						Cmd->Size * sizeof(u32)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2U);
-				if(TxnPtr == NULL) {
-					return NULL;
-				}
-				AllocatedBuffSize *= 2U;
-				TxnPtr += BuffSize;
+
+		if(PayloadSize != 0U) {
+			Buf = _XAie_TxnPayloadAlloc(Inst, PayloadSize);
+			if(Buf == NULL) {
+				_XAie_TxnInstFree(Inst);
+				return NULL;
 			}
-			_XAie_AppendBlockSet32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * sizeof(u32);
-			BuffSize += (u32)sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * (u32)sizeof(u32);
-			continue;
+
+			Cmd->DataPtr = (u64)(uintptr_t)memcpy(Buf,
+					(const void *)(uintptr_t)Cmd->DataPtr,
+					PayloadSize);
 		}
-		if (Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
-			if (TX_DUMP_ENABLE) {
-				TxnCmdDump(Cmd);
-			}
 
-			XAIE_DBG("Size of the CustomOp Hdr being exported: %u bytes\n", sizeof(XAie_CustomOpHdr));
+		Inst->NumCmds++;
+		Offset += RecSize;
+	}
 
-			if((BuffSize + sizeof(XAie_CustomOpHdr) +
-						Cmd->Size) > AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2U);
-				if(TxnPtr == NULL) {
-					return NULL;
-				}
-				AllocatedBuffSize *= 2U;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendCustomOp(Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_CustomOpHdr) +
-				Cmd->Size * sizeof(u8);
-			BuffSize += (u32)sizeof(XAie_CustomOpHdr) +
-				Cmd->Size * (u32)sizeof(u8);
-			continue;
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api replays a serialized transaction on the device instance. If the
+* backend can submit a whole transaction at once, the serialized transaction is
+* decoded into a temporary instance and submitted. Otherwise the records are
+* executed one by one as they are decoded, without copying the payloads.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnPtr - Pointer to the serialized transaction.
+* @param	Size - Size of the buffer pointed by TxnPtr in bytes.
+*
+* @return	XAIE_OK on success or error code on failure.
+*
+* @note		Internal only. The records are executed directly on the
+*		backend, they are not added to a transaction started by the
+*		calling thread.
+*
+******************************************************************************/
+AieRC _XAie_TxnSubmitSerialized(XAie_DevInst *DevInst, const u8 *TxnPtr,
+		u32 Size)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+	XAie_TxnHeader Header;
+	u32 Offset = (u32)sizeof(Header);
+	u32 *AlignedBuf = NULL;
+	u32 AlignedSize = 0U;
+	AieRC RC;
+
+	RC = _XAie_TxnValidateHeader(DevInst, TxnPtr, Size, &Header);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if((Backend->Ops.SubmitTxn != NULL) || _XAie_TxnIsCompact(&Header)) {
+		XAie_TxnInst *Inst;
+
+		Inst = _XAie_TxnImportSerialized(DevInst, TxnPtr, Size);
+		if(Inst == NULL) {
+			return XAIE_ERR;
 		}
+
+		RC = _XAie_Txn_FlushCmdBuf(DevInst, Inst);
+		_XAie_TxnInstFree(Inst);
+		return RC;
 	}
 
-	BuffSize = ((BuffSize % 4U) != 0U) ? (BuffSize / 4U + 1U) : BuffSize;
-	XAIE_DBG("Size of the Txn Hdr being exported: %u bytes\n",
-			sizeof(XAie_TxnHeader));
-	XAIE_DBG("Size of the transaction buffer being exported: %u bytes\n",
-			BuffSize);
-	XAIE_DBG("Num of Operations in the transaction buffer: %u\n",
-			TmpInst->NumCmds);
+	_XAie_TxnAsyncDrain(DevInst);
+	for(u32 i = 0U; (i < Header.NumOps) && (Offset < Header.TxnSize); i++) {
+		XAie_TxnCmd Cmd;
+		u32 RecSize;
 
+		RC = _XAie_TxnDecodeRecord(TxnPtr + Offset,
+				Header.TxnSize - Offset, &Cmd, &RecSize);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to decode record %u\n", i);
+			break;
+		}
+
+		/* Block write payloads are passed to the backend as words */
+		if((Cmd.Opcode == XAIE_IO_BLOCKWRITE) &&
+				((Cmd.DataPtr % sizeof(u32)) != 0U)) {
+			if(Cmd.Size > AlignedSize) {
+				u32 *Tmp = (u32 *)realloc((void *)AlignedBuf,
+						sizeof(u32) * (u64)Cmd.Size);
+				if(Tmp == NULL) {
+					XAIE_ERROR("Failed to allocate memory "
+							"for block write\n");
+					RC = XAIE_ERR;
+					break;
+				}
+				AlignedBuf = Tmp;
+				AlignedSize = Cmd.Size;
+			}
+
+			memcpy((void *)AlignedBuf,
+					(const void *)(uintptr_t)Cmd.DataPtr,
+					sizeof(u32) * (u64)Cmd.Size);
+			Cmd.DataPtr = (u64)(uintptr_t)AlignedBuf;
+		}
 
-	/* Adjust pointer and reallocate to the right size */
-	TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize, BuffSize);
-	((XAie_TxnHeader *)TxnPtr)->NumOps =  NumOps;
-	((XAie_TxnHeader *)TxnPtr)->TxnSize =  BuffSize;
+		RC = _XAie_ExecuteCmd(DevInst, &Cmd);
+		if(RC != XAIE_OK) {
+			break;
+		}
 
-	return (u8 *)TxnPtr;
-}
+		Offset += RecSize;
+	}
 
-void _XAie_FreeTxnPtr(void *Ptr)
-{
-	free(Ptr);
+	free(AlignedBuf);
+	return RC;
 }
 
 /*****************************************************************************/
@@ -1369,16 +4638,7 @@ AieRC _XAie_TxnFree(XAie_TxnInst *Inst)
 		return XAIE_ERR;
 	}
 
-	for(u32 i = 0; i < Inst->NumCmds; i++) {
-		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if((Cmd->Opcode == XAIE_IO_BLOCKWRITE || Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) &&
-				((void *)(uintptr_t)Cmd->DataPtr != NULL)) {
-			free((void *)(uintptr_t)Cmd->DataPtr);
-		}
-	}
-
-	free(Inst->CmdBuf);
-	free(Inst);
+	_XAie_TxnInstFree(Inst);
 
 	return XAIE_OK;
 }
@@ -1397,29 +4657,177 @@ AieRC _XAie_TxnFree(XAie_TxnInst *Inst)
 ******************************************************************************/
 void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
+	XAie_List *NodePtr;
 	XAie_TxnInst *TxnInst;
 
+	_XAie_MutexLock(DevInst->TxnListLock);
+	NodePtr = DevInst->TxnList.Next;
+	DevInst->TxnList.Next = NULL;
+	_XAie_TxnListNextGen(DevInst);
+	_XAie_MutexUnlock(DevInst->TxnListLock);
+
 	while(NodePtr != NULL) {
 		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, Node);
+		NodePtr = NodePtr->Next;
+		_XAie_TxnInstFree(TxnInst);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API reads a register while the calling thread has pending commands in a
+* transaction without auto flush. Bits written by the pending commands are
+* served from the shadow of the transaction. Other bits of configuration
+* registers, which only change through the recorded writes, are read from the
+* hardware without flushing. Reads of other registers flush the pending
+* commands first, unless the transaction defers reads, in which case the
+* hardware value is returned and recorded as a mask poll so that the
+* transaction waits for the value the caller observed when it is executed.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Register offset
+* @param        Data: Pointer to store the value
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnRead32(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u64 RegOff, u32 *Data)
+{
+	XAie_TxnCmd *Cmd;
+	u32 Value, Known, HwVal;
+	u8 Opaque;
+	AieRC RC;
+
+	RC = _XAie_TxnShadowRead(TxnInst, RegOff, &Value, &Known, &Opaque);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Known == XAIE_TXN_REG_FULL_MASK) {
+		*Data = Value;
+		return XAIE_OK;
+	}
+
+	if((Opaque == XAIE_DISABLE) &&
+			(_XAie_GetRegClass(DevInst, RegOff) !=
+			 XAIE_REG_CLASS_OTHER)) {
+		RC = _XAie_IORead32(DevInst, RegOff, &HwVal);
+		*Data = (HwVal & ~Known) | (Value & Known);
+		return RC;
+	}
+
+	if((TxnInst->Flags & XAIE_TXN_DEFER_READS_MASK) != 0U) {
+		RC = _XAie_IORead32(DevInst, RegOff, &HwVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		Cmd = _XAie_TxnAllocCmd(TxnInst);
+		if(Cmd == NULL) {
+			return XAIE_ERR;
+		}
+		Cmd->Opcode = XAIE_IO_MASKPOLL;
+		Cmd->RegOff = RegOff;
+		Cmd->Mask = ~Known;
+		Cmd->Value = HwVal & ~Known;
+
+		*Data = (HwVal & ~Known) | (Value & Known);
+		return XAIE_OK;
+	}
+
+	XAIE_DBG("Flushing %d pending commands to read register 0x%lx\n",
+			TxnInst->NumCmds, RegOff);
+	RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to flush cmd buffer\n");
+		return RC;
+	}
+	_XAie_Txn_ResetCmdBuf(TxnInst);
+
+	return _XAie_IORead32(DevInst, RegOff, Data);
+}
+
+/*****************************************************************************/
+/**
+* This API reads a block of registers while the calling thread has pending
+* commands in a transaction without auto flush. If every word can be served as
+* with _XAie_TxnRead32() without flushing, the block is read with one backend
+* block read and the bits written by the pending commands are taken from the
+* shadow of the transaction. Otherwise the pending commands are flushed once
+* and the block is read from the hardware.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Offset of the first register
+* @param        Data: Pointer to store the words
+* @param        Size: Number of words
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. Block reads are not deferred, as recording a
+*		mask poll per word would outweigh the flush.
+*
+******************************************************************************/
+static AieRC _XAie_TxnBlockRead32(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u64 RegOff, u32 *Data, u32 Size)
+{
+	u8 Opaque, Flush = XAIE_DISABLE, AllKnown = XAIE_ENABLE;
+	u32 Value, Known;
+	AieRC RC;
+
+	for(u32 i = 0U; (Flush == XAIE_DISABLE) && (i < Size); i++) {
+		RC = _XAie_TxnShadowRead(TxnInst, RegOff + i * 4U, &Value,
+				&Known, &Opaque);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
 
-		if (TxnInst == NULL) {
+		if(Known == XAIE_TXN_REG_FULL_MASK) {
 			continue;
 		}
+		AllKnown = XAIE_DISABLE;
+		if((Opaque == XAIE_ENABLE) ||
+				(_XAie_GetRegClass(DevInst, RegOff + i * 4U) ==
+				 XAIE_REG_CLASS_OTHER)) {
+			Flush = XAIE_ENABLE;
+		}
+	}
 
-		for(u32 i = 0; i < TxnInst->NumCmds; i++) {
-			XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
-			//TBD handle custom OP as well
-			if((Cmd->Opcode == XAIE_IO_BLOCKWRITE || Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) &&
-					((void *)(uintptr_t)Cmd->DataPtr != NULL)) {
-				free((void *)(uintptr_t)Cmd->DataPtr);
-			}
+	if(Flush == XAIE_ENABLE) {
+		XAIE_DBG("Flushing %d pending commands to read registers "
+				"0x%lx\n", TxnInst->NumCmds, RegOff);
+		RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to flush cmd buffer\n");
+			return RC;
 		}
+		_XAie_Txn_ResetCmdBuf(TxnInst);
 
-		NodePtr = NodePtr->Next;
-		free(TxnInst->CmdBuf);
-		free(TxnInst);
+		return _XAie_IOBlockRead32(DevInst, RegOff, Data, Size);
+	}
+
+	if(AllKnown == XAIE_DISABLE) {
+		RC = _XAie_IOBlockRead32(DevInst, RegOff, Data, Size);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
 	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		RC = _XAie_TxnShadowRead(TxnInst, RegOff + i * 4U, &Value,
+				&Known, &Opaque);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Data[i] = (AllKnown == XAIE_ENABLE) ? Value :
+			((Data[i] & ~Known) | (Value & Known));
+	}
+
+	return XAIE_OK;
 }
 
 AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
@@ -1429,14 +4837,14 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Mask writing "
 					"to register\n");
-			return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+			return _XAie_IOWrite32(DevInst, RegOff, Value);
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -1454,7 +4862,7 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+	return _XAie_IOWrite32(DevInst, RegOff, Value);
 }
 
 AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
@@ -1464,14 +4872,14 @@ AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Reading "
 					"from register\n");
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			return _XAie_IORead32(DevInst, RegOff, Data);
 		}
 
 		if(((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) != 0U) &&
@@ -1485,17 +4893,62 @@ AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			_XAie_Txn_ResetCmdBuf(TxnInst);
+			return _XAie_IORead32(DevInst, RegOff, Data);
 		} else if(TxnInst->NumCmds == 0U) {
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			return _XAie_IORead32(DevInst, RegOff, Data);
 		} else {
-			XAIE_ERROR("Read operation is not supported "
-					"when auto flush is disabled\n");
-			return XAIE_ERR;
+			return _XAie_TxnRead32(DevInst, TxnInst, RegOff, Data);
+		}
+	}
+	return _XAie_IORead32(DevInst, RegOff, Data);
+}
+
+/*****************************************************************************/
+/**
+* This API reads a block of consecutive registers or memory words. Backends
+* without a block read operation are read one word at a time.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Offset of the first word
+* @param        Data: Pointer to store the words
+* @param        Size: Number of words
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         If the calling thread has a transaction with pending commands,
+*		the commands are flushed first when the transaction flushes
+*		automatically. Otherwise the words written by the pending
+*		commands are served from the transaction, and the commands are
+*		flushed at most once if other words need it.
+*
+******************************************************************************/
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data, u32 Size)
+{
+	AieRC RC;
+	XAie_TxnInst *TxnInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
+		TxnInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+		if((TxnInst != NULL) && (TxnInst->NumCmds > 0U)) {
+			if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) == 0U) {
+				return _XAie_TxnBlockRead32(DevInst, TxnInst,
+						RegOff, Data, Size);
+			}
+
+			XAIE_DBG("Auto flushing contents of the transaction "
+					"buffer.\n");
+			RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to flush cmd buffer\n");
+				return RC;
+			}
+			_XAie_Txn_ResetCmdBuf(TxnInst);
 		}
 	}
-	return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+
+	return _XAie_IOBlockRead32(DevInst, RegOff, Data, Size);
 }
 
 AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
@@ -1505,14 +4958,14 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Writing "
 					"to register\n");
-			return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
+			return _XAie_IOMaskWrite32(DevInst, RegOff, Mask,
 					Value);
 		}
 
@@ -1531,7 +4984,7 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
+	return _XAie_IOMaskWrite32(DevInst, RegOff, Mask,
 			Value);
 }
 
@@ -1543,15 +4996,15 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Polling "
 					"from register\n");
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value,
+					TimeOutUs);
 		}
 
 		if(((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) != 0U) &&
@@ -1565,9 +5018,9 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			_XAie_Txn_ResetCmdBuf(TxnInst);
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value,
+					TimeOutUs);
 		} else {
 			if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
 				RC = _XAie_ReallocCmdBuf(TxnInst);
@@ -1585,8 +5038,7 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 			return XAIE_OK;
 		}
 	}
-	return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-			Value, TimeOutUs);
+	return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value, TimeOutUs);
 }
 
 AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32 Size)
@@ -1597,14 +5049,14 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block write "
 					"to register\n");
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+			return _XAie_IOBlockWrite32(DevInst, RegOff,
 					Data, Size);
 		}
 
@@ -1620,8 +5072,8 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 				}
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+			_XAie_Txn_ResetCmdBuf(TxnInst);
+			return _XAie_IOBlockWrite32(DevInst, RegOff,
 					Data, Size);
 		}
 
@@ -1632,7 +5084,8 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 			}
 		}
 
-		Buf = (u32 *)malloc(sizeof(u32) * Size);
+		Buf = (u32 *)_XAie_TxnPayloadAlloc(TxnInst,
+				sizeof(u32) * (u64)Size);
 		if(Buf == NULL) {
 			XAIE_ERROR("Memory allocation for block write failed\n");
 			return XAIE_ERR;
@@ -1648,7 +5101,7 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+	return _XAie_IOBlockWrite32(DevInst, RegOff,
 			Data, Size);
 }
 
@@ -1659,14 +5112,14 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block set "
 					"to register\n");
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+			return _XAie_IOBlockSet32(DevInst, RegOff, Data,
 					Size);
 		}
 
@@ -1682,8 +5135,8 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 				}
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+			_XAie_Txn_ResetCmdBuf(TxnInst);
+			return _XAie_IOBlockSet32(DevInst, RegOff, Data,
 					Size);
 		}
 
@@ -1703,7 +5156,7 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+	return _XAie_IOBlockSet32(DevInst, RegOff, Data,
 			Size);
 }
 
@@ -1715,14 +5168,14 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Writing cmd "
 					"to register\n");
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
+			return _XAie_IOCmdWrite(DevInst, Col, Row,
 					Command, CmdWd0, CmdWd1, CmdStr);
 		}
 
@@ -1737,9 +5190,9 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 					XAIE_ERROR("Failed to flush cmd buffer\n");
 					return RC;
 				}
-				TxnInst->NumCmds = 0;
+				_XAie_Txn_ResetCmdBuf(TxnInst);
 			}
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
+			return _XAie_IOCmdWrite(DevInst, Col, Row,
 					Command, CmdWd0, CmdWd1, CmdStr);
 		} else {
 			XAIE_ERROR("Cmd Write operation is not supported "
@@ -1747,10 +5200,44 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
+	return _XAie_IOCmdWrite(DevInst, Col, Row,
 			Command, CmdWd0, CmdWd1, CmdStr);
 }
 
+/*****************************************************************************/
+/**
+* This API runs a backend operation. Operations which may change registers
+* behind the driver, such as resets and partition initialization, invalidate
+* the register shadow.
+*
+* @param        DevInst: Device instance pointer
+* @param        Op: Backend operation code
+* @param        Arg: Argument of the operation
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IORunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op,
+		void *Arg)
+{
+	AieRC RC;
+
+	RC = DevInst->Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+	if((DevInst->RegShadow != NULL) &&
+			(Op != XAIE_BACKEND_OP_NPIMASKPOLL32) &&
+			(Op != XAIE_BACKEND_OP_SET_PROTREG) &&
+			(Op != XAIE_BACKEND_OP_UPDATE_NPI_ADDR) &&
+			(Op != XAIE_BACKEND_OP_PERFORMANCE_UTILIZATION) &&
+			(Op != XAIE_BACKEND_OP_CONFIG_MMAP_WRITE) &&
+			(Op != XAIE_BACKEND_OP_FLUSH_IO)) {
+		_XAie_RegShadowInvalidate(DevInst);
+	}
+
+	return RC;
+}
+
 AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 {
 	AieRC RC;
@@ -1759,13 +5246,13 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if((DevInst->TxnList.Next != NULL) && (TxnCustomOpDepth == 0U)) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Running Op.\n");
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_IORunOp(DevInst, Op, Arg);
 		}
 
 		if (Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD) {
@@ -1812,17 +5299,129 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 					XAIE_ERROR("Failed to flush cmd buffer\n");
 					return RC;
 				}
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			_XAie_Txn_ResetCmdBuf(TxnInst);
+			return _XAie_IORunOp(DevInst, Op, Arg);
 		} else if(TxnInst->NumCmds == 0U) {
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_IORunOp(DevInst, Op, Arg);
 		} else {
 			XAIE_ERROR("Run Op operation is not supported "
 					"when auto flush is disabled\n");
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+	return _XAie_IORunOp(DevInst, Op, Arg);
+}
+
+/*****************************************************************************/
+/**
+* This API enables the shadow of the configuration registers of a device
+* instance. Writes to stream switch, DMA buffer descriptor and event
+* configuration registers which do not change the value known to the shadow
+* are skipped, and masked writes to these registers are computed from the
+* shadow instead of being read back from the device. Status and control
+* registers are never shadowed.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         The shadow is invalidated by resets and backend operations
+*		which may change the registers behind the driver. Registers
+*		written by other agents than this device instance must be
+*		followed by XAie_InvalidateRegShadow(). Backends which can not
+*		read back the registers, such as the CDO and debug backends, do
+*		not support the shadow. Must not be called concurrently with
+*		register accesses of the device instance.
+*
+******************************************************************************/
+AieRC XAie_EnableRegShadow(XAie_DevInst *DevInst)
+{
+	XAie_RegShadow *Shadow;
+	XAie_BackendType Type;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Type = DevInst->Backend->Type;
+	if((Type == XAIE_IO_BACKEND_CDO) || (Type == XAIE_IO_BACKEND_DEBUG)) {
+		XAIE_ERROR("Register shadow is not supported by backend %d\n",
+				Type);
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	if(DevInst->RegShadow != NULL) {
+		return XAIE_OK;
+	}
+
+	Shadow = (XAie_RegShadow *)calloc(1U, sizeof(*Shadow));
+	if(Shadow == NULL) {
+		XAIE_ERROR("Failed to allocate memory for register shadow\n");
+		return XAIE_ERR;
+	}
+
+	Shadow->NumTables = (DevInst->RegLocks == NULL) ? 1U :
+		DevInst->RegLocks->NumShards;
+	for(u32 i = 0U; i < Shadow->NumTables; i++) {
+		Shadow->Tables[i].Epoch = 1U;
+	}
+	DevInst->RegShadow = Shadow;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API disables the register shadow of a device instance and releases its
+* memory.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Must not be called concurrently with register accesses of the
+*		device instance.
+*
+******************************************************************************/
+AieRC XAie_DisableRegShadow(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_RegShadowDestroy(DevInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API drops all the registers known to the register shadow of a device
+* instance. It must be called after registers of the partition are changed
+* behind the driver, for example by another process or by firmware.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         None.
+*
+******************************************************************************/
+AieRC XAie_InvalidateRegShadow(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_RegShadowInvalidate(DevInst);
+
+	return XAIE_OK;
 }
 
 AieRC _XAie_ClearTransaction(XAie_DevInst* DevInst)
@@ -1838,25 +5437,51 @@ AieRC _XAie_ClearTransaction(XAie_DevInst* DevInst)
 		return XAIE_ERR;
 	}
 
-	for(u32 i = 0U; i < Inst->NumCmds; i++) {
-		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE || Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
-			XAIE_DBG("free DataPtr %p\n", Cmd->DataPtr);
-			free((void *)(uintptr_t)Cmd->DataPtr);
-		}
-	}
-
 	RC = _XAie_RemoveTxnInstFromList(DevInst, Backend->Ops.GetTid());
 	if(RC != XAIE_OK) {
 		return RC;
 	}
 
-	free(Inst->CmdBuf);
-	free(Inst);
+	_XAie_TxnInstFree(Inst);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This api removes the transaction instance of the calling thread from the
+* list of transaction instances of the device instance. The calling thread can
+* start a new transaction afterwards.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	Pointer to the transaction instance on success and NULL on
+*		error.
+*
+* @note		Internal only. The caller owns the returned instance and
+*		releases it with _XAie_TxnInstFree().
+*
+******************************************************************************/
+XAie_TxnInst* _XAie_TxnDetach(XAie_DevInst *DevInst)
+{
+	XAie_TxnInst *Inst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	Inst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to get the correct transaction instance "
+				"from internal list\n");
+		return NULL;
+	}
+
+	if(_XAie_RemoveTxnInstFromList(DevInst, Inst->Tid) != XAIE_OK) {
+		return NULL;
+	}
+
+	return Inst;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1930,7 +5555,7 @@ AieRC XAie_AddCustomTxnOp(XAie_DevInst *DevInst, u8 OpNumber, void* Args, size_t
 		}
 
 		/* check memory allocation before increase Cmd vector */
-		char* tmpBuff = malloc(size);
+		char* tmpBuff = _XAie_TxnPayloadAlloc(TxnInst, size);
 		if(tmpBuff == XAIE_NULL) {
 			XAIE_ERROR("Fail to malloc %d size memory for DataPtr\n", size);
 			return XAIE_ERR;
@@ -2188,11 +5813,10 @@ static AieRC _XAie_LockValueStatusDump(XAie_DevInst *DevInst,
 static AieRC _XAie_EventStatusDump(XAie_DevInst *DevInst,
 		XAie_ColStatus *Status, XAie_LocType Loc)
 {
-	u32 RegVal;
 	AieRC RC;
+	u64 TileAddr;
 	u8 TileType, AieTileStart, MemTileStart;
 	u8 Index;
-	u8 NumEventReg;
 
 	const XAie_EvntMod *EvntCoreMod, *EvntMod;
 	XAie_CoreTileStatus *CoreTile;
@@ -2213,57 +5837,42 @@ static AieRC _XAie_EventStatusDump(XAie_DevInst *DevInst,
 	MemTile = Status[Loc.Col].MemTile;
 	ShimTile = Status[Loc.Col].ShimTile;
 	DevMod = DevInst->DevProp.DevMod;
+	TileAddr = XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
+	/*
+	 * Event status registers of a module are contiguous, read all of them
+	 * with one block read into the output buffer.
+	 */
 	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
 		EvntCoreMod = &DevMod[TileType].EvntMod[XAIE_CORE_MOD];
+		EvntMod = &DevMod[TileType].EvntMod[XAIE_MEM_MOD];
 		Index = Loc.Row - AieTileStart;
-		/* iterate all event status registers */
-		NumEventReg = EvntCoreMod->NumEventReg;
-		for(u32 EventReg = 0; EventReg < NumEventReg; EventReg++) {
-			/* read event status register and store in output
-			 * buffer */
-			RC = XAie_EventRegStatus(DevInst, Loc, XAIE_CORE_MOD,
-					(u8)EventReg, &RegVal);
-			if (RC != XAIE_OK) {
-				return RC;
-			}
-
-			CoreTile[Index].EventCoreModStatus[EventReg] = RegVal;
-
-			/* read event status register and store in output
-			 * buffer */
-			RC = XAie_EventRegStatus(DevInst, Loc, XAIE_MEM_MOD,
-					(u8)EventReg, &RegVal);
-			if (RC != XAIE_OK) {
-				return RC;
-			}
-			CoreTile[Index].EventMemModStatus[EventReg] = RegVal;
+		RC = XAie_BlockRead32(DevInst,
+				TileAddr + EvntCoreMod->BaseStatusRegOff,
+				CoreTile[Index].EventCoreModStatus,
+				EvntCoreMod->NumEventReg);
+		if (RC != XAIE_OK) {
+			return RC;
 		}
+
+		RC = XAie_BlockRead32(DevInst,
+				TileAddr + EvntMod->BaseStatusRegOff,
+				CoreTile[Index].EventMemModStatus,
+				EvntMod->NumEventReg);
 	} else if(TileType == XAIEGBL_TILE_TYPE_MEMTILE) {
 		EvntMod = &DevMod[TileType].EvntMod[XAIE_MEM_MOD];
 		Index = Loc.Row - MemTileStart;
-		NumEventReg = EvntMod->NumEventReg;
-		for(u32 EventReg = 0; EventReg < NumEventReg; EventReg++) {
-			RC = XAie_EventRegStatus(DevInst, Loc, XAIE_MEM_MOD,
-					(u8)EventReg, &RegVal);
-			if (RC != XAIE_OK) {
-				return RC;
-			}
-			MemTile[Index].EventStatus[EventReg] = RegVal;
-		}
+		RC = XAie_BlockRead32(DevInst,
+				TileAddr + EvntMod->BaseStatusRegOff,
+				MemTile[Index].EventStatus, EvntMod->NumEventReg);
 	} else {
 		EvntMod = &DevMod[TileType].EvntMod[0U];
-		NumEventReg = EvntMod->NumEventReg;
-		for(u32 EventReg = 0; EventReg < NumEventReg; EventReg++) {
-			RC = XAie_EventRegStatus(DevInst, Loc, XAIE_PL_MOD,
-					(u8)EventReg, &RegVal);
-			if (RC != XAIE_OK) {
-				return RC;
-			}
-			ShimTile[Loc.Row].EventStatus[EventReg] = RegVal;
-		}
+		RC = XAie_BlockRead32(DevInst,
+				TileAddr + EvntMod->BaseStatusRegOff,
+				ShimTile[Loc.Row].EventStatus, EvntMod->NumEventReg);
 	}
-	return XAIE_OK;
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -199,6 +199,7 @@ AieRC XAie_GetUngatedLocsInPartition(XAie_DevInst *DevInst, u32 *NumTiles,
                 XAie_LocType *Locs);
 AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value);
 AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data);
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data, u32 Size);
 AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value);
 AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs);
@@ -211,6 +212,9 @@ void BuffHexDump(char* buff,u32 size);
 int XAie_RequestCustomTxnOp(XAie_DevInst *DevInst);
 AieRC XAie_AddCustomTxnOp(XAie_DevInst *DevInst, u8 OpNumber, void* Args, size_t size);
 AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg);
+AieRC XAie_EnableRegShadow(XAie_DevInst *DevInst);
+AieRC XAie_DisableRegShadow(XAie_DevInst *DevInst);
+AieRC XAie_InvalidateRegShadow(XAie_DevInst *DevInst);
 u32 XAie_GetNumRows(XAie_DevInst *DevInst, u8 TileType);
 u32 XAie_GetStartRow(XAie_DevInst *DevInst, u8 TileType);
 AieRC XAie_StatusDump(XAie_DevInst *DevInst, XAie_ColStatus *Status);
@@ -15,7 +15,129 @@
 #define XAIE_HELPER_INTERNAL_H
 
 /***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "xaie_txn.h"
+
 /***************************** Macro Definitions *****************************/
+#define XAIE_TXN_INSTANCE_EXPORTED	0b10U
+#define XAIE_TXN_INST_EXPORTED_MASK XAIE_TXN_INSTANCE_EXPORTED
+#define XAIE_TXN_AUTO_FLUSH_MASK XAIE_TRANSACTION_ENABLE_AUTO_FLUSH
+#define XAIE_TXN_OPTIMIZE_MASK XAIE_TRANSACTION_ENABLE_OPTIMIZE
+#define XAIE_TXN_EXPORT_COMPACT_MASK XAIE_TRANSACTION_EXPORT_COMPACT
+#define XAIE_TXN_DEFER_READS_MASK XAIE_TRANSACTION_DEFER_READS
+#define XAIE_TXN_PARALLEL_SUBMIT_MASK XAIE_TRANSACTION_ENABLE_PARALLEL_SUBMIT
+
+#if defined(__linux__) && (defined(__GNUC__) || defined(__clang__))
+#define XAIE_THREAD_LOCAL		__thread
+#else
+#define XAIE_THREAD_LOCAL
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define XAIE_ATOMIC_LOAD(Ptr)		__atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#define XAIE_ATOMIC_STORE(Ptr, Val)	__atomic_store_n((Ptr), (Val), \
+						__ATOMIC_RELEASE)
+#define XAIE_ATOMIC_INC(Ptr)		__atomic_add_fetch((Ptr), 1U, \
+						__ATOMIC_ACQ_REL)
+#define XAIE_ATOMIC_OR(Ptr, Val)	__atomic_fetch_or((Ptr), (Val), \
+						__ATOMIC_ACQ_REL)
+#define XAIE_ATOMIC_AND(Ptr, Val)	__atomic_fetch_and((Ptr), (Val), \
+						__ATOMIC_ACQ_REL)
+#else
+#define XAIE_ATOMIC_LOAD(Ptr)		(*(Ptr))
+#define XAIE_ATOMIC_STORE(Ptr, Val)	(*(Ptr) = (Val))
+#define XAIE_ATOMIC_INC(Ptr)		(++(*(Ptr)))
+#define XAIE_ATOMIC_OR(Ptr, Val)	(*(Ptr) |= (Val))
+#define XAIE_ATOMIC_AND(Ptr, Val)	(*(Ptr) &= (Val))
+#endif
+
+/*
+ * Number of register lock shards of a device instance. Register accesses of
+ * partition relative column C are serialized by shard C % XAIE_REG_LOCK_SHARDS,
+ * so that up to XAIE_REG_LOCK_SHARDS columns are configured in parallel.
+ * Consecutive columns always map to distinct shards. In partitions of more
+ * than XAIE_REG_LOCK_SHARDS columns, columns C and C + XAIE_REG_LOCK_SHARDS
+ * share a shard and their accesses are serialized, which is correct but
+ * limits the parallelism. No other mapping avoids this, as there are more
+ * columns than shards, and the parallel flush starts at most one worker per
+ * shard anyway.
+ */
+#define XAIE_REG_LOCK_SHARDS		16U
+
+/*
+ * Blocks of up to XAIE_REG_SHADOW_BLOCK_MAX words are tracked word by word in
+ * the register shadow, the shadowed words of larger blocks are dropped.
+ */
+#define XAIE_REG_SHADOW_BLOCK_MAX	64U
+
+/**************************** Type Definitions *******************************/
+/* Classes of registers as seen by the transaction utilities */
+typedef enum {
+	XAIE_REG_CLASS_OTHER,
+	XAIE_REG_CLASS_STRMSW,		/* Stream switch port configuration */
+	XAIE_REG_CLASS_DMA_BD,		/* DMA buffer descriptors */
+	XAIE_REG_CLASS_EVENT_CFG,	/* Event broadcast/group/combo config */
+} XAie_RegClass;
+
+/* Handler registered for a custom operation */
+typedef struct {
+	XAie_TxnCustomOpHandler Handler;
+	void *Priv;
+} XAie_TxnCustomOpEntry;
+
+/* Custom operation handlers of a device instance indexed by opcode */
+struct XAie_TxnCustomOps {
+	XAie_TxnCustomOpEntry Ops[XAIE_IO_CUSTOM_OP_MAX -
+		XAIE_IO_CUSTOM_OP_BEGIN + 1];
+};
+
+/* Mutex used to serialize updates to driver owned software state */
+struct XAie_Mutex {
+#ifdef __linux__
+	pthread_mutex_t Mutex;
+#else
+	u8 Rsvd;
+#endif
+};
+
+/*
+ * Register lock shards of a device instance. Backends which share state
+ * between columns, such as a socket or a CDO file, use a single shard.
+ */
+struct XAie_RegLocks {
+	u32 NumShards;
+	XAie_Mutex Shards[XAIE_REG_LOCK_SHARDS];
+};
+
+/* Shadowed register. Slots of older epochs are free. */
+typedef struct {
+	u64 RegOff;
+	u32 Value;
+	u32 Epoch;
+	u8 Valid;	/* XAIE_DISABLE once the value is no longer known */
+} XAie_RegShadowEntry;
+
+/* Open addressing table of the shadowed registers of a lock shard */
+typedef struct {
+	XAie_RegShadowEntry *Entries;
+	u32 Size;
+	u32 NumEntries;
+	u32 Epoch;
+} XAie_RegShadowTable;
+
+/*
+ * Shadow of the configuration registers of a device instance. Table i holds
+ * the registers serialized by register lock shard i and is only accessed with
+ * that shard held.
+ */
+struct XAie_RegShadow {
+	u32 NumTables;
+	XAie_RegShadowTable Tables[XAIE_REG_LOCK_SHARDS];
+};
+
 /************************** Function Definitions *****************************/
 AieRC _XAie_GetSlaveIdx(const XAie_StrmMod *StrmMod, StrmSwPortType Slave,
 		u8 PortNum, u8 *SlaveIdx);
@@ -26,15 +148,124 @@ u32 _XAie_GetFatalGroupErrors(XAie_DevInst *DevInst, XAie_LocType Loc,
 u32 _XAie_GetTileBitPosFromLoc(XAie_DevInst *DevInst, XAie_LocType Loc);
 void _XAie_SetBitInBitmap(u32 *Bitmap, u32 StartSetBit, u32 NumSetBit);
 void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartSetBit, u32 NumSetBit);
+XAie_RegClass _XAie_GetRegClass(XAie_DevInst *DevInst, u64 RegOff);
+XAie_TxnStatsModule _XAie_GetRegModule(XAie_DevInst *DevInst, u64 RegOff);
+XAie_TxnInst* _XAie_TxnGetCurrentInst(XAie_DevInst *DevInst);
+void _XAie_TxnListInit(XAie_DevInst *DevInst);
+void _XAie_TxnCustomOpsFree(XAie_DevInst *DevInst);
+void _XAie_TxnCacheFree(XAie_DevInst *DevInst);
+void _XAie_TxnAsyncDrain(XAie_DevInst *DevInst);
+void _XAie_TxnAsyncFree(XAie_DevInst *DevInst);
+void _XAie_TxnFlushPoolFree(XAie_DevInst *DevInst);
+XAie_TxnCmd* _XAie_TxnAllocCmd(XAie_TxnInst *TxnInst);
+u64 _XAie_TxnCompactEncode(const XAie_TxnInst *TxnInst, u8 *Buf, u32 *NumRecs);
+AieRC _XAie_TxnCompactDecode(XAie_TxnInst *TxnInst, const u8 *Buf, u32 Size,
+		u32 NumRecs);
+AieRC _XAie_TxnOptimize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Opts, XAie_TxnOptStats *Stats);
+AieRC _XAie_TxnShadowRead(XAie_TxnInst *TxnInst, u64 RegOff, u32 *Value,
+		u32 *Known, u8 *Opaque);
+void _XAie_TxnShadowReset(XAie_TxnInst *TxnInst);
+void _XAie_TxnShadowFree(XAie_TxnInst *TxnInst);
+void _XAie_TxnTagsReset(XAie_TxnInst *TxnInst);
+void _XAie_TxnTagsFree(XAie_TxnInst *TxnInst);
+AieRC _XAie_TxnTagsCopy(XAie_TxnInst *Dst, const XAie_TxnInst *Src);
+u64 _XAie_TxnCmdSerializedSize(const XAie_TxnCmd *Cmd);
 AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags);
 AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
+AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
+XAie_TxnInst* _XAie_TxnDetach(XAie_DevInst *DevInst);
 XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst);
+AieRC _XAie_TxnGetSerializedSize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u32 *Size);
+AieRC _XAie_TxnSerialize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u8 *Buf, u32 BufSize);
+AieRC _XAie_TxnSerializeAlloc(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u64 MaxSize, u8 **Buf, u32 *Size);
 u8* _XAie_TxnExportSerialized(XAie_DevInst *DevInst, u8 NumConsumers,
 		u32 Flags);
 AieRC _XAie_ClearTransaction(XAie_DevInst* DevInst);
 AieRC _XAie_TxnFree(XAie_TxnInst *Inst);
 void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst);
 void _XAie_FreeTxnPtr(void *Ptr);
+XAie_TxnInst* _XAie_TxnImportSerialized(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size);
+AieRC _XAie_TxnSubmitSerialized(XAie_DevInst *DevInst, const u8 *TxnPtr,
+		u32 Size);
+void* _XAie_TxnPayloadAlloc(XAie_TxnInst *TxnInst, u64 Size);
+void _XAie_TxnInstFree(XAie_TxnInst *TxnInst);
+XAie_Mutex* _XAie_MutexCreate(void);
+void _XAie_MutexDestroy(XAie_Mutex *Mutex);
+void _XAie_MutexLock(XAie_Mutex *Mutex);
+void _XAie_MutexUnlock(XAie_Mutex *Mutex);
+XAie_RegLocks* _XAie_RegLocksCreate(XAie_DevInst *DevInst);
+void _XAie_RegLocksDestroy(XAie_RegLocks *RegLocks);
+void _XAie_RegShadowInvalidate(XAie_DevInst *DevInst);
+void _XAie_RegShadowDestroy(XAie_DevInst *DevInst);
+
+/*****************************************************************************/
+/**
+* This API returns the lock serializing the accesses to a register.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+*
+* @return       Pointer to the lock shard of the register column, NULL if the
+*		device instance has no register locks.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline XAie_Mutex* _XAie_RegLockOf(XAie_DevInst *DevInst, u64 RegOff)
+{
+	XAie_RegLocks *RegLocks = DevInst->RegLocks;
+
+	if(RegLocks == NULL) {
+		return NULL;
+	}
+
+	return &RegLocks->Shards[(RegOff >> DevInst->DevProp.ColShift) %
+		RegLocks->NumShards];
+}
+
+/*****************************************************************************/
+/**
+* This API returns the row of the tile addressed by a partition relative
+* register offset.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset relative to the partition base
+*
+* @return       Row of the tile.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_GetRowfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
+{
+	return (u8)((RegOff >> DevInst->DevProp.RowShift) &
+			((1U << (DevInst->DevProp.ColShift -
+				 DevInst->DevProp.RowShift)) - 1U));
+}
+
+/*****************************************************************************/
+/**
+* This API returns the partition relative column of the tile addressed by a
+* partition relative register offset.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset relative to the partition base
+*
+* @return       Column of the tile.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_GetColfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
+{
+	return (u8)(RegOff >> DevInst->DevProp.ColShift);
+}
+
 void _XAie_AppendPartitionToList(XAie_DevInst *DevInst, XAie_PartitionList *PartInst);
 AieRC _XAie_DestroyPartitionFdList(XAie_DevInst *DevInst);
 AieRC _XAie_PrintPartitionList(XAie_DevInst *DevInst);
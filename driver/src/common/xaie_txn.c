@@ -0,0 +1,4112 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn.c
+* @{
+*
+* This file contains routines to optimize recorded transactions, to run custom
+* operations of transactions on the host, to encode transactions in the
+* compact serialized format, to patch recorded transactions through
+* templates, to track the register values written by pending commands and to
+* report statistics of transactions and to cache serialized transactions.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* 1.1   Tejus   10/16/2026  Add custom op handler registration
+* 1.2   Tejus   10/16/2026  Add compact serialized format
+* 1.3   Tejus   10/16/2026  Add transaction templates
+* 1.4   Tejus   10/16/2026  Add shadow of pending writes
+* 1.5   Tejus   10/16/2026  Add transaction statistics and tags
+* 1.6   Tejus   10/16/2026  Add transaction cache
+* 1.7   Tejus   10/16/2026  Add asynchronous transaction submission
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_dma.h"
+#include "xaie_helper.h"
+#include "xaie_helper_internal.h"
+#include "xaie_txn.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TXN_OPT_MAP_MAX_ENTRIES	8192U
+#define XAIE_TXN_OPT_FULL_MASK		0xFFFFFFFFU
+
+/*
+ * Record tags of the compact serialized format. Register offsets of records
+ * are zigzag varint encoded deltas from the end of the previous access, word
+ * streams are sequences of varint (repeat, value) pairs. The NumOps field of
+ * the header is the number of records, a write run record decodes to one
+ * write command per word.
+ */
+#define XAIE_TXN_COMPACT_WRITE		0x0U /* Delta, value */
+#define XAIE_TXN_COMPACT_WRITE_RUN	0x1U /* Delta, count, word stream */
+#define XAIE_TXN_COMPACT_BLOCKWRITE	0x2U /* Delta, count, word stream */
+#define XAIE_TXN_COMPACT_BLOCKSET	0x3U /* Delta, count, value */
+#define XAIE_TXN_COMPACT_MASKWRITE	0x4U /* Delta, mask, value */
+#define XAIE_TXN_COMPACT_MASKPOLL	0x5U /* Delta, mask, value */
+#define XAIE_TXN_COMPACT_CUSTOM		0x6U /* Opcode, size, payload */
+
+#define XAIE_TXN_VARINT_MAX_BYTES	10U
+
+/*
+ * Limits of the compact format. The encoder splits longer runs and blocks in
+ * several records. The decoder rejects blobs which exceed them, as a few bytes
+ * of word stream can claim any number of words.
+ */
+#define XAIE_TXN_COMPACT_MAX_WORDS	0x10000U /* Words per record */
+#define XAIE_TXN_COMPACT_MAX_DECODED	0x10000000U /* Bytes of commands and
+						       payloads per blob */
+
+#define XAIE_TXN_TEMPLATE_DEFAULT_SLOTS	8U
+#define XAIE_TXN_TEMPLATE_DEFAULT_LOCS	16U
+#define XAIE_TXN_TEMPLATE_INVALID_SLOT	0xFFFFFFFFU
+
+#define XAIE_TXN_SHADOW_DEFAULT_SIZE	256U
+#define XAIE_TXN_SHADOW_MAX_BLOCK_WORDS	64U /* Larger blocks are tracked as
+					       ranges */
+#define XAIE_TXN_SHADOW_DEFAULT_RANGES	8U
+
+#define XAIE_TXN_TAGS_DEFAULT_MARKS	8U
+
+#define XAIE_TXN_FNV_OFFSET_BASIS	0xCBF29CE484222325ULL
+#define XAIE_TXN_FNV_PRIME		0x100000001B3ULL
+
+/**************************** Type Definitions *******************************/
+/*
+ * Location of a word of a recorded command patched by a template slot. WordIdx
+ * is the index of the word in the payload of block writes and 0 otherwise.
+ */
+typedef struct {
+	u32 CmdIdx;
+	u32 WordIdx;
+} XAie_TxnTemplateLoc;
+
+/*
+ * Patch slot of a template. The slot value is shifted right by Shift and
+ * placed at the least significant set bit of Mask. The locations of the slot
+ * are Locs[FirstLoc] to Locs[FirstLoc + NumLocs - 1] of the template. Slots
+ * created for DDR patch operations and for the high address word of shim
+ * buffer descriptors have an empty name. Values of a slot are patched into
+ * its HighSlot as well, if valid.
+ */
+typedef struct {
+	char Name[XAIE_TXN_TEMPLATE_NAME_MAX];
+	u32 Mask;
+	u8 Shift;
+	u32 FirstLoc;
+	u32 NumLocs;
+	u32 HighSlot;
+} XAie_TxnTemplateSlot;
+
+/* DDR patch operation of a template with its address slots */
+typedef struct {
+	u64 ArgIdx;
+	u64 ArgPlus;
+	u32 AddrLowSlot;
+	u32 AddrHighSlot;
+} XAie_TxnTemplatePatch;
+
+struct XAie_TxnTemplate {
+	XAie_DevInst *DevInst;
+	XAie_TxnInst *TxnInst;
+	XAie_TxnTemplateSlot *Slots;
+	u32 NumSlots;
+	u32 MaxSlots;
+	XAie_TxnTemplateLoc *Locs;
+	u32 NumLocs;
+	u32 MaxLocs;
+	XAie_TxnTemplatePatch *Patches;
+	u32 NumPatches;
+};
+
+/*
+ * Entry of the map from a register offset to the index of the last pending
+ * write to the register. An entry is valid only if its epoch matches the
+ * epoch of the map, bumping the epoch clears the map.
+ */
+typedef struct {
+	u64 RegOff;
+	u32 Idx;
+	u32 Epoch;
+} XAie_TxnOptMapEntry;
+
+typedef struct {
+	XAie_TxnOptMapEntry *Entries;
+	u32 Size;
+	u32 Count;
+	u32 Epoch;
+} XAie_TxnOptMap;
+
+/*
+ * Shadow entry of a register. Known is the mask of the bits written by the
+ * pending commands, Seq is the index of the last command writing the register.
+ * An entry is valid only if its epoch matches the epoch of the shadow.
+ */
+typedef struct {
+	u64 RegOff;
+	u32 Value;
+	u32 Known;
+	u32 Seq;
+	u32 Epoch;
+} XAie_TxnShadowEntry;
+
+/* Range of registers written by a large block write or block set command */
+typedef struct {
+	u64 Start;
+	u64 End;
+	u32 CmdIdx;
+} XAie_TxnShadowRange;
+
+/*
+ * Shadow of the register values written by the pending commands of a
+ * transaction. The shadow is built lazily on the first read and extended with
+ * the commands recorded since the previous read.
+ */
+struct XAie_TxnShadow {
+	XAie_TxnShadowEntry *Entries;
+	u32 Size;
+	u32 Count;
+	u32 Epoch;
+	XAie_TxnShadowRange *Ranges;
+	u32 NumRanges;
+	u32 MaxRanges;
+	u32 NumCmds;	/* Number of commands applied to the shadow */
+	u8 Opaque;	/* Pending commands with effects unknown to the shadow */
+};
+
+/* Tag of the commands recorded from command index CmdIdx on */
+typedef struct {
+	u32 CmdIdx;
+	char Name[XAIE_TXN_TAG_NAME_MAX]; /* Empty for untagged commands */
+} XAie_TxnTagMark;
+
+/* Tag marks of a transaction instance in increasing command index order */
+struct XAie_TxnTags {
+	XAie_TxnTagMark *Marks;
+	u32 NumMarks;
+	u32 MaxMarks;
+};
+
+/*
+ * Serialized transaction of the transaction cache. Entries evicted while they
+ * are replayed are released by the last replay.
+ */
+typedef struct XAie_TxnCacheEntry {
+	struct XAie_TxnCacheEntry *Prev;	/* More recently used entry */
+	struct XAie_TxnCacheEntry *Next;	/* Less recently used entry */
+	u64 Key;
+	u8 *Txn;
+	u32 Size;
+	u32 Refs;	/* Replays in progress */
+	u8 *Cmds;	/* Command bytes covered by XAie_HashTransaction() */
+	u64 CmdsSize;
+	u8 Evicted;
+} XAie_TxnCacheEntry;
+
+/*
+ * Visitor of the command bytes of a transaction covered by its hash. Returns
+ * XAIE_DISABLE to stop the walk.
+ */
+typedef u8 (*XAie_TxnKeyVisitor)(void *Priv, const void *Buf, u64 Size);
+
+/* Position in the command bytes of a cached transaction */
+typedef struct {
+	u8 *Buf;
+	u64 Size;
+	u64 Off;
+} XAie_TxnKeyCursor;
+
+/* Transaction cache of a device instance in most recently used order */
+struct XAie_TxnCache {
+	XAie_Mutex *Lock;
+	XAie_TxnCacheEntry *Head;
+	XAie_TxnCacheEntry *Tail;
+	u64 Budget;	/* Memory budget in bytes */
+	u64 Used;	/* Memory used by the entries in bytes */
+	u32 NumEntries;
+};
+
+/* Asynchronous submission of a transaction instance */
+struct XAie_TxnFence {
+	XAie_TxnFence *Next;		/* Next queued submission */
+	XAie_TxnAsync *Async;		/* Queue of the submission */
+	XAie_DevInst *DevInst;
+	XAie_TxnInst *TxnInst;
+	u8 ReleaseInst;			/* Instance is released once executed */
+	XAie_TxnFenceCallback Callback;
+	void *CallbackArg;
+	AieRC RC;			/* Result of the submission */
+	u32 Done;			/* Non zero once the submission completed */
+};
+
+#ifdef __linux__
+/*
+ * Queue of the asynchronous submissions of a device instance. Submissions are
+ * executed in queue order by a single submission thread.
+ */
+struct XAie_TxnAsync {
+	pthread_t Thread;
+	pthread_mutex_t Lock;
+	pthread_cond_t WorkCond;	/* Signalled when a submission is queued */
+	pthread_cond_t DoneCond;	/* Signalled when a submission completed */
+	XAie_TxnFence *Head;
+	XAie_TxnFence *Tail;
+	u32 NumPending;			/* Queued or executing submissions */
+	u8 Exit;
+};
+#endif
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+* This API moves the tag marks of the commands up to a command index to the
+* new index of the command after the command buffer is compacted.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Mark: Pointer to the index of the first mark not yet moved
+* @param        OldIdx: Index of the command before compaction
+* @param        NewIdx: Index of the command after compaction
+*
+* @return       None
+*
+* @note         Internal only. Marks of dropped or merged commands move to the
+*		next command kept.
+*
+******************************************************************************/
+static void _XAie_TxnTagsMove(XAie_TxnInst *TxnInst, u32 *Mark, u32 OldIdx,
+		u32 NewIdx)
+{
+	XAie_TxnTags *Tags = TxnInst->Tags;
+
+	if(Tags == NULL) {
+		return;
+	}
+
+	while((*Mark < Tags->NumMarks) &&
+			(Tags->Marks[*Mark].CmdIdx <= OldIdx)) {
+		Tags->Marks[*Mark].CmdIdx = NewIdx;
+		(*Mark)++;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API returns the map entry of a register offset. The returned entry is
+* either the valid entry for the offset or the free entry where the offset is
+* to be inserted.
+*
+* @param        Map: Pointer to the map
+* @param        RegOff: Register offset
+*
+* @return       Pointer to the map entry.
+*
+* @note         Internal only. The map is never full as it is cleared once
+*		half of its entries are used.
+*
+******************************************************************************/
+static XAie_TxnOptMapEntry* _XAie_TxnOptMapFind(XAie_TxnOptMap *Map,
+		u64 RegOff)
+{
+	u32 Idx = (u32)((RegOff >> 2U) * 0x9E3779B1U) & (Map->Size - 1U);
+
+	while(Map->Entries[Idx].Epoch == Map->Epoch) {
+		if(Map->Entries[Idx].RegOff == RegOff) {
+			break;
+		}
+		Idx = (Idx + 1U) & (Map->Size - 1U);
+	}
+
+	return &Map->Entries[Idx];
+}
+
+/*****************************************************************************/
+/**
+* This API clears all the entries of the map.
+*
+* @param        Map: Pointer to the map
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnOptMapClear(XAie_TxnOptMap *Map)
+{
+	Map->Count = 0U;
+	Map->Epoch++;
+}
+
+/*****************************************************************************/
+/**
+* This API folds masked writes into later writes to the same register and
+* drops writes that are overwritten before they can be observed. Only writes
+* to configuration registers are considered, any other command acts as a
+* barrier across which no write is moved or dropped.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Opts: Optimizer passes to run
+* @param        Stats: Pointer to the optimizer statistics
+*
+* @return       XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnOptFoldWrites(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u32 Opts, XAie_TxnOptStats *Stats)
+{
+	XAie_TxnOptMap Map;
+	u8 *Dead;
+	u32 NumCmds = 0U;
+	u32 Mark = 0U;
+
+	Map.Size = 16U;
+	while((Map.Size < TxnInst->NumCmds * 2U) &&
+			(Map.Size < XAIE_TXN_OPT_MAP_MAX_ENTRIES)) {
+		Map.Size *= 2U;
+	}
+	Map.Count = 0U;
+	Map.Epoch = 1U;
+	Map.Entries = (XAie_TxnOptMapEntry *)calloc(Map.Size,
+			sizeof(*Map.Entries));
+	Dead = (u8 *)calloc(TxnInst->NumCmds, sizeof(*Dead));
+	if((Map.Entries == NULL) || (Dead == NULL)) {
+		XAIE_ERROR("Failed to allocate memory for optimizer\n");
+		free(Map.Entries);
+		free(Dead);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		XAie_TxnOptMapEntry *Entry;
+		XAie_TxnCmd *Prev;
+
+		if((Cmd->Opcode != XAIE_IO_WRITE) ||
+				(_XAie_GetRegClass(DevInst, Cmd->RegOff) ==
+				 XAIE_REG_CLASS_OTHER)) {
+			_XAie_TxnOptMapClear(&Map);
+			continue;
+		}
+
+		Entry = _XAie_TxnOptMapFind(&Map, Cmd->RegOff);
+		if(Entry->Epoch != Map.Epoch) {
+			if(Map.Count >= Map.Size / 2U) {
+				_XAie_TxnOptMapClear(&Map);
+				Entry = _XAie_TxnOptMapFind(&Map, Cmd->RegOff);
+			}
+			Entry->RegOff = Cmd->RegOff;
+			Entry->Idx = i;
+			Entry->Epoch = Map.Epoch;
+			Map.Count++;
+			continue;
+		}
+
+		Prev = &TxnInst->CmdBuf[Entry->Idx];
+		if(Cmd->Mask == 0U) {
+			if(Opts & XAIE_TXN_OPT_DEAD_STORE) {
+				Dead[Entry->Idx] = XAIE_ENABLE;
+				Stats->NumDropped++;
+			}
+		} else if((Opts & XAIE_TXN_OPT_FOLD_MASKWRITE) &&
+				((Cmd->Value & ~Cmd->Mask) == 0U) &&
+				((Prev->Value & ~Prev->Mask) == 0U ||
+				 Prev->Mask == 0U)) {
+			u32 Mask = (Prev->Mask == 0U) ? XAIE_TXN_OPT_FULL_MASK :
+				(Prev->Mask | Cmd->Mask);
+
+			Cmd->Value = (Prev->Value & ~Cmd->Mask) | Cmd->Value;
+			Cmd->Mask = (Mask == XAIE_TXN_OPT_FULL_MASK) ? 0U : Mask;
+			Dead[Entry->Idx] = XAIE_ENABLE;
+			Stats->NumFolded++;
+		}
+
+		Entry->Idx = i;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		if(Dead[i] == XAIE_ENABLE) {
+			continue;
+		}
+		_XAie_TxnTagsMove(TxnInst, &Mark, i, NumCmds);
+		TxnInst->CmdBuf[NumCmds++] = TxnInst->CmdBuf[i];
+	}
+	_XAie_TxnTagsMove(TxnInst, &Mark, UINT32_MAX, NumCmds);
+	TxnInst->NumCmds = NumCmds;
+
+	free(Map.Entries);
+	free(Dead);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a command is a full register write or a block write which
+* can be merged with address contiguous neighbours. As for folding, only writes
+* to configuration registers are merged.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmd: Pointer to the transaction command
+*
+* @return       XAIE_ENABLE if the command can be merged, XAIE_DISABLE
+*		otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TxnOptIsMergeable(XAie_DevInst *DevInst,
+		const XAie_TxnCmd *Cmd)
+{
+	u32 NumWords;
+
+	if((Cmd->Opcode == XAIE_IO_WRITE) && (Cmd->Mask == 0U)) {
+		NumWords = 1U;
+	} else if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+		NumWords = Cmd->Size;
+	} else {
+		return XAIE_DISABLE;
+	}
+
+	for(u32 i = 0U; i < NumWords; i++) {
+		if(_XAie_GetRegClass(DevInst, Cmd->RegOff + i * 4U) ==
+				XAIE_REG_CLASS_OTHER) {
+			return XAIE_DISABLE;
+		}
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the number of words written by a mergeable command.
+*
+* @param        Cmd: Pointer to the transaction command
+*
+* @return       Number of words.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u32 _XAie_TxnOptNumWords(const XAie_TxnCmd *Cmd)
+{
+	return (Cmd->Opcode == XAIE_IO_WRITE) ? 1U : Cmd->Size;
+}
+
+/*****************************************************************************/
+/**
+* This API merges runs of address contiguous full writes and block writes to
+* configuration registers of a tile into a single block write. The order of
+* the register updates is the same as in the original commands.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Stats: Pointer to the optimizer statistics
+*
+* @return       XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note         Internal only. Payloads of the merged commands are allocated
+*		from the payload arena of the transaction instance.
+*
+******************************************************************************/
+static AieRC _XAie_TxnOptCoalesce(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnOptStats *Stats)
+{
+	AieRC RC = XAIE_OK;
+	u32 NumCmds = 0U;
+	u32 Mark = 0U;
+	u32 i = 0U;
+
+	while(i < TxnInst->NumCmds) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u64 Tile = Cmd->RegOff >> DevInst->DevProp.RowShift;
+		u64 NextOff;
+		u32 NumWords, End;
+		u32 *Data;
+
+		_XAie_TxnTagsMove(TxnInst, &Mark, i, NumCmds);
+		if(!_XAie_TxnOptIsMergeable(DevInst, Cmd)) {
+			TxnInst->CmdBuf[NumCmds++] = *Cmd;
+			i++;
+			continue;
+		}
+
+		NumWords = _XAie_TxnOptNumWords(Cmd);
+		NextOff = Cmd->RegOff + (u64)NumWords * sizeof(u32);
+		for(End = i + 1U; End < TxnInst->NumCmds; End++) {
+			const XAie_TxnCmd *Next = &TxnInst->CmdBuf[End];
+
+			if(!_XAie_TxnOptIsMergeable(DevInst, Next) ||
+					(Next->RegOff != NextOff) ||
+					((Next->RegOff >>
+					  DevInst->DevProp.RowShift) != Tile)) {
+				break;
+			}
+			NumWords += _XAie_TxnOptNumWords(Next);
+			NextOff += (u64)_XAie_TxnOptNumWords(Next) *
+				sizeof(u32);
+		}
+
+		if(End - i == 1U) {
+			TxnInst->CmdBuf[NumCmds++] = *Cmd;
+			i++;
+			continue;
+		}
+
+		Data = (u32 *)_XAie_TxnPayloadAlloc(TxnInst,
+				(u64)NumWords * sizeof(u32));
+		if(Data == NULL) {
+			RC = XAIE_ERR;
+			for(; i < End; i++) {
+				_XAie_TxnTagsMove(TxnInst, &Mark, i, NumCmds);
+				TxnInst->CmdBuf[NumCmds++] = TxnInst->CmdBuf[i];
+			}
+			continue;
+		}
+
+		NumWords = 0U;
+		for(u32 j = i; j < End; j++) {
+			const XAie_TxnCmd *Tmp = &TxnInst->CmdBuf[j];
+
+			if(Tmp->Opcode == XAIE_IO_WRITE) {
+				Data[NumWords++] = Tmp->Value;
+			} else {
+				memcpy(&Data[NumWords],
+					(const void *)(uintptr_t)Tmp->DataPtr,
+					Tmp->Size * sizeof(u32));
+				NumWords += Tmp->Size;
+			}
+		}
+
+		Stats->NumCoalesced += End - i;
+		TxnInst->CmdBuf[NumCmds].Opcode = XAIE_IO_BLOCKWRITE;
+		TxnInst->CmdBuf[NumCmds].RegOff = Cmd->RegOff;
+		TxnInst->CmdBuf[NumCmds].Mask = 0U;
+		TxnInst->CmdBuf[NumCmds].Value = 0U;
+		TxnInst->CmdBuf[NumCmds].DataPtr = (u64)(uintptr_t)Data;
+		TxnInst->CmdBuf[NumCmds].Size = NumWords;
+		NumCmds++;
+		i = End;
+	}
+
+	_XAie_TxnTagsMove(TxnInst, &Mark, UINT32_MAX, NumCmds);
+	TxnInst->NumCmds = NumCmds;
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to allocate memory to coalesce writes\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API runs the peephole optimizer on the commands of a transaction
+* instance. The commands are rewritten in place.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Opts: Optimizer passes to run. XAIE_TXN_OPT_* flags.
+* @param        Stats: Pointer to store the optimizer statistics
+*
+* @return       XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnOptimize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Opts, XAie_TxnOptStats *Stats)
+{
+	AieRC RC;
+
+	if(TxnInst->NumTemplates != 0U) {
+		XAIE_ERROR("Transaction with templates can not be "
+				"optimized\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset(Stats, 0, sizeof(*Stats));
+	Stats->NumOpsBefore = TxnInst->NumCmds;
+	_XAie_TxnShadowReset(TxnInst);
+
+	if(Opts & (XAIE_TXN_OPT_FOLD_MASKWRITE | XAIE_TXN_OPT_DEAD_STORE)) {
+		RC = _XAie_TxnOptFoldWrites(DevInst, TxnInst, Opts, Stats);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if(Opts & XAIE_TXN_OPT_COALESCE) {
+		RC = _XAie_TxnOptCoalesce(DevInst, TxnInst, Stats);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	Stats->NumOpsAfter = TxnInst->NumCmds;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API optimizes the commands of a transaction. Only writes to
+* configuration registers are rewritten: address contiguous writes are merged
+* into block writes, masked writes to a register are folded into one write and
+* writes that are overwritten before the next poll or other side effecting
+* command are dropped.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the transaction being recorded by the calling thread is
+*		optimized.
+* @param	Opts: Optimizer passes to run. XAIE_TXN_OPT_* flags.
+* @param	Stats: Pointer to store the optimizer statistics. Can be NULL.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Transactions started with XAIE_TRANSACTION_ENABLE_OPTIMIZE
+*		are optimized with all the passes when they are submitted or
+*		serialized. Transactions with templates can not be optimized,
+*		as the templates refer to the commands by index.
+*
+******************************************************************************/
+AieRC XAie_OptimizeTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Opts, XAie_TxnOptStats *Stats)
+{
+	XAie_TxnOptStats TmpStats;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Opts & ~XAIE_TXN_OPT_ALL) != 0U) {
+		XAIE_ERROR("Invalid optimizer options\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(TxnInst == NULL) {
+		TxnInst = _XAie_TxnGetCurrentInst(DevInst);
+		if(TxnInst == NULL) {
+			XAIE_ERROR("No transaction started by the calling "
+					"thread\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	RC = _XAie_TxnOptimize(DevInst, TxnInst, Opts, &TmpStats);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Stats != NULL) {
+		*Stats = TmpStats;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API registers the handler of a custom operation. The handler runs on the
+* host whenever a command with the custom opcode is executed, when a
+* transaction is flushed or submitted and when a serialized transaction is
+* replayed. When the backend submits transactions to a firmware or kernel
+* driver, the submission is split at the custom operations with a handler.
+*
+* @param	DevInst: Device instance pointer.
+* @param	OpNumber: Custom opcode, XAIE_IO_CUSTOM_OP_BEGIN or above.
+* @param	Handler: Handler of the operation. NULL removes the registered
+*		handler.
+* @param	Priv: Private data passed to the handler.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Handlers shall be registered before transactions using the
+*		custom operation are submitted.
+*
+******************************************************************************/
+AieRC XAie_RegisterCustomTxnOpHandler(XAie_DevInst *DevInst, u8 OpNumber,
+		XAie_TxnCustomOpHandler Handler, void *Priv)
+{
+	XAie_TxnCustomOps *CustomOps;
+	XAie_TxnCustomOpEntry *Entry;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(OpNumber < (u8)XAIE_IO_CUSTOM_OP_BEGIN) {
+		XAIE_ERROR("Invalid custom op %d\n", OpNumber);
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_MutexLock(DevInst->TxnListLock);
+
+	CustomOps = DevInst->TxnCustomOps;
+	if(CustomOps == NULL) {
+		if(Handler == NULL) {
+			_XAie_MutexUnlock(DevInst->TxnListLock);
+			return XAIE_OK;
+		}
+
+		CustomOps = (XAie_TxnCustomOps *)calloc(1U,
+				sizeof(*CustomOps));
+		if(CustomOps == NULL) {
+			_XAie_MutexUnlock(DevInst->TxnListLock);
+			XAIE_ERROR("Failed to allocate memory for custom op "
+					"handlers\n");
+			return XAIE_ERR;
+		}
+		XAIE_ATOMIC_STORE(&DevInst->TxnCustomOps, CustomOps);
+	}
+
+	Entry = &CustomOps->Ops[OpNumber - (u8)XAIE_IO_CUSTOM_OP_BEGIN];
+	Entry->Priv = Priv;
+	XAIE_ATOMIC_STORE(&Entry->Handler, Handler);
+
+	_XAie_MutexUnlock(DevInst->TxnListLock);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API releases the custom op handlers of a device instance.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnCustomOpsFree(XAie_DevInst *DevInst)
+{
+	free(DevInst->TxnCustomOps);
+	DevInst->TxnCustomOps = NULL;
+}
+
+/*****************************************************************************/
+/**
+* This API appends a varint to a compact serialized transaction.
+*
+* @param        Buf: Pointer to the buffer or NULL to only compute the size
+* @param        Offset: Offset in the buffer to write to
+* @param        Val: Value to encode
+*
+* @return       Offset following the encoded value.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TxnPutVarint(u8 *Buf, u64 Offset, u64 Val)
+{
+	do {
+		u8 Byte = (u8)(Val & 0x7FU);
+
+		Val >>= 7U;
+		if(Val != 0U) {
+			Byte |= 0x80U;
+		}
+		if(Buf != NULL) {
+			Buf[Offset] = Byte;
+		}
+		Offset++;
+	} while(Val != 0U);
+
+	return Offset;
+}
+
+/*****************************************************************************/
+/**
+* This API appends the delta of a register offset from the end of the previous
+* access to a compact serialized transaction.
+*
+* @param        Buf: Pointer to the buffer or NULL to only compute the size
+* @param        Offset: Offset in the buffer to write to
+* @param        PrevOff: Pointer to the end of the previous access
+* @param        RegOff: Register offset of the access
+* @param        NumWords: Number of words accessed
+*
+* @return       Offset following the encoded delta.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TxnPutDelta(u8 *Buf, u64 Offset, u64 *PrevOff, u64 RegOff,
+		u32 NumWords)
+{
+	u64 Delta = RegOff - *PrevOff;
+
+	*PrevOff = RegOff + (u64)NumWords * sizeof(u32);
+
+	/* Zigzag encoding keeps small negative deltas short */
+	return _XAie_TxnPutVarint(Buf, Offset, (Delta << 1U) ^
+			(~(Delta >> 63U) + 1U));
+}
+
+/*****************************************************************************/
+/**
+* This API returns a word written by a run of full writes or a block write.
+*
+* @param        Cmd: Pointer to the block write or to the first write of the run
+* @param        Idx: Index of the word
+*
+* @return       Value of the word.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u32 _XAie_TxnCompactWord(const XAie_TxnCmd *Cmd, u32 Idx)
+{
+	if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+		return ((const u32 *)(uintptr_t)Cmd->DataPtr)[Idx];
+	}
+
+	return Cmd[Idx].Value;
+}
+
+/*****************************************************************************/
+/**
+* This API appends a run length encoded word stream to a compact serialized
+* transaction.
+*
+* @param        Buf: Pointer to the buffer or NULL to only compute the size
+* @param        Offset: Offset in the buffer to write to
+* @param        Cmd: Pointer to the block write or to the first write of the run
+* @param        NumWords: Number of words
+*
+* @return       Offset following the encoded words.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TxnPutWords(u8 *Buf, u64 Offset, const XAie_TxnCmd *Cmd,
+		u32 NumWords)
+{
+	u32 i = 0U;
+
+	while(i < NumWords) {
+		u32 Value = _XAie_TxnCompactWord(Cmd, i);
+		u32 Repeat = 1U;
+
+		while((i + Repeat < NumWords) &&
+				(_XAie_TxnCompactWord(Cmd, i + Repeat) == Value)) {
+			Repeat++;
+		}
+
+		Offset = _XAie_TxnPutVarint(Buf, Offset, Repeat);
+		Offset = _XAie_TxnPutVarint(Buf, Offset, Value);
+		i += Repeat;
+	}
+
+	return Offset;
+}
+
+/*****************************************************************************/
+/**
+* This API encodes the commands of a transaction instance in the compact
+* serialized format. Runs of full writes to consecutive registers are encoded
+* as a single record.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Buf: Pointer to the buffer following the transaction header or
+*		NULL to only compute the size.
+* @param        NumRecs: Pointer to return the number of records
+*
+* @return       Size of the encoded records in bytes.
+*
+* @note         Internal only. Shim DMA commands have no serialized form and
+*		are skipped.
+*
+******************************************************************************/
+u64 _XAie_TxnCompactEncode(const XAie_TxnInst *TxnInst, u8 *Buf, u32 *NumRecs)
+{
+	u64 Offset = 0U, PrevOff = 0U;
+	u32 i = 0U;
+
+	*NumRecs = 0U;
+	while(i < TxnInst->NumCmds) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u32 Count = 1U;
+		u8 Tag;
+
+		if((Cmd->Opcode == XAIE_IO_WRITE) && (Cmd->Mask == 0U)) {
+			while((i + Count < TxnInst->NumCmds) &&
+					(Count < XAIE_TXN_COMPACT_MAX_WORDS) &&
+					(Cmd[Count].Opcode == XAIE_IO_WRITE) &&
+					(Cmd[Count].Mask == 0U) &&
+					(Cmd[Count].RegOff == Cmd->RegOff +
+					 (u64)Count * sizeof(u32))) {
+				Count++;
+			}
+			Tag = (Count > 1U) ? XAIE_TXN_COMPACT_WRITE_RUN :
+				XAIE_TXN_COMPACT_WRITE;
+		} else if(Cmd->Opcode == XAIE_IO_WRITE) {
+			Tag = XAIE_TXN_COMPACT_MASKWRITE;
+		} else if(Cmd->Opcode == XAIE_IO_MASKPOLL) {
+			Tag = XAIE_TXN_COMPACT_MASKPOLL;
+		} else if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			Tag = XAIE_TXN_COMPACT_BLOCKWRITE;
+		} else if(Cmd->Opcode == XAIE_IO_BLOCKSET) {
+			Tag = XAIE_TXN_COMPACT_BLOCKSET;
+		} else if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+			Tag = XAIE_TXN_COMPACT_CUSTOM;
+		} else {
+			i++;
+			continue;
+		}
+
+		if(Buf != NULL) {
+			Buf[Offset] = Tag;
+		}
+		Offset++;
+
+		switch(Tag) {
+		case XAIE_TXN_COMPACT_WRITE:
+			Offset = _XAie_TxnPutDelta(Buf, Offset, &PrevOff,
+					Cmd->RegOff, 1U);
+			Offset = _XAie_TxnPutVarint(Buf, Offset, Cmd->Value);
+			break;
+		case XAIE_TXN_COMPACT_WRITE_RUN:
+			Offset = _XAie_TxnPutDelta(Buf, Offset, &PrevOff,
+					Cmd->RegOff, Count);
+			Offset = _XAie_TxnPutVarint(Buf, Offset, Count);
+			Offset = _XAie_TxnPutWords(Buf, Offset, Cmd, Count);
+			break;
+		case XAIE_TXN_COMPACT_BLOCKWRITE:
+		case XAIE_TXN_COMPACT_BLOCKSET:
+		{
+			XAie_TxnCmd Part = *Cmd;
+			u32 Left = Cmd->Size;
+
+			/* Blocks longer than a record are split in records */
+			while(1) {
+				Part.Size = Left;
+				if(Part.Size > XAIE_TXN_COMPACT_MAX_WORDS) {
+					Part.Size = XAIE_TXN_COMPACT_MAX_WORDS;
+				}
+				Offset = _XAie_TxnPutDelta(Buf, Offset, &PrevOff,
+						Part.RegOff, Part.Size);
+				Offset = _XAie_TxnPutVarint(Buf, Offset,
+						Part.Size);
+				if(Tag == XAIE_TXN_COMPACT_BLOCKWRITE) {
+					Offset = _XAie_TxnPutWords(Buf, Offset,
+							&Part, Part.Size);
+				} else {
+					Offset = _XAie_TxnPutVarint(Buf, Offset,
+							Part.Value);
+				}
+
+				Left -= Part.Size;
+				if(Left == 0U) {
+					break;
+				}
+
+				Part.RegOff += (u64)Part.Size * sizeof(u32);
+				Part.DataPtr += (u64)Part.Size * sizeof(u32);
+				if(Buf != NULL) {
+					Buf[Offset] = Tag;
+				}
+				Offset++;
+				(*NumRecs)++;
+			}
+			break;
+		}
+		case XAIE_TXN_COMPACT_MASKWRITE:
+		case XAIE_TXN_COMPACT_MASKPOLL:
+			Offset = _XAie_TxnPutDelta(Buf, Offset, &PrevOff,
+					Cmd->RegOff, 1U);
+			Offset = _XAie_TxnPutVarint(Buf, Offset, Cmd->Mask);
+			Offset = _XAie_TxnPutVarint(Buf, Offset, Cmd->Value);
+			break;
+		default:
+			if(Buf != NULL) {
+				Buf[Offset] = (u8)Cmd->Opcode;
+			}
+			Offset++;
+			Offset = _XAie_TxnPutVarint(Buf, Offset, Cmd->Size);
+			if(Buf != NULL) {
+				memcpy(&Buf[Offset],
+					(const void *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			}
+			Offset += Cmd->Size;
+			break;
+		}
+
+		(*NumRecs)++;
+		i += Count;
+	}
+
+	return Offset;
+}
+
+/*****************************************************************************/
+/**
+* This API reads a varint from a compact serialized transaction.
+*
+* @param        Buf: Pointer to the encoded records
+* @param        Size: Size of the encoded records in bytes
+* @param        Offset: Pointer to the offset to read from, updated on return
+* @param        Max: Maximum valid value
+* @param        Val: Pointer to return the value
+*
+* @return       XAIE_OK on success, XAIE_INVALID_ARGS if the varint is
+*		truncated or out of range.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnGetVarint(const u8 *Buf, u32 Size, u32 *Offset, u64 Max,
+		u64 *Val)
+{
+	u64 Tmp = 0U;
+
+	for(u32 i = 0U; i < XAIE_TXN_VARINT_MAX_BYTES; i++) {
+		u8 Byte;
+
+		if(*Offset >= Size) {
+			break;
+		}
+
+		Byte = Buf[(*Offset)++];
+		Tmp |= (u64)(Byte & 0x7FU) << (7U * i);
+		if((Byte & 0x80U) == 0U) {
+			if(Tmp > Max) {
+				break;
+			}
+			*Val = Tmp;
+			return XAIE_OK;
+		}
+	}
+
+	XAIE_ERROR("Invalid varint in compact transaction\n");
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+* This API reads a register offset delta from a compact serialized transaction.
+*
+* @param        Buf: Pointer to the encoded records
+* @param        Size: Size of the encoded records in bytes
+* @param        Offset: Pointer to the offset to read from, updated on return
+* @param        PrevOff: Pointer to the end of the previous access
+* @param        NumWords: Number of words accessed
+* @param        RegOff: Pointer to return the register offset
+*
+* @return       XAIE_OK on success, error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnGetDelta(const u8 *Buf, u32 Size, u32 *Offset,
+		u64 *PrevOff, u32 NumWords, u64 *RegOff)
+{
+	u64 Val;
+	AieRC RC;
+
+	RC = _XAie_TxnGetVarint(Buf, Size, Offset, UINT64_MAX, &Val);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	*RegOff = *PrevOff + ((Val >> 1U) ^ (~(Val & 1U) + 1U));
+	*PrevOff = *RegOff + (u64)NumWords * sizeof(u32);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API reads the next (repeat, value) pair of a word stream.
+*
+* @param        Buf: Pointer to the encoded records
+* @param        Size: Size of the encoded records in bytes
+* @param        Offset: Pointer to the offset to read from, updated on return
+* @param        Left: Number of words left in the stream
+* @param        Repeat: Pointer to return the repeat count
+* @param        Value: Pointer to return the value
+*
+* @return       XAIE_OK on success, error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnGetWordRun(const u8 *Buf, u32 Size, u32 *Offset,
+		u32 Left, u32 *Repeat, u32 *Value)
+{
+	u64 Val;
+	AieRC RC;
+
+	RC = _XAie_TxnGetVarint(Buf, Size, Offset, Left, &Val);
+	if((RC != XAIE_OK) || (Val == 0U)) {
+		XAIE_ERROR("Invalid word stream in compact transaction\n");
+		return XAIE_INVALID_ARGS;
+	}
+	*Repeat = (u32)Val;
+
+	RC = _XAie_TxnGetVarint(Buf, Size, Offset, UINT32_MAX, &Val);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+	*Value = (u32)Val;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API accounts memory of commands and payloads decoded from a compact
+* serialized transaction against the limit of the format.
+*
+* @param        Decoded: Pointer to the number of bytes decoded so far
+* @param        Bytes: Number of bytes to decode
+*
+* @return       XAIE_OK on success, XAIE_INVALID_ARGS if the limit is exceeded.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnCompactReserve(u64 *Decoded, u64 Bytes)
+{
+	if(Bytes > XAIE_TXN_COMPACT_MAX_DECODED - *Decoded) {
+		XAIE_ERROR("Compact transaction decodes to more than %u "
+				"bytes\n", XAIE_TXN_COMPACT_MAX_DECODED);
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Decoded += Bytes;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API decodes the records of a compact serialized transaction and appends
+* the commands to a transaction instance.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Buf: Pointer to the records following the transaction header
+* @param        Size: Size of the records in bytes
+* @param        NumRecs: Number of records
+*
+* @return       XAIE_OK on success, error code on failure.
+*
+* @note         Internal only. Payloads are allocated from the arena of the
+*		transaction instance. Records are rejected if they claim more
+*		words than XAIE_TXN_COMPACT_MAX_WORDS, and the blob if it
+*		decodes to more than XAIE_TXN_COMPACT_MAX_DECODED bytes of
+*		commands and payloads, before the memory is allocated.
+*
+******************************************************************************/
+AieRC _XAie_TxnCompactDecode(XAie_TxnInst *TxnInst, const u8 *Buf, u32 Size,
+		u32 NumRecs)
+{
+	u64 PrevOff = 0U, Decoded = 0U, Count, Mask, Value;
+	u32 Offset = 0U;
+	AieRC RC = XAIE_OK;
+
+	/* Every record takes a tag and at least one varint byte */
+	if(NumRecs > Size / 2U) {
+		XAIE_ERROR("Compact transaction of %u bytes cannot hold %u "
+				"records\n", Size, NumRecs);
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 r = 0U; (r < NumRecs) && (RC == XAIE_OK); r++) {
+		XAie_TxnCmd *Cmd;
+		u64 RegOff;
+		u8 Tag;
+
+		if(Offset >= Size) {
+			XAIE_ERROR("Truncated compact transaction\n");
+			return XAIE_INVALID_ARGS;
+		}
+		Tag = Buf[Offset++];
+
+		/* Each record decodes to at least one command */
+		RC = _XAie_TxnCompactReserve(&Decoded, sizeof(XAie_TxnCmd));
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		switch(Tag) {
+		case XAIE_TXN_COMPACT_WRITE:
+			RC = _XAie_TxnGetDelta(Buf, Size, &Offset, &PrevOff, 1U,
+					&RegOff);
+			if(RC == XAIE_OK) {
+				RC = _XAie_TxnGetVarint(Buf, Size, &Offset,
+						UINT32_MAX, &Value);
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+			Cmd = _XAie_TxnAllocCmd(TxnInst);
+			if(Cmd == NULL) {
+				return XAIE_ERR;
+			}
+			Cmd->Opcode = XAIE_IO_WRITE;
+			Cmd->RegOff = RegOff;
+			Cmd->Value = (u32)Value;
+			break;
+		case XAIE_TXN_COMPACT_WRITE_RUN:
+		case XAIE_TXN_COMPACT_BLOCKWRITE:
+		{
+			u32 *Data = NULL;
+			u32 Filled = 0U;
+
+			RC = _XAie_TxnGetDelta(Buf, Size, &Offset, &PrevOff, 0U,
+					&RegOff);
+			if(RC == XAIE_OK) {
+				RC = _XAie_TxnGetVarint(Buf, Size, &Offset,
+						XAIE_TXN_COMPACT_MAX_WORDS,
+						&Count);
+			}
+			if((RC == XAIE_OK) && (Offset >= Size) && (Count > 0U)) {
+				XAIE_ERROR("Truncated compact transaction\n");
+				RC = XAIE_INVALID_ARGS;
+			}
+			/* Runs decode to commands, blocks to payloads */
+			if((RC == XAIE_OK) &&
+					(Tag == XAIE_TXN_COMPACT_BLOCKWRITE)) {
+				RC = _XAie_TxnCompactReserve(&Decoded,
+						Count * sizeof(u32));
+			} else if(RC == XAIE_OK) {
+				RC = _XAie_TxnCompactReserve(&Decoded,
+						Count * sizeof(XAie_TxnCmd));
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+			PrevOff = RegOff + Count * sizeof(u32);
+
+			if(Tag == XAIE_TXN_COMPACT_BLOCKWRITE) {
+				Cmd = _XAie_TxnAllocCmd(TxnInst);
+				if(Cmd == NULL) {
+					return XAIE_ERR;
+				}
+				Data = (u32 *)_XAie_TxnPayloadAlloc(TxnInst,
+						Count * sizeof(u32));
+				if(Data == NULL) {
+					return XAIE_ERR;
+				}
+				Cmd->Opcode = XAIE_IO_BLOCKWRITE;
+				Cmd->RegOff = RegOff;
+				Cmd->Size = (u32)Count;
+				Cmd->DataPtr = (u64)(uintptr_t)Data;
+			}
+
+			while((Filled < Count) && (RC == XAIE_OK)) {
+				u32 Repeat, Word;
+
+				RC = _XAie_TxnGetWordRun(Buf, Size, &Offset,
+						(u32)Count - Filled, &Repeat,
+						&Word);
+				for(u32 k = 0U; (RC == XAIE_OK) && (k < Repeat);
+						k++, Filled++) {
+					if(Data != NULL) {
+						Data[Filled] = Word;
+						continue;
+					}
+					Cmd = _XAie_TxnAllocCmd(TxnInst);
+					if(Cmd == NULL) {
+						return XAIE_ERR;
+					}
+					Cmd->Opcode = XAIE_IO_WRITE;
+					Cmd->RegOff = RegOff +
+						(u64)Filled * sizeof(u32);
+					Cmd->Value = Word;
+				}
+			}
+			break;
+		}
+		case XAIE_TXN_COMPACT_BLOCKSET:
+			RC = _XAie_TxnGetDelta(Buf, Size, &Offset, &PrevOff, 0U,
+					&RegOff);
+			if(RC == XAIE_OK) {
+				RC = _XAie_TxnGetVarint(Buf, Size, &Offset,
+						XAIE_TXN_COMPACT_MAX_WORDS,
+						&Count);
+			}
+			if(RC == XAIE_OK) {
+				RC = _XAie_TxnGetVarint(Buf, Size, &Offset,
+						UINT32_MAX, &Value);
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+			PrevOff = RegOff + Count * sizeof(u32);
+			Cmd = _XAie_TxnAllocCmd(TxnInst);
+			if(Cmd == NULL) {
+				return XAIE_ERR;
+			}
+			Cmd->Opcode = XAIE_IO_BLOCKSET;
+			Cmd->RegOff = RegOff;
+			Cmd->Size = (u32)Count;
+			Cmd->Value = (u32)Value;
+			break;
+		case XAIE_TXN_COMPACT_MASKWRITE:
+		case XAIE_TXN_COMPACT_MASKPOLL:
+			RC = _XAie_TxnGetDelta(Buf, Size, &Offset, &PrevOff, 1U,
+					&RegOff);
+			if(RC == XAIE_OK) {
+				RC = _XAie_TxnGetVarint(Buf, Size, &Offset,
+						UINT32_MAX, &Mask);
+			}
+			if(RC == XAIE_OK) {
+				RC = _XAie_TxnGetVarint(Buf, Size, &Offset,
+						UINT32_MAX, &Value);
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+			Cmd = _XAie_TxnAllocCmd(TxnInst);
+			if(Cmd == NULL) {
+				return XAIE_ERR;
+			}
+			/* Masked writes are recorded as writes with a mask */
+			Cmd->Opcode = (Tag == XAIE_TXN_COMPACT_MASKPOLL) ?
+				XAIE_IO_MASKPOLL : XAIE_IO_WRITE;
+			Cmd->RegOff = RegOff;
+			Cmd->Mask = (u32)Mask;
+			Cmd->Value = (u32)Value;
+			break;
+		case XAIE_TXN_COMPACT_CUSTOM:
+		{
+			void *Payload;
+			u8 Opcode;
+
+			if(Offset >= Size) {
+				RC = XAIE_INVALID_ARGS;
+				break;
+			}
+			Opcode = Buf[Offset++];
+			RC = _XAie_TxnGetVarint(Buf, Size, &Offset,
+					Size - Offset, &Count);
+			if((RC != XAIE_OK) ||
+					(Opcode < (u8)XAIE_IO_CUSTOM_OP_BEGIN) ||
+					(Count > Size - Offset)) {
+				RC = XAIE_INVALID_ARGS;
+				break;
+			}
+			RC = _XAie_TxnCompactReserve(&Decoded, Count);
+			if(RC != XAIE_OK) {
+				break;
+			}
+			Cmd = _XAie_TxnAllocCmd(TxnInst);
+			if(Cmd == NULL) {
+				return XAIE_ERR;
+			}
+			Payload = _XAie_TxnPayloadAlloc(TxnInst, Count);
+			if(Payload == NULL) {
+				return XAIE_ERR;
+			}
+			Cmd->Opcode = (XAie_TxnOpcode)Opcode;
+			Cmd->Size = (u32)Count;
+			Cmd->DataPtr = (u64)(uintptr_t)memcpy(Payload,
+					&Buf[Offset], Count);
+			Offset += (u32)Count;
+			break;
+		}
+		default:
+			XAIE_ERROR("Invalid compact transaction record tag "
+					"%d\n", Tag);
+			RC = XAIE_INVALID_ARGS;
+			break;
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to decode compact transaction\n");
+	}
+
+	return RC;
+}
+
+
+
+/*****************************************************************************/
+/**
+* This API returns the shadow entry of a register offset. The returned entry is
+* either the valid entry for the offset or the free entry where the offset is
+* to be inserted.
+*
+* @param        Shadow: Pointer to the shadow
+* @param        RegOff: Register offset
+*
+* @return       Pointer to the shadow entry.
+*
+* @note         Internal only. The shadow is never full as it grows once half
+*		of its entries are used.
+*
+******************************************************************************/
+static XAie_TxnShadowEntry* _XAie_TxnShadowFind(XAie_TxnShadow *Shadow,
+		u64 RegOff)
+{
+	u32 Idx = (u32)((RegOff >> 2U) * 0x9E3779B1U) & (Shadow->Size - 1U);
+
+	while(Shadow->Entries[Idx].Epoch == Shadow->Epoch) {
+		if(Shadow->Entries[Idx].RegOff == RegOff) {
+			break;
+		}
+		Idx = (Idx + 1U) & (Shadow->Size - 1U);
+	}
+
+	return &Shadow->Entries[Idx];
+}
+
+/*****************************************************************************/
+/**
+* This API doubles the number of entries of the shadow.
+*
+* @param        Shadow: Pointer to the shadow
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnShadowGrow(XAie_TxnShadow *Shadow)
+{
+	XAie_TxnShadowEntry *Old = Shadow->Entries;
+	u32 OldSize = Shadow->Size;
+	u32 OldEpoch = Shadow->Epoch;
+
+	Shadow->Entries = (XAie_TxnShadowEntry *)calloc(OldSize * 2U,
+			sizeof(*Shadow->Entries));
+	if(Shadow->Entries == NULL) {
+		XAIE_ERROR("Failed to allocate memory for transaction "
+				"shadow\n");
+		Shadow->Entries = Old;
+		return XAIE_ERR;
+	}
+	Shadow->Size = OldSize * 2U;
+	Shadow->Epoch = 1U;
+
+	for(u32 i = 0U; i < OldSize; i++) {
+		if(Old[i].Epoch == OldEpoch) {
+			XAie_TxnShadowEntry *Entry;
+
+			Entry = _XAie_TxnShadowFind(Shadow, Old[i].RegOff);
+			*Entry = Old[i];
+			Entry->Epoch = Shadow->Epoch;
+		}
+	}
+	free(Old);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the value of a register written by the latest large block
+* command covering the register.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Register offset
+* @param        Value: Pointer to store the value
+* @param        Seq: Pointer to store the index of the block command
+*
+* @return       XAIE_ENABLE if a block command covers the register,
+*		XAIE_DISABLE otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TxnShadowRangeValue(const XAie_TxnInst *TxnInst, u64 RegOff,
+		u32 *Value, u32 *Seq)
+{
+	const XAie_TxnShadow *Shadow = TxnInst->Shadow;
+	const XAie_TxnShadowRange *Range;
+	const XAie_TxnCmd *Cmd;
+
+	for(u32 i = Shadow->NumRanges; i > 0U; i--) {
+		Range = &Shadow->Ranges[i - 1U];
+		if((RegOff < Range->Start) || (RegOff >= Range->End)) {
+			continue;
+		}
+
+		Cmd = &TxnInst->CmdBuf[Range->CmdIdx];
+		if(Cmd->Opcode == XAIE_IO_BLOCKSET) {
+			*Value = Cmd->Value;
+		} else {
+			*Value = ((const u32 *)(uintptr_t)Cmd->DataPtr)
+				[(RegOff - Range->Start) / 4U];
+		}
+		*Seq = Range->CmdIdx;
+
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API applies a write of the bits of a register to the shadow.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Register offset
+* @param        Mask: Mask of the written bits
+* @param        Value: Written value
+* @param        Seq: Index of the command
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnShadowSet(XAie_TxnInst *TxnInst, u64 RegOff, u32 Mask,
+		u32 Value, u32 Seq)
+{
+	XAie_TxnShadow *Shadow = TxnInst->Shadow;
+	XAie_TxnShadowEntry *Entry;
+	u32 RangeVal, RangeSeq;
+
+	if((Shadow->Count + 1U) * 2U > Shadow->Size) {
+		AieRC RC = _XAie_TxnShadowGrow(Shadow);
+
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	Entry = _XAie_TxnShadowFind(Shadow, RegOff);
+	if(Entry->Epoch != Shadow->Epoch) {
+		Entry->RegOff = RegOff;
+		Entry->Known = 0U;
+		Entry->Epoch = Shadow->Epoch;
+		Entry->Seq = 0U;
+		Shadow->Count++;
+	}
+
+	/* Bits not written by this command come from a later block */
+	if((Mask != XAIE_TXN_OPT_FULL_MASK) && (Shadow->NumRanges > 0U) &&
+			_XAie_TxnShadowRangeValue(TxnInst, RegOff, &RangeVal,
+				&RangeSeq) &&
+			((Entry->Known == 0U) || (RangeSeq > Entry->Seq))) {
+		Entry->Value = RangeVal;
+		Entry->Known = XAIE_TXN_OPT_FULL_MASK;
+	}
+
+	Entry->Value = (Entry->Value & ~Mask) | (Value & Mask);
+	Entry->Known |= Mask;
+	Entry->Seq = Seq;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API applies a block write or block set command to the shadow. Large
+* blocks are tracked as ranges resolved from the command payload on reads.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Cmd: Pointer to the command
+* @param        Seq: Index of the command
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnShadowSetBlock(XAie_TxnInst *TxnInst,
+		const XAie_TxnCmd *Cmd, u32 Seq)
+{
+	XAie_TxnShadow *Shadow = TxnInst->Shadow;
+	XAie_TxnShadowRange *Range;
+	const u32 *Data = (const u32 *)(uintptr_t)Cmd->DataPtr;
+	AieRC RC;
+
+	if(Cmd->Size <= XAIE_TXN_SHADOW_MAX_BLOCK_WORDS) {
+		for(u32 i = 0U; i < Cmd->Size; i++) {
+			RC = _XAie_TxnShadowSet(TxnInst,
+					Cmd->RegOff + (u64)i * 4U,
+					XAIE_TXN_OPT_FULL_MASK,
+					(Cmd->Opcode == XAIE_IO_BLOCKSET) ?
+					Cmd->Value : Data[i], Seq);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		return XAIE_OK;
+	}
+
+	if(Shadow->NumRanges == Shadow->MaxRanges) {
+		u32 MaxRanges = (Shadow->MaxRanges == 0U) ?
+			XAIE_TXN_SHADOW_DEFAULT_RANGES : Shadow->MaxRanges * 2U;
+
+		Range = (XAie_TxnShadowRange *)realloc(Shadow->Ranges,
+				sizeof(*Range) * MaxRanges);
+		if(Range == NULL) {
+			XAIE_ERROR("Failed to allocate memory for transaction "
+					"shadow\n");
+			return XAIE_ERR;
+		}
+		Shadow->Ranges = Range;
+		Shadow->MaxRanges = MaxRanges;
+	}
+
+	Range = &Shadow->Ranges[Shadow->NumRanges++];
+	Range->Start = Cmd->RegOff;
+	Range->End = Cmd->RegOff + (u64)Cmd->Size * 4U;
+	Range->CmdIdx = Seq;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API invalidates the shadow of a transaction instance. It is called
+* whenever the pending commands are flushed or rewritten.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnShadowReset(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnShadow *Shadow = TxnInst->Shadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	Shadow->Count = 0U;
+	Shadow->NumRanges = 0U;
+	Shadow->NumCmds = 0U;
+	Shadow->Opaque = XAIE_DISABLE;
+	Shadow->Epoch++;
+	if(Shadow->Epoch == 0U) {
+		memset(Shadow->Entries, 0,
+				sizeof(*Shadow->Entries) * Shadow->Size);
+		Shadow->Epoch = 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API releases the shadow of a transaction instance.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnShadowFree(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnShadow *Shadow = TxnInst->Shadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	free(Shadow->Entries);
+	free(Shadow->Ranges);
+	free(Shadow);
+	TxnInst->Shadow = NULL;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the bits of a register written by the pending commands of a
+* transaction. The shadow is allocated on the first call and brought up to
+* date with the commands recorded since the previous call.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Register offset
+* @param        Value: Pointer to store the written value
+* @param        Known: Pointer to store the mask of the written bits
+* @param        Opaque: Pointer to store if pending commands have effects
+*		unknown to the shadow, such as custom operations.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnShadowRead(XAie_TxnInst *TxnInst, u64 RegOff, u32 *Value,
+		u32 *Known, u8 *Opaque)
+{
+	XAie_TxnShadow *Shadow = TxnInst->Shadow;
+	const XAie_TxnShadowEntry *Entry;
+	u32 RangeVal, RangeSeq;
+	AieRC RC = XAIE_OK;
+
+	if(Shadow == NULL) {
+		Shadow = (XAie_TxnShadow *)calloc(1U, sizeof(*Shadow));
+		if(Shadow == NULL) {
+			XAIE_ERROR("Failed to allocate memory for transaction "
+					"shadow\n");
+			return XAIE_ERR;
+		}
+
+		Shadow->Entries = (XAie_TxnShadowEntry *)calloc(
+				XAIE_TXN_SHADOW_DEFAULT_SIZE,
+				sizeof(*Shadow->Entries));
+		if(Shadow->Entries == NULL) {
+			XAIE_ERROR("Failed to allocate memory for transaction "
+					"shadow\n");
+			free(Shadow);
+			return XAIE_ERR;
+		}
+		Shadow->Size = XAIE_TXN_SHADOW_DEFAULT_SIZE;
+		Shadow->Epoch = 1U;
+		TxnInst->Shadow = Shadow;
+	}
+
+	for(; Shadow->NumCmds < TxnInst->NumCmds; Shadow->NumCmds++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[Shadow->NumCmds];
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+		case XAIE_IO_MASKWRITE:
+			RC = _XAie_TxnShadowSet(TxnInst, Cmd->RegOff,
+					(Cmd->Mask == 0U) ?
+					XAIE_TXN_OPT_FULL_MASK : Cmd->Mask,
+					Cmd->Value, Shadow->NumCmds);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+		case XAIE_IO_BLOCKSET:
+			RC = _XAie_TxnShadowSetBlock(TxnInst, Cmd,
+					Shadow->NumCmds);
+			break;
+		case XAIE_IO_MASKPOLL:
+			break;
+		default:
+			Shadow->Opaque = XAIE_ENABLE;
+			break;
+		}
+
+		if(RC != XAIE_OK) {
+			_XAie_TxnShadowReset(TxnInst);
+			return RC;
+		}
+	}
+
+	Entry = _XAie_TxnShadowFind(Shadow, RegOff);
+	if(Entry->Epoch == Shadow->Epoch) {
+		*Value = Entry->Value;
+		*Known = Entry->Known;
+	} else {
+		*Value = 0U;
+		*Known = 0U;
+	}
+
+	if((Shadow->NumRanges > 0U) &&
+			_XAie_TxnShadowRangeValue(TxnInst, RegOff, &RangeVal,
+				&RangeSeq) &&
+			((*Known == 0U) || (RangeSeq > Entry->Seq))) {
+		*Value = RangeVal;
+		*Known = XAIE_TXN_OPT_FULL_MASK;
+	}
+	*Opaque = Shadow->Opaque;
+
+	return XAIE_OK;
+}
+/*****************************************************************************/
+/**
+* This API appends a location to the locations of a template.
+*
+* @param        Tmpl: Pointer to the template
+* @param        CmdIdx: Index of the command
+* @param        WordIdx: Index of the word in the command payload
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnTemplateAddLoc(XAie_TxnTemplate *Tmpl, u32 CmdIdx,
+		u32 WordIdx)
+{
+	if(Tmpl->NumLocs == Tmpl->MaxLocs) {
+		u32 MaxLocs = (Tmpl->MaxLocs == 0U) ?
+			XAIE_TXN_TEMPLATE_DEFAULT_LOCS : Tmpl->MaxLocs * 2U;
+		XAie_TxnTemplateLoc *Locs;
+
+		Locs = (XAie_TxnTemplateLoc *)realloc(Tmpl->Locs,
+				sizeof(*Locs) * MaxLocs);
+		if(Locs == NULL) {
+			XAIE_ERROR("Failed to allocate memory for template "
+					"locations\n");
+			return XAIE_ERR;
+		}
+		Tmpl->Locs = Locs;
+		Tmpl->MaxLocs = MaxLocs;
+	}
+
+	Tmpl->Locs[Tmpl->NumLocs].CmdIdx = CmdIdx;
+	Tmpl->Locs[Tmpl->NumLocs].WordIdx = WordIdx;
+	Tmpl->NumLocs++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API finds the slot of a template with the given name.
+*
+* @param        Tmpl: Pointer to the template
+* @param        Name: Name of the slot
+*
+* @return       Pointer to the slot if found, NULL otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static XAie_TxnTemplateSlot* _XAie_TxnTemplateFindSlot(XAie_TxnTemplate *Tmpl,
+		const char *Name)
+{
+	for(u32 i = 0U; i < Tmpl->NumSlots; i++) {
+		if((Tmpl->Slots[i].Name[0] != '\0') &&
+				(strcmp(Tmpl->Slots[i].Name, Name) == 0)) {
+			return &Tmpl->Slots[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+* This API creates a slot of a template for all the recorded full, masked and
+* block writes to a register.
+*
+* @param        Tmpl: Pointer to the template
+* @param        Name: Name of the slot. Empty for unnamed slots.
+* @param        RegOff: Register offset of the patched field
+* @param        Mask: Mask of the patched field
+* @param        Shift: Right shift applied to slot values
+* @param        SlotIdx: Pointer to store the index of the slot
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnTemplateNewSlot(XAie_TxnTemplate *Tmpl,
+		const char *Name, u64 RegOff, u32 Mask, u8 Shift, u32 *SlotIdx)
+{
+	const XAie_TxnInst *TxnInst = Tmpl->TxnInst;
+	XAie_TxnTemplateSlot *Slot;
+	u32 FirstLoc = Tmpl->NumLocs;
+	AieRC RC;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if((Cmd->Opcode == XAIE_IO_WRITE) ||
+				(Cmd->Opcode == XAIE_IO_MASKWRITE)) {
+			if(Cmd->RegOff != RegOff) {
+				continue;
+			}
+			if((Cmd->Mask != 0U) && ((Cmd->Mask & Mask) != Mask)) {
+				XAIE_ERROR("Masked write to 0x%lx does not "
+						"cover the slot field\n",
+						RegOff);
+				Tmpl->NumLocs = FirstLoc;
+				return XAIE_INVALID_ARGS;
+			}
+			RC = _XAie_TxnTemplateAddLoc(Tmpl, i, 0U);
+		} else if((Cmd->Opcode == XAIE_IO_BLOCKWRITE) ||
+				(Cmd->Opcode == XAIE_IO_BLOCKSET)) {
+			if((RegOff < Cmd->RegOff) || (RegOff >= Cmd->RegOff +
+					(u64)Cmd->Size * sizeof(u32)) ||
+					((RegOff - Cmd->RegOff) % 4U) != 0U) {
+				continue;
+			}
+			if(Cmd->Opcode == XAIE_IO_BLOCKSET) {
+				XAIE_ERROR("Register 0x%lx is written by a "
+						"block set\n", RegOff);
+				Tmpl->NumLocs = FirstLoc;
+				return XAIE_INVALID_ARGS;
+			}
+			RC = _XAie_TxnTemplateAddLoc(Tmpl, i,
+					(u32)((RegOff - Cmd->RegOff) / 4U));
+		} else {
+			continue;
+		}
+
+		if(RC != XAIE_OK) {
+			Tmpl->NumLocs = FirstLoc;
+			return RC;
+		}
+	}
+
+	if(Tmpl->NumLocs == FirstLoc) {
+		XAIE_ERROR("No write to register 0x%lx in transaction\n",
+				RegOff);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Tmpl->NumSlots == Tmpl->MaxSlots) {
+		u32 MaxSlots = (Tmpl->MaxSlots == 0U) ?
+			XAIE_TXN_TEMPLATE_DEFAULT_SLOTS : Tmpl->MaxSlots * 2U;
+		XAie_TxnTemplateSlot *Slots;
+
+		Slots = (XAie_TxnTemplateSlot *)realloc(Tmpl->Slots,
+				sizeof(*Slots) * MaxSlots);
+		if(Slots == NULL) {
+			XAIE_ERROR("Failed to allocate memory for template "
+					"slots\n");
+			Tmpl->NumLocs = FirstLoc;
+			return XAIE_ERR;
+		}
+		Tmpl->Slots = Slots;
+		Tmpl->MaxSlots = MaxSlots;
+	}
+
+	Slot = &Tmpl->Slots[Tmpl->NumSlots];
+	memset(Slot->Name, 0, sizeof(Slot->Name));
+	strncpy(Slot->Name, Name, XAIE_TXN_TEMPLATE_NAME_MAX - 1U);
+	Slot->Mask = Mask;
+	Slot->Shift = Shift;
+	Slot->FirstLoc = FirstLoc;
+	Slot->NumLocs = Tmpl->NumLocs - FirstLoc;
+	Slot->HighSlot = XAIE_TXN_TEMPLATE_INVALID_SLOT;
+	*SlotIdx = Tmpl->NumSlots;
+	Tmpl->NumSlots++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API patches a value into all the locations of a template slot and of
+* its high address slot.
+*
+* @param        Tmpl: Pointer to the template
+* @param        Slot: Pointer to the slot
+* @param        Value: Value of the slot
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnTemplatePatchSlot(XAie_TxnTemplate *Tmpl,
+		const XAie_TxnTemplateSlot *Slot, u64 Value)
+{
+	u32 Lsb = 0U;
+	u32 FldVal;
+
+	while(((Slot->Mask >> Lsb) & 0x1U) == 0U) {
+		Lsb++;
+	}
+	FldVal = XAie_SetField(Value >> Slot->Shift, Lsb, Slot->Mask);
+
+	for(u32 i = 0U; i < Slot->NumLocs; i++) {
+		const XAie_TxnTemplateLoc *Loc =
+			&Tmpl->Locs[Slot->FirstLoc + i];
+		XAie_TxnCmd *Cmd = &Tmpl->TxnInst->CmdBuf[Loc->CmdIdx];
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			u32 *Words = (u32 *)(uintptr_t)Cmd->DataPtr;
+
+			Words[Loc->WordIdx] = (Words[Loc->WordIdx] &
+					~Slot->Mask) | FldVal;
+		} else {
+			Cmd->Value = (Cmd->Value & ~Slot->Mask) | FldVal;
+		}
+	}
+
+	if(Slot->HighSlot != XAIE_TXN_TEMPLATE_INVALID_SLOT) {
+		_XAie_TxnTemplatePatchSlot(Tmpl, &Tmpl->Slots[Slot->HighSlot],
+				Value);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API creates the address slots of a shim DMA buffer descriptor.
+*
+* @param        Tmpl: Pointer to the template
+* @param        BdAddr: Register offset of the buffer descriptor
+* @param        Name: Name of the low address slot. Empty for slots of DDR
+*		patches.
+* @param        LowSlot: Pointer to store the index of the low address slot
+* @param        HighSlot: Pointer to store the index of the high address slot
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. The high address slot is unnamed and linked
+*		to the low address slot, so values of the low address slot are
+*		patched into both words.
+*
+******************************************************************************/
+static AieRC _XAie_TxnTemplateNewShimAddrSlots(XAie_TxnTemplate *Tmpl,
+		u64 BdAddr, const char *Name, u32 *LowSlot, u32 *HighSlot)
+{
+	const XAie_DevProp *DevProp = &Tmpl->DevInst->DevProp;
+	const XAie_DmaMod *DmaMod;
+	const XAie_RegBdFldAttr *AddrLow, *AddrHigh;
+	u32 NumSlots = Tmpl->NumSlots;
+	u32 NumLocs = Tmpl->NumLocs;
+	AieRC RC;
+
+	DmaMod = DevProp->DevMod[XAIEGBL_TILE_TYPE_SHIMNOC].DmaMod;
+	AddrLow = &DmaMod->BdProp->Buffer->ShimDmaBuff.AddrLow;
+	AddrHigh = &DmaMod->BdProp->Buffer->ShimDmaBuff.AddrHigh;
+
+	RC = _XAie_TxnTemplateNewSlot(Tmpl, Name,
+			BdAddr + AddrLow->Idx * 4U, AddrLow->Mask,
+			(u8)(AddrLow->Lsb + DmaMod->BdProp->AddrAlignShift),
+			LowSlot);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_TxnTemplateNewSlot(Tmpl, "",
+			BdAddr + AddrHigh->Idx * 4U, AddrHigh->Mask,
+			(u8)(32U + DmaMod->BdProp->AddrAlignShift), HighSlot);
+	if(RC != XAIE_OK) {
+		Tmpl->NumSlots = NumSlots;
+		Tmpl->NumLocs = NumLocs;
+		return RC;
+	}
+	Tmpl->Slots[*LowSlot].HighSlot = *HighSlot;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API creates the address slots of the DDR patch operations of the
+* transaction of a template. Patches of buffer descriptors which are not
+* recorded as register writes are skipped.
+*
+* @param        Tmpl: Pointer to the template
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnTemplateScanDdrPatches(XAie_TxnTemplate *Tmpl)
+{
+	const XAie_TxnInst *TxnInst = Tmpl->TxnInst;
+	u32 NumPatches = 0U;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		if(TxnInst->CmdBuf[i].Opcode == XAIE_IO_CUSTOM_OP_DDR_PATCH) {
+			NumPatches++;
+		}
+	}
+
+	if(NumPatches == 0U) {
+		return XAIE_OK;
+	}
+
+	Tmpl->Patches = (XAie_TxnTemplatePatch *)calloc(NumPatches,
+			sizeof(*Tmpl->Patches));
+	if(Tmpl->Patches == NULL) {
+		XAIE_ERROR("Failed to allocate memory for template patches\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		XAie_TxnTemplatePatch *Patch;
+		XAie_TxnDdrPatch Args;
+		AieRC RC;
+
+		if(Cmd->Opcode != XAIE_IO_CUSTOM_OP_DDR_PATCH) {
+			continue;
+		}
+
+		if(Cmd->Size < sizeof(Args)) {
+			XAIE_ERROR("Invalid DDR patch operation size %d\n",
+					Cmd->Size);
+			return XAIE_INVALID_ARGS;
+		}
+		memcpy(&Args, (const void *)(uintptr_t)Cmd->DataPtr,
+				sizeof(Args));
+
+		Patch = &Tmpl->Patches[Tmpl->NumPatches];
+		RC = _XAie_TxnTemplateNewShimAddrSlots(Tmpl, Args.RegAddr, "",
+				&Patch->AddrLowSlot, &Patch->AddrHighSlot);
+		if(RC == XAIE_ERR) {
+			return RC;
+		} else if(RC != XAIE_OK) {
+			XAIE_WARN("DDR patch of buffer descriptor 0x%lx can "
+					"not be applied on the host\n",
+					Args.RegAddr);
+			continue;
+		}
+
+		Patch->ArgIdx = Args.ArgIdx;
+		Patch->ArgPlus = Args.ArgPlus;
+		Tmpl->NumPatches++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a template of an exported transaction instance. Patch slots
+* are created for the address fields of the buffer descriptors targeted by the
+* XAIE_IO_CUSTOM_OP_DDR_PATCH operations of the transaction, further slots are
+* added with XAie_AddTxnTemplateSlot().
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported or imported transaction
+*		instance.
+*
+* @return	Pointer to the template on success and NULL on failure.
+*
+* @note		The template does not own the transaction instance, which must
+*		remain valid until the template is freed. Transactions started
+*		with XAIE_TRANSACTION_ENABLE_OPTIMIZE are optimized when the
+*		template is created and not again on submission, so that the
+*		patched commands remain stable. XAie_OptimizeTransaction()
+*		fails for the transaction until its templates are freed. Shim
+*		buffer descriptors recorded as XAIE_CONFIG_SHIMDMA_BD commands
+*		by the Linux backend can not be patched.
+*
+******************************************************************************/
+XAie_TxnTemplate* XAie_CreateTxnTemplate(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
+{
+	XAie_TxnTemplate *Tmpl;
+
+	if((DevInst == XAIE_NULL) || (TxnInst == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	if((TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK) == 0U) {
+		XAIE_ERROR("Transaction instance was not exported\n");
+		return NULL;
+	}
+
+	if(TxnInst->Flags & XAIE_TXN_OPTIMIZE_MASK) {
+		XAie_TxnOptStats Stats;
+
+		if(_XAie_TxnOptimize(DevInst, TxnInst, XAIE_TXN_OPT_ALL,
+					&Stats) != XAIE_OK) {
+			XAIE_ERROR("Failed to optimize transaction\n");
+			return NULL;
+		}
+		TxnInst->Flags &= ~XAIE_TXN_OPTIMIZE_MASK;
+	}
+
+	Tmpl = (XAie_TxnTemplate *)calloc(1U, sizeof(*Tmpl));
+	if(Tmpl == NULL) {
+		XAIE_ERROR("Failed to allocate memory for template\n");
+		return NULL;
+	}
+	Tmpl->DevInst = DevInst;
+	Tmpl->TxnInst = TxnInst;
+
+	TxnInst->NumTemplates++;
+
+	if(_XAie_TxnTemplateScanDdrPatches(Tmpl) != XAIE_OK) {
+		XAie_FreeTxnTemplate(Tmpl);
+		return NULL;
+	}
+
+	return Tmpl;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a named patch slot to a template. The slot covers the field of
+* all the recorded writes to the register.
+*
+* @param	Tmpl: Pointer to the template.
+* @param	Name: Name of the slot.
+* @param	RegOff: Register offset of the field.
+* @param	Mask: Mask of the field.
+* @param	Shift: Right shift applied to values of the slot before they
+*		are placed at the least significant bit of the field.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Registers written by block set commands can not be patched.
+*
+******************************************************************************/
+AieRC XAie_AddTxnTemplateSlot(XAie_TxnTemplate *Tmpl, const char *Name,
+		u64 RegOff, u32 Mask, u8 Shift)
+{
+	u32 SlotIdx;
+
+	if((Tmpl == NULL) || (Name == NULL) || (Name[0] == '\0') ||
+			(Mask == 0U) || (Shift > 63U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(strlen(Name) >= XAIE_TXN_TEMPLATE_NAME_MAX) {
+		XAIE_ERROR("Slot name %s is too long\n", Name);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnTemplateFindSlot(Tmpl, Name) != NULL) {
+		XAIE_ERROR("Slot %s already exists\n", Name);
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnTemplateNewSlot(Tmpl, Name, RegOff, Mask, Shift,
+			&SlotIdx);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the address and length slots of a shim DMA buffer descriptor
+* to a template. Values of the address slot are byte addresses and values of
+* the length slot are lengths in bytes, as passed to XAie_DmaSetAddrLen().
+*
+* @param	Tmpl: Pointer to the template.
+* @param	Loc: Location of the shim NoC tile.
+* @param	BdNum: Buffer descriptor number.
+* @param	AddrName: Name of the address slot. NULL to skip the address.
+* @param	LenName: Name of the length slot. NULL to skip the length.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The address slot covers the low and high address words of the
+*		buffer descriptor.
+*
+******************************************************************************/
+AieRC XAie_AddTxnTemplateShimBdSlots(XAie_TxnTemplate *Tmpl, XAie_LocType Loc,
+		u16 BdNum, const char *AddrName, const char *LenName)
+{
+	const XAie_DmaMod *DmaMod;
+	XAie_DevInst *DevInst;
+	u32 NumSlots, NumLocs;
+	u32 LowSlot, HighSlot;
+	u64 BdAddr;
+	AieRC RC;
+
+	if((Tmpl == NULL) || ((AddrName == NULL) && (LenName == NULL))) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	DevInst = Tmpl->DevInst;
+	if(DevInst->DevOps->GetTTypefromLoc(DevInst, Loc) !=
+			XAIEGBL_TILE_TYPE_SHIMNOC) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_SHIMNOC].DmaMod;
+	if(BdNum >= DmaMod->NumBds) {
+		XAIE_ERROR("Invalid BD number\n");
+		return XAIE_INVALID_BD_NUM;
+	}
+
+	if(((AddrName != NULL) && ((AddrName[0] == '\0') ||
+			(strlen(AddrName) >= XAIE_TXN_TEMPLATE_NAME_MAX) ||
+			(_XAie_TxnTemplateFindSlot(Tmpl, AddrName) != NULL))) ||
+			((LenName != NULL) && ((LenName[0] == '\0') ||
+			(strlen(LenName) >= XAIE_TXN_TEMPLATE_NAME_MAX) ||
+			(_XAie_TxnTemplateFindSlot(Tmpl, LenName) != NULL)))) {
+		XAIE_ERROR("Invalid or duplicate slot name\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	BdAddr = XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		DmaMod->BaseAddr + (u64)BdNum * DmaMod->IdxOffset;
+	NumSlots = Tmpl->NumSlots;
+	NumLocs = Tmpl->NumLocs;
+
+	if(AddrName != NULL) {
+		RC = _XAie_TxnTemplateNewShimAddrSlots(Tmpl, BdAddr, AddrName,
+				&LowSlot, &HighSlot);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if(LenName != NULL) {
+		RC = _XAie_TxnTemplateNewSlot(Tmpl, LenName,
+				BdAddr + DmaMod->BdProp->BufferLen.Idx * 4U,
+				DmaMod->BdProp->BufferLen.Mask,
+				XAIE_DMA_32BIT_TXFER_LEN, &LowSlot);
+		if(RC != XAIE_OK) {
+			Tmpl->NumSlots = NumSlots;
+			Tmpl->NumLocs = NumLocs;
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the value of a named slot of a template. The value is patched
+* in place into the commands of the transaction.
+*
+* @param	Tmpl: Pointer to the template.
+* @param	Name: Name of the slot.
+* @param	Value: Value of the slot.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_SetTxnTemplateSlot(XAie_TxnTemplate *Tmpl, const char *Name,
+		u64 Value)
+{
+	const XAie_TxnTemplateSlot *Slot;
+
+	if((Tmpl == NULL) || (Name == NULL) || (Name[0] == '\0')) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Slot = _XAie_TxnTemplateFindSlot(Tmpl, Name);
+	if(Slot == NULL) {
+		XAIE_ERROR("No slot named %s\n", Name);
+		return XAIE_INVALID_ARGS;
+	}
+	_XAie_TxnTemplatePatchSlot(Tmpl, Slot, Value);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the address of a buffer argument of a template. The address
+* plus the offset of each DDR patch operation referring to the argument is
+* patched into the buffer descriptor of the operation.
+*
+* @param	Tmpl: Pointer to the template.
+* @param	ArgIdx: Index of the buffer argument.
+* @param	Addr: Address of the buffer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_SetTxnTemplateArg(XAie_TxnTemplate *Tmpl, u64 ArgIdx, u64 Addr)
+{
+	u8 Found = XAIE_DISABLE;
+
+	if(Tmpl == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Tmpl->NumPatches; i++) {
+		const XAie_TxnTemplatePatch *Patch = &Tmpl->Patches[i];
+
+		if(Patch->ArgIdx != ArgIdx) {
+			continue;
+		}
+
+		_XAie_TxnTemplatePatchSlot(Tmpl,
+				&Tmpl->Slots[Patch->AddrLowSlot],
+				Addr + Patch->ArgPlus);
+		Found = XAIE_ENABLE;
+	}
+
+	if(Found == XAIE_DISABLE) {
+		XAIE_ERROR("No DDR patch for argument %lu\n", ArgIdx);
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits the patched transaction of a template. The template can be
+* patched and submitted again afterwards.
+*
+* @param	Tmpl: Pointer to the template.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_SubmitTxnTemplate(XAie_TxnTemplate *Tmpl)
+{
+	if(Tmpl == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_SubmitTransaction(Tmpl->DevInst, Tmpl->TxnInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a template. The transaction instance of the template is not
+* released.
+*
+* @param	Tmpl: Pointer to the template.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_FreeTxnTemplate(XAie_TxnTemplate *Tmpl)
+{
+	if(Tmpl == NULL) {
+		return;
+	}
+
+	Tmpl->TxnInst->NumTemplates--;
+	free(Tmpl->Slots);
+	free(Tmpl->Locs);
+	free(Tmpl->Patches);
+	free(Tmpl);
+}
+
+/*****************************************************************************/
+/**
+* This API adds a tag mark to a transaction instance. Commands recorded from
+* the command index on are accounted to the tag.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        CmdIdx: Index of the first command of the tag
+* @param        Name: Name of the tag, empty for untagged commands.
+*
+* @return       XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note         Internal only. A mark without commands is replaced.
+*
+******************************************************************************/
+static AieRC _XAie_TxnTagsAdd(XAie_TxnInst *TxnInst, u32 CmdIdx,
+		const char *Name)
+{
+	XAie_TxnTags *Tags = TxnInst->Tags;
+	XAie_TxnTagMark *Mark;
+
+	if(Tags == NULL) {
+		if(Name[0] == '\0') {
+			return XAIE_OK;
+		}
+
+		Tags = (XAie_TxnTags *)calloc(1U, sizeof(*Tags));
+		if(Tags == NULL) {
+			XAIE_ERROR("Failed to allocate memory for tags\n");
+			return XAIE_ERR;
+		}
+		TxnInst->Tags = Tags;
+	}
+
+	if(Tags->NumMarks > 0U) {
+		Mark = &Tags->Marks[Tags->NumMarks - 1U];
+		if(strcmp(Mark->Name, Name) == 0) {
+			return XAIE_OK;
+		}
+		if(Mark->CmdIdx == CmdIdx) {
+			Tags->NumMarks--;
+		}
+	}
+
+	if(Tags->NumMarks == Tags->MaxMarks) {
+		u32 MaxMarks = (Tags->MaxMarks == 0U) ?
+			XAIE_TXN_TAGS_DEFAULT_MARKS : Tags->MaxMarks * 2U;
+		XAie_TxnTagMark *Marks;
+
+		Marks = (XAie_TxnTagMark *)realloc(Tags->Marks,
+				MaxMarks * sizeof(*Marks));
+		if(Marks == NULL) {
+			XAIE_ERROR("Failed to allocate memory for tags\n");
+			return XAIE_ERR;
+		}
+		Tags->Marks = Marks;
+		Tags->MaxMarks = MaxMarks;
+	}
+
+	Mark = &Tags->Marks[Tags->NumMarks++];
+	Mark->CmdIdx = CmdIdx;
+	strcpy(Mark->Name, Name);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API drops the tag marks of the commands of a transaction instance once
+* its command buffer is reset. The current tag stays active.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnTagsReset(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnTags *Tags = TxnInst->Tags;
+
+	if((Tags == NULL) || (Tags->NumMarks == 0U)) {
+		return;
+	}
+
+	Tags->Marks[0U] = Tags->Marks[Tags->NumMarks - 1U];
+	Tags->Marks[0U].CmdIdx = 0U;
+	Tags->NumMarks = 1U;
+}
+
+/*****************************************************************************/
+/**
+* This API releases the tag marks of a transaction instance.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnTagsFree(XAie_TxnInst *TxnInst)
+{
+	if(TxnInst->Tags == NULL) {
+		return;
+	}
+
+	free(TxnInst->Tags->Marks);
+	free(TxnInst->Tags);
+	TxnInst->Tags = NULL;
+}
+
+/*****************************************************************************/
+/**
+* This API copies the tag marks of a transaction instance to its export.
+*
+* @param        Dst: Pointer to the exported transaction instance
+* @param        Src: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnTagsCopy(XAie_TxnInst *Dst, const XAie_TxnInst *Src)
+{
+	const XAie_TxnTags *Tags = Src->Tags;
+
+	if((Tags == NULL) || (Tags->NumMarks == 0U)) {
+		return XAIE_OK;
+	}
+
+	Dst->Tags = (XAie_TxnTags *)calloc(1U, sizeof(*Dst->Tags));
+	if(Dst->Tags == NULL) {
+		XAIE_ERROR("Failed to allocate memory for tags\n");
+		return XAIE_ERR;
+	}
+
+	Dst->Tags->Marks = (XAie_TxnTagMark *)malloc(Tags->NumMarks *
+			sizeof(*Tags->Marks));
+	if(Dst->Tags->Marks == NULL) {
+		XAIE_ERROR("Failed to allocate memory for tags\n");
+		return XAIE_ERR;
+	}
+
+	memcpy(Dst->Tags->Marks, Tags->Marks,
+			Tags->NumMarks * sizeof(*Tags->Marks));
+	Dst->Tags->NumMarks = Tags->NumMarks;
+	Dst->Tags->MaxMarks = Tags->NumMarks;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API tags the commands recorded by the transaction of the calling thread
+* from now on. The statistics returned by XAie_GetTxnStats() are broken down
+* by tag, which attributes the commands to the phases of the configuration,
+* such as routing or DMA setup.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Tag: Name of the tag. NULL or an empty name stops tagging.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Tags are carried over to exported transaction instances. They
+*		are not part of serialized transactions.
+*
+******************************************************************************/
+AieRC XAie_TxnSetTag(XAie_DevInst *DevInst, const char *Tag)
+{
+	XAie_TxnInst *TxnInst;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Tag == NULL) {
+		Tag = "";
+	}
+
+	if(strlen(Tag) >= XAIE_TXN_TAG_NAME_MAX) {
+		XAIE_ERROR("Tag name is too long\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TxnInst = _XAie_TxnGetCurrentInst(DevInst);
+	if(TxnInst == NULL) {
+		XAIE_ERROR("No transaction started by the calling thread\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnTagsAdd(TxnInst, TxnInst->NumCmds, Tag);
+}
+
+/*****************************************************************************/
+/**
+* This API accounts a command to a statistics entry.
+*
+* @param        Entry: Pointer to the statistics entry
+* @param        Bytes: Size of the command in the serialized format
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline void _XAie_TxnStatsAdd(XAie_TxnStatsEntry *Entry, u64 Bytes)
+{
+	Entry->NumOps++;
+	Entry->NumBytes += Bytes;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the statistics of a tag, adding the tag if it is not
+* accounted yet.
+*
+* @param        Stats: Pointer to the statistics
+* @param        Name: Name of the tag
+*
+* @return       Pointer to the statistics of the tag.
+*
+* @note         Internal only. The tag array is sized for all the tag marks of
+*		the transaction.
+*
+******************************************************************************/
+static XAie_TxnTagStats* _XAie_TxnStatsGetTag(XAie_TxnStats *Stats,
+		const char *Name)
+{
+	XAie_TxnTagStats *Tag;
+
+	for(u32 i = 0U; i < Stats->NumTags; i++) {
+		if(strcmp(Stats->Tag[i].Name, Name) == 0) {
+			return &Stats->Tag[i];
+		}
+	}
+
+	Tag = &Stats->Tag[Stats->NumTags++];
+	strcpy(Tag->Name, Name);
+
+	return Tag;
+}
+
+/*****************************************************************************/
+/**
+* This API computes the statistics of the commands of a transaction instance.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       Pointer to the statistics on success, NULL on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static XAie_TxnStats* _XAie_TxnStatsCollect(XAie_DevInst *DevInst,
+		const XAie_TxnInst *TxnInst)
+{
+	const XAie_TxnTags *Tags = TxnInst->Tags;
+	XAie_TxnTagStats *CurTag = NULL;
+	XAie_TxnStats *Stats;
+	u32 Mark = 0U;
+
+	Stats = (XAie_TxnStats *)calloc(1U, sizeof(*Stats));
+	if(Stats == NULL) {
+		XAIE_ERROR("Failed to allocate memory for statistics\n");
+		return NULL;
+	}
+
+	Stats->NumCols = DevInst->NumCols;
+	Stats->NumRows = DevInst->NumRows;
+	Stats->Tile = (XAie_TxnStatsEntry *)calloc((u32)DevInst->NumCols *
+			DevInst->NumRows, sizeof(*Stats->Tile));
+	if((Tags != NULL) && (Tags->NumMarks > 0U)) {
+		Stats->Tag = (XAie_TxnTagStats *)calloc(Tags->NumMarks,
+				sizeof(*Stats->Tag));
+	}
+	if((Stats->Tile == NULL) || ((Tags != NULL) &&
+				(Tags->NumMarks > 0U) && (Stats->Tag == NULL))) {
+		XAIE_ERROR("Failed to allocate memory for statistics\n");
+		XAie_FreeTxnStats(Stats);
+		return NULL;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u64 Bytes = _XAie_TxnCmdSerializedSize(Cmd);
+		u32 Op = (u32)Cmd->Opcode;
+
+		while((Tags != NULL) && (Mark < Tags->NumMarks) &&
+				(Tags->Marks[Mark].CmdIdx <= i)) {
+			CurTag = NULL;
+			if(Tags->Marks[Mark].Name[0] != '\0') {
+				CurTag = _XAie_TxnStatsGetTag(Stats,
+						Tags->Marks[Mark].Name);
+			}
+			Mark++;
+		}
+
+		if(Op > (u32)XAIE_IO_CUSTOM_OP_MAX) {
+			continue;
+		}
+
+		if((Cmd->Opcode == XAIE_IO_WRITE) && (Cmd->Mask != 0U)) {
+			Op = (u32)XAIE_IO_MASKWRITE;
+		}
+
+		_XAie_TxnStatsAdd(&Stats->Total, Bytes);
+		_XAie_TxnStatsAdd(&Stats->Opcode[Op], Bytes);
+		if(CurTag != NULL) {
+			_XAie_TxnStatsAdd(&CurTag->Stats, Bytes);
+		}
+
+		if(Cmd->Opcode < XAIE_IO_CUSTOM_OP_BEGIN) {
+			u8 Col = _XAie_GetColfromRegOff(DevInst, Cmd->RegOff);
+			u8 Row = _XAie_GetRowfromRegOff(DevInst, Cmd->RegOff);
+
+			_XAie_TxnStatsAdd(&Stats->Module[_XAie_GetRegModule(
+						DevInst, Cmd->RegOff)], Bytes);
+			if(((Cmd->RegOff >> DevInst->DevProp.ColShift) <
+						DevInst->NumCols) &&
+					(Row < DevInst->NumRows)) {
+				_XAie_TxnStatsAdd(&Stats->Tile[(u32)Col *
+						DevInst->NumRows + Row], Bytes);
+			}
+		}
+	}
+
+	return Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the breakdown of the commands of a transaction by opcode,
+* tile, module and tag. Sizes are reported in bytes of the serialized
+* transaction format.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the statistics of the transaction being recorded by the calling
+*		thread are returned.
+*
+* @return	Pointer to the statistics on success, NULL on failure. The
+*		statistics must be released with XAie_FreeTxnStats().
+*
+* @note		The commands are reported as recorded. Call
+*		XAie_OptimizeTransaction() first to report the optimized
+*		transaction.
+*
+******************************************************************************/
+XAie_TxnStats* XAie_GetTxnStats(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return NULL;
+	}
+
+	if(TxnInst == NULL) {
+		TxnInst = _XAie_TxnGetCurrentInst(DevInst);
+		if(TxnInst == NULL) {
+			XAIE_ERROR("No transaction started by the calling "
+					"thread\n");
+			return NULL;
+		}
+	}
+
+	return _XAie_TxnStatsCollect(DevInst, TxnInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the breakdown of the commands of a serialized transaction by
+* opcode, tile and module.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnPtr: Pointer to the serialized transaction.
+* @param	Size: Size of the buffer pointed by TxnPtr in bytes.
+*
+* @return	Pointer to the statistics on success, NULL on failure. The
+*		statistics must be released with XAie_FreeTxnStats().
+*
+* @note		Block sets are serialized as block writes. Sizes are reported
+*		in bytes of the regular serialized format, also for compact
+*		transactions.
+*
+******************************************************************************/
+XAie_TxnStats* XAie_GetSerializedTxnStats(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size)
+{
+	XAie_TxnStats *Stats;
+	XAie_TxnInst *Inst;
+
+	if((DevInst == XAIE_NULL) || (TxnPtr == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	Inst = _XAie_TxnImportSerialized(DevInst, TxnPtr, Size);
+	if(Inst == NULL) {
+		return NULL;
+	}
+
+	Stats = _XAie_TxnStatsCollect(DevInst, Inst);
+	_XAie_TxnInstFree(Inst);
+
+	return Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases transaction statistics.
+*
+* @param	Stats: Pointer to the statistics.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_FreeTxnStats(XAie_TxnStats *Stats)
+{
+	if(Stats == NULL) {
+		return;
+	}
+
+	free(Stats->Tile);
+	free(Stats->Tag);
+	free(Stats);
+}
+
+/*****************************************************************************/
+/**
+* This API folds a buffer into a FNV-1a hash.
+*
+* @param        Hash: Hash to fold the buffer into
+* @param        Buf: Pointer to the buffer
+* @param        Size: Size of the buffer in bytes
+*
+* @return       Updated hash.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TxnFnv1a(u64 Hash, const void *Buf, u64 Size)
+{
+	const u8 *Bytes = (const u8 *)Buf;
+
+	for(u64 i = 0U; i < Size; i++) {
+		Hash ^= Bytes[i];
+		Hash *= XAIE_TXN_FNV_PRIME;
+	}
+
+	return Hash;
+}
+
+/*****************************************************************************/
+/**
+* This API walks the command bytes of a transaction covered by its hash: the
+* opcode, mask, value, size and offset of every command and the payloads of
+* block writes and custom operations.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Visit: Visitor called on every part of the command bytes
+* @param        Priv: Private data of the visitor
+*
+* @return       XAIE_ENABLE if all the bytes were visited, XAIE_DISABLE if the
+*		visitor stopped the walk.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TxnWalkKey(const XAie_TxnInst *TxnInst,
+		XAie_TxnKeyVisitor Visit, void *Priv)
+{
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u32 Words[4U] = {(u32)Cmd->Opcode, Cmd->Mask, Cmd->Value,
+			Cmd->Size};
+		u64 Size = 0U;
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			Size = (u64)Cmd->Size * sizeof(u32);
+		} else if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+			Size = Cmd->Size;
+		}
+
+		if(!Visit(Priv, Words, sizeof(Words)) ||
+				!Visit(Priv, &Cmd->RegOff,
+					sizeof(Cmd->RegOff)) ||
+				((Size != 0U) && !Visit(Priv,
+					(const void *)(uintptr_t)Cmd->DataPtr,
+					Size))) {
+			return XAIE_DISABLE;
+		}
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*
+ * Visitors of _XAie_TxnWalkKey() folding the command bytes into a hash,
+ * counting them, copying them to a cursor and comparing them with a cursor.
+ */
+static u8 _XAie_TxnKeyHash(void *Priv, const void *Buf, u64 Size)
+{
+	u64 *Hash = (u64 *)Priv;
+
+	*Hash = _XAie_TxnFnv1a(*Hash, Buf, Size);
+
+	return XAIE_ENABLE;
+}
+
+static u8 _XAie_TxnKeySize(void *Priv, const void *Buf, u64 Size)
+{
+	(void)Buf;
+
+	*(u64 *)Priv += Size;
+
+	return XAIE_ENABLE;
+}
+
+static u8 _XAie_TxnKeyCopy(void *Priv, const void *Buf, u64 Size)
+{
+	XAie_TxnKeyCursor *Cur = (XAie_TxnKeyCursor *)Priv;
+
+	memcpy(Cur->Buf + Cur->Off, Buf, Size);
+	Cur->Off += Size;
+
+	return XAIE_ENABLE;
+}
+
+static u8 _XAie_TxnKeyCompare(void *Priv, const void *Buf, u64 Size)
+{
+	XAie_TxnKeyCursor *Cur = (XAie_TxnKeyCursor *)Priv;
+
+	if((Cur->Size - Cur->Off < Size) ||
+			(memcmp(Cur->Buf + Cur->Off, Buf, Size) != 0)) {
+		return XAIE_DISABLE;
+	}
+	Cur->Off += Size;
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API releases an entry of the transaction cache.
+*
+* @param        Entry: Pointer to the cache entry
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnCacheEntryFree(XAie_TxnCacheEntry *Entry)
+{
+	free(Entry->Txn);
+	free(Entry->Cmds);
+	free(Entry);
+}
+
+/*****************************************************************************/
+/**
+* This API unlinks an entry from the recently used list of the transaction
+* cache and releases it unless it is being replayed.
+*
+* @param        Cache: Pointer to the transaction cache
+* @param        Entry: Pointer to the cache entry
+*
+* @return       None
+*
+* @note         Internal only. The cache lock must be held. Entries being
+*		replayed are released by the last replay.
+*
+******************************************************************************/
+static void _XAie_TxnCacheEvict(XAie_TxnCache *Cache,
+		XAie_TxnCacheEntry *Entry)
+{
+	if(Entry->Prev != NULL) {
+		Entry->Prev->Next = Entry->Next;
+	} else {
+		Cache->Head = Entry->Next;
+	}
+
+	if(Entry->Next != NULL) {
+		Entry->Next->Prev = Entry->Prev;
+	} else {
+		Cache->Tail = Entry->Prev;
+	}
+
+	Cache->Used -= sizeof(*Entry) + Entry->Size + Entry->CmdsSize;
+	Cache->NumEntries--;
+	Entry->Evicted = XAIE_ENABLE;
+	if(Entry->Refs == 0U) {
+		_XAie_TxnCacheEntryFree(Entry);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API evicts the least recently used entries of the transaction cache
+* until the cache fits in its memory budget.
+*
+* @param        Cache: Pointer to the transaction cache
+*
+* @return       None
+*
+* @note         Internal only. The cache lock must be held.
+*
+******************************************************************************/
+static void _XAie_TxnCacheTrim(XAie_TxnCache *Cache)
+{
+	while((Cache->Used > Cache->Budget) && (Cache->Tail != NULL)) {
+		XAIE_DBG("Evicting cached transaction 0x%llx\n",
+				(unsigned long long)Cache->Tail->Key);
+		_XAie_TxnCacheEvict(Cache, Cache->Tail);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API releases the transaction cache of a device instance.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None
+*
+* @note         Internal only. No replay may be in progress.
+*
+******************************************************************************/
+void _XAie_TxnCacheFree(XAie_DevInst *DevInst)
+{
+	XAie_TxnCache *Cache = DevInst->TxnCache;
+
+	if(Cache == NULL) {
+		return;
+	}
+
+	while(Cache->Head != NULL) {
+		_XAie_TxnCacheEvict(Cache, Cache->Head);
+	}
+
+	_XAie_MutexDestroy(Cache->Lock);
+	free(Cache);
+	DevInst->TxnCache = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the memory budget of the transaction cache of a device
+* instance. The cache holds serialized transactions keyed by a 64 bit key, the
+* least recently used transactions are evicted once the budget is exceeded.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Budget: Memory budget in bytes. 0 disables the cache and
+*		releases all the cached transactions.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The cache is disabled by default. This API must not be called
+*		while cached transactions are being added or submitted.
+*
+******************************************************************************/
+AieRC XAie_SetTxnCacheBudget(XAie_DevInst *DevInst, u64 Budget)
+{
+	XAie_TxnCache *Cache;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Budget == 0U) {
+		_XAie_TxnCacheFree(DevInst);
+		return XAIE_OK;
+	}
+
+	Cache = DevInst->TxnCache;
+	if(Cache == NULL) {
+		Cache = (XAie_TxnCache *)calloc(1U, sizeof(*Cache));
+		if(Cache == NULL) {
+			XAIE_ERROR("Failed to allocate memory for transaction "
+					"cache\n");
+			return XAIE_ERR;
+		}
+#ifdef __linux__
+		Cache->Lock = _XAie_MutexCreate();
+		if(Cache->Lock == NULL) {
+			free(Cache);
+			return XAIE_ERR;
+		}
+#endif
+		DevInst->TxnCache = Cache;
+	}
+
+	_XAie_MutexLock(Cache->Lock);
+	Cache->Budget = Budget;
+	_XAie_TxnCacheTrim(Cache);
+	_XAie_MutexUnlock(Cache->Lock);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes a 64 bit FNV-1a hash of the commands of a transaction. The
+* hash covers the opcodes, offsets, masks, values and payloads of the commands
+* and can be used as the key of a cached transaction.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the transaction being recorded by the calling thread is hashed.
+* @param	Key: Pointer to return the hash.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_HashTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u64 *Key)
+{
+	u64 Hash = XAIE_TXN_FNV_OFFSET_BASIS;
+
+	if((DevInst == XAIE_NULL) || (Key == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(TxnInst == NULL) {
+		TxnInst = _XAie_TxnGetCurrentInst(DevInst);
+		if(TxnInst == NULL) {
+			XAIE_ERROR("No transaction started by the calling "
+					"thread\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	_XAie_TxnWalkKey(TxnInst, _XAie_TxnKeyHash, &Hash);
+	*Key = Hash;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a transaction has shim DMA buffer descriptor commands.
+* The serialized transaction format does not carry these commands, such
+* transactions are not cached.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_ENABLE if the transaction has shim DMA buffer descriptor
+*		commands, XAIE_DISABLE otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TxnHasShimBdCmds(const XAie_TxnInst *TxnInst)
+{
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		if((TxnInst->CmdBuf[i].Opcode == XAIE_CONFIG_SHIMDMA_BD) ||
+				(TxnInst->CmdBuf[i].Opcode ==
+				 XAIE_CONFIG_SHIMDMA_DMABUF_BD)) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API looks up a cached transaction and takes a reference to it.
+*
+* @param        Cache: Pointer to the transaction cache
+* @param        Key: Key of the transaction
+*
+* @return       Pointer to the cache entry, NULL if not found.
+*
+* @note         Internal only. The reference is dropped with
+*		_XAie_TxnCachePut().
+*
+******************************************************************************/
+static XAie_TxnCacheEntry* _XAie_TxnCacheGet(XAie_TxnCache *Cache, u64 Key)
+{
+	XAie_TxnCacheEntry *Entry;
+
+	_XAie_MutexLock(Cache->Lock);
+	for(Entry = Cache->Head; Entry != NULL; Entry = Entry->Next) {
+		if(Entry->Key == Key) {
+			break;
+		}
+	}
+
+	if(Entry == NULL) {
+		_XAie_MutexUnlock(Cache->Lock);
+		return NULL;
+	}
+
+	/* Move the entry to the head of the recently used list */
+	if(Entry->Prev != NULL) {
+		Entry->Prev->Next = Entry->Next;
+		if(Entry->Next != NULL) {
+			Entry->Next->Prev = Entry->Prev;
+		} else {
+			Cache->Tail = Entry->Prev;
+		}
+		Entry->Prev = NULL;
+		Entry->Next = Cache->Head;
+		Cache->Head->Prev = Entry;
+		Cache->Head = Entry;
+	}
+	Entry->Refs++;
+	_XAie_MutexUnlock(Cache->Lock);
+
+	return Entry;
+}
+
+/*****************************************************************************/
+/**
+* This API drops a reference to a cached transaction. Entries evicted while
+* they are referenced are released by the last reference.
+*
+* @param        Cache: Pointer to the transaction cache
+* @param        Entry: Pointer to the cache entry
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnCachePut(XAie_TxnCache *Cache, XAie_TxnCacheEntry *Entry)
+{
+	_XAie_MutexLock(Cache->Lock);
+	Entry->Refs--;
+	if((Entry->Evicted == XAIE_ENABLE) && (Entry->Refs == 0U)) {
+		_XAie_TxnCacheEntryFree(Entry);
+	}
+	_XAie_MutexUnlock(Cache->Lock);
+}
+
+/*****************************************************************************/
+/**
+* This API inserts a serialized transaction in the transaction cache, replacing
+* a cached transaction with the same key, and takes a reference to it.
+*
+* @param        Cache: Pointer to the transaction cache
+* @param        Key: Key of the transaction
+* @param        Txn: Serialized transaction allocated with malloc(), owned by
+*		the cache on success.
+* @param        Size: Size of Txn in bytes
+* @param        Cmds: Command bytes of the transaction allocated with
+*		malloc(), owned by the cache on success.
+* @param        CmdsSize: Size of Cmds in bytes
+*
+* @return       Pointer to the cache entry, NULL on failure.
+*
+* @note         Internal only. The reference is dropped with
+*		_XAie_TxnCachePut().
+*
+******************************************************************************/
+static XAie_TxnCacheEntry* _XAie_TxnCacheInsert(XAie_TxnCache *Cache,
+		u64 Key, u8 *Txn, u32 Size, u8 *Cmds, u64 CmdsSize)
+{
+	XAie_TxnCacheEntry *Entry;
+
+	Entry = (XAie_TxnCacheEntry *)calloc(1U, sizeof(*Entry));
+	if(Entry == NULL) {
+		XAIE_ERROR("Failed to allocate memory for cached "
+				"transaction\n");
+		return NULL;
+	}
+	Entry->Key = Key;
+	Entry->Txn = Txn;
+	Entry->Size = Size;
+	Entry->Cmds = Cmds;
+	Entry->CmdsSize = CmdsSize;
+	Entry->Refs = 1U;
+
+	_XAie_MutexLock(Cache->Lock);
+	for(XAie_TxnCacheEntry *Tmp = Cache->Head; Tmp != NULL;
+			Tmp = Tmp->Next) {
+		if(Tmp->Key == Key) {
+			_XAie_TxnCacheEvict(Cache, Tmp);
+			break;
+		}
+	}
+
+	Entry->Next = Cache->Head;
+	if(Cache->Head != NULL) {
+		Cache->Head->Prev = Entry;
+	} else {
+		Cache->Tail = Entry;
+	}
+	Cache->Head = Entry;
+	Cache->Used += sizeof(*Entry) + Size + CmdsSize;
+	Cache->NumEntries++;
+	_XAie_TxnCacheTrim(Cache);
+	_XAie_MutexUnlock(Cache->Lock);
+
+	return Entry;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if the commands of a transaction are the ones of a cached
+* transaction.
+*
+* @param        Entry: Pointer to the cache entry
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_ENABLE if the commands match, XAIE_DISABLE otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TxnCacheMatch(const XAie_TxnCacheEntry *Entry,
+		const XAie_TxnInst *TxnInst)
+{
+	XAie_TxnKeyCursor Cur = {Entry->Cmds, Entry->CmdsSize, 0U};
+
+	return (_XAie_TxnWalkKey(TxnInst, _XAie_TxnKeyCompare, &Cur) ==
+			XAIE_ENABLE) && (Cur.Off == Cur.Size);
+}
+
+/*****************************************************************************/
+/**
+* This API serializes a transaction and inserts it in the transaction cache,
+* along with its command bytes to check later hits against. The serialized
+* transaction is optimized if the optimizer is enabled for the transaction.
+*
+* @param        DevInst: Device instance pointer
+* @param        Key: Key of the transaction
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Entry: Pointer to return the cache entry
+*
+* @return       XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if the
+*		transaction exceeds the budget of the cache and error code on
+*		failure.
+*
+* @note         Internal only. The reference to the entry is dropped with
+*		_XAie_TxnCachePut().
+*
+******************************************************************************/
+static AieRC _XAie_TxnCacheAdd(XAie_DevInst *DevInst, u64 Key,
+		XAie_TxnInst *TxnInst, XAie_TxnCacheEntry **Entry)
+{
+	XAie_TxnCache *Cache = DevInst->TxnCache;
+	XAie_TxnKeyCursor Cur = {NULL, 0U, 0U};
+	u64 Overhead;
+	u32 Size = 0U;
+	u8 *Txn;
+	AieRC RC;
+
+	_XAie_TxnWalkKey(TxnInst, _XAie_TxnKeySize, &Cur.Size);
+	Overhead = sizeof(XAie_TxnCacheEntry) + Cur.Size;
+	RC = XAIE_INSUFFICIENT_BUFFER_SIZE;
+	if(Overhead < Cache->Budget) {
+		RC = _XAie_TxnSerializeAlloc(DevInst, TxnInst, 0U,
+				Cache->Budget - Overhead, &Txn, &Size);
+	}
+	if(RC == XAIE_INSUFFICIENT_BUFFER_SIZE) {
+		XAIE_WARN("Transaction of %llu bytes exceeds the cache "
+				"budget\n",
+				(unsigned long long)(Overhead + Size));
+	}
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Cur.Size != 0U) {
+		Cur.Buf = (u8 *)malloc(Cur.Size);
+		if(Cur.Buf == NULL) {
+			XAIE_ERROR("Failed to allocate memory for cached "
+					"transaction\n");
+			free(Txn);
+			return XAIE_ERR;
+		}
+		_XAie_TxnWalkKey(TxnInst, _XAie_TxnKeyCopy, &Cur);
+	}
+
+	*Entry = _XAie_TxnCacheInsert(Cache, Key, Txn, Size, Cur.Buf,
+			Cur.Size);
+	if(*Entry == NULL) {
+		free(Cur.Buf);
+		free(Txn);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a transaction to the transaction cache of a device instance.
+* The transaction is serialized, after running the optimizer if it was started
+* with XAIE_TRANSACTION_ENABLE_OPTIMIZE, and stored under the key. A cached
+* transaction with the same key is replaced.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Key: Key of the transaction, chosen by the caller or returned
+*		by XAie_HashTransaction().
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the transaction being recorded by the calling thread is added.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The transaction is not submitted. Transactions larger than the
+*		budget of the cache are not cached. Transactions with shim DMA
+*		buffer descriptor commands are not supported, as the serialized
+*		format does not carry these commands.
+*
+******************************************************************************/
+AieRC XAie_AddCachedTransaction(XAie_DevInst *DevInst, u64 Key,
+		XAie_TxnInst *TxnInst)
+{
+	XAie_TxnCacheEntry *Entry;
+	XAie_TxnInst *Inst = TxnInst;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->TxnCache == NULL) {
+		XAIE_ERROR("Transaction cache is not enabled\n");
+		return XAIE_ERR;
+	}
+
+	if(Inst == NULL) {
+		Inst = _XAie_TxnGetCurrentInst(DevInst);
+		if(Inst == NULL) {
+			XAIE_ERROR("No transaction started by the calling "
+					"thread\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	if(_XAie_TxnHasShimBdCmds(Inst) == XAIE_ENABLE) {
+		XAIE_ERROR("Transactions with shim DMA buffer descriptor "
+				"commands cannot be cached\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	RC = _XAie_TxnCacheAdd(DevInst, Key, Inst, &Entry);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+	_XAie_TxnCachePut(DevInst->TxnCache, Entry);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API replays a cached transaction. The transaction is executed directly
+* on the backend, without recording or optimizing it again.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Key: Key of the transaction.
+* @param	Hit: Pointer to return XAIE_ENABLE if the transaction was found
+*		in the cache, XAIE_DISABLE otherwise.
+*
+* @return	XAIE_OK if the transaction was replayed or is not cached and
+*		error code on failure.
+*
+* @note		Cached transactions can be replayed concurrently.
+*
+******************************************************************************/
+AieRC XAie_SubmitCachedTransaction(XAie_DevInst *DevInst, u64 Key, u8 *Hit)
+{
+	XAie_TxnCacheEntry *Entry;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Hit == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Hit = XAIE_DISABLE;
+	if(DevInst->TxnCache == NULL) {
+		return XAIE_OK;
+	}
+
+	Entry = _XAie_TxnCacheGet(DevInst->TxnCache, Key);
+	if(Entry == NULL) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_TxnSubmitSerialized(DevInst, Entry->Txn, Entry->Size);
+	_XAie_TxnCachePut(DevInst->TxnCache, Entry);
+
+	*Hit = XAIE_ENABLE;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits a transaction through the transaction cache. The commands of
+* the transaction are hashed. If a transaction with the same hash and commands
+* is cached, the cached transaction is replayed, otherwise the transaction is
+* serialized, added to the cache and replayed from it.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the transaction being recorded by the calling thread is
+*		submitted and released.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		A cache hit replays the cached transaction without serializing
+*		or optimizing the transaction again. The commands are only
+*		compared with the cached ones when the hash matches, cached
+*		transactions keep a copy of their commands for that. Callers
+*		which can name their configurations should use
+*		XAie_SubmitCachedTransaction() with their own key, which also
+*		skips recording the transaction.
+*		Transactions with shim DMA buffer descriptor commands are
+*		submitted without the cache.
+*
+******************************************************************************/
+AieRC XAie_SubmitTransactionWithCache(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
+{
+	XAie_TxnCacheEntry *Entry;
+	XAie_TxnInst *Inst = TxnInst;
+	u64 Key;
+	AieRC RC;
+
+	RC = XAie_HashTransaction(DevInst, TxnInst, &Key);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Inst == NULL) {
+		Inst = _XAie_TxnGetCurrentInst(DevInst);
+	}
+
+	if((DevInst->TxnCache == NULL) ||
+			(_XAie_TxnHasShimBdCmds(Inst) == XAIE_ENABLE)) {
+		return _XAie_Txn_Submit(DevInst, TxnInst);
+	}
+
+	/* A key collision with different commands is a miss */
+	Entry = _XAie_TxnCacheGet(DevInst->TxnCache, Key);
+	if((Entry != NULL) &&
+			(_XAie_TxnCacheMatch(Entry, Inst) == XAIE_DISABLE)) {
+		_XAie_TxnCachePut(DevInst->TxnCache, Entry);
+		Entry = NULL;
+	}
+
+	if(Entry == NULL) {
+		RC = _XAie_TxnCacheAdd(DevInst, Key, Inst, &Entry);
+		if(RC == XAIE_INSUFFICIENT_BUFFER_SIZE) {
+			return _XAie_Txn_Submit(DevInst, TxnInst);
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	RC = _XAie_TxnSubmitSerialized(DevInst, Entry->Txn, Entry->Size);
+	_XAie_TxnCachePut(DevInst->TxnCache, Entry);
+
+	if((RC == XAIE_OK) && (TxnInst == NULL)) {
+		RC = _XAie_ClearTransaction(DevInst);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API executes an asynchronous submission and releases the transaction
+* instance if it is owned by the submission.
+*
+* @param        Fence: Pointer to the fence of the submission
+*
+* @return       None
+*
+* @note         Internal only. The fence is not marked as completed.
+*
+******************************************************************************/
+static void _XAie_TxnAsyncExec(XAie_TxnFence *Fence)
+{
+	Fence->RC = _XAie_Txn_FlushCmdBuf(Fence->DevInst, Fence->TxnInst);
+	if(Fence->RC != XAIE_OK) {
+		XAIE_ERROR("Asynchronous transaction submission failed\n");
+	}
+
+	if(Fence->ReleaseInst != 0U) {
+		_XAie_TxnInstFree(Fence->TxnInst);
+	}
+	Fence->TxnInst = NULL;
+
+	if(Fence->Callback != NULL) {
+		Fence->Callback(Fence, Fence->RC, Fence->CallbackArg);
+	}
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+* This API is the entry of the submission thread of a device instance. The
+* thread executes the queued submissions in order until it is asked to exit.
+*
+* @param        Arg: Pointer to the asynchronous submission queue
+*
+* @return       NULL
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void* _XAie_TxnAsyncWorker(void *Arg)
+{
+	XAie_TxnAsync *Async = (XAie_TxnAsync *)Arg;
+	XAie_TxnFence *Fence;
+
+	pthread_mutex_lock(&Async->Lock);
+	for(;;) {
+		while((Async->Head == NULL) && (Async->Exit == 0U)) {
+			pthread_cond_wait(&Async->WorkCond, &Async->Lock);
+		}
+		if(Async->Head == NULL) {
+			break;
+		}
+
+		Fence = Async->Head;
+		Async->Head = Fence->Next;
+		if(Async->Head == NULL) {
+			Async->Tail = NULL;
+		}
+		pthread_mutex_unlock(&Async->Lock);
+
+		_XAie_TxnAsyncExec(Fence);
+
+		pthread_mutex_lock(&Async->Lock);
+		XAIE_ATOMIC_STORE(&Fence->Done, 1U);
+		Async->NumPending--;
+		pthread_cond_broadcast(&Async->DoneCond);
+	}
+	pthread_mutex_unlock(&Async->Lock);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+* This API initializes the lock and conditions of an asynchronous submission
+* queue and starts its submission thread.
+*
+* @param        Async: Pointer to the asynchronous submission queue
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure, in which case
+*		nothing is left initialized.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnAsyncInit(XAie_TxnAsync *Async)
+{
+	if(pthread_mutex_init(&Async->Lock, NULL) != 0) {
+		return XAIE_ERR;
+	}
+
+	if(pthread_cond_init(&Async->WorkCond, NULL) != 0) {
+		pthread_mutex_destroy(&Async->Lock);
+		return XAIE_ERR;
+	}
+
+	if(pthread_cond_init(&Async->DoneCond, NULL) != 0) {
+		pthread_cond_destroy(&Async->WorkCond);
+		pthread_mutex_destroy(&Async->Lock);
+		return XAIE_ERR;
+	}
+
+	if(pthread_create(&Async->Thread, NULL, _XAie_TxnAsyncWorker,
+				Async) != 0) {
+		pthread_cond_destroy(&Async->DoneCond);
+		pthread_cond_destroy(&Async->WorkCond);
+		pthread_mutex_destroy(&Async->Lock);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the asynchronous submission queue of a device instance and
+* starts its submission thread on first use.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       Pointer to the queue, NULL if the queue cannot be set up or
+*		its submission thread cannot be started.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static XAie_TxnAsync* _XAie_TxnAsyncGet(XAie_DevInst *DevInst)
+{
+	XAie_TxnAsync *Async;
+
+	Async = XAIE_ATOMIC_LOAD(&DevInst->TxnAsync);
+	if(Async != NULL) {
+		return Async;
+	}
+
+	_XAie_MutexLock(DevInst->TxnListLock);
+	Async = DevInst->TxnAsync;
+	if(Async == NULL) {
+		Async = (XAie_TxnAsync *)calloc(1U, sizeof(*Async));
+		if(Async == NULL) {
+			_XAie_MutexUnlock(DevInst->TxnListLock);
+			XAIE_ERROR("Failed to allocate memory for asynchronous "
+					"submission queue\n");
+			return NULL;
+		}
+
+		if(_XAie_TxnAsyncInit(Async) != XAIE_OK) {
+			_XAie_MutexUnlock(DevInst->TxnListLock);
+			XAIE_WARN("Failed to start submission thread, "
+					"submitting synchronously\n");
+			free(Async);
+			return NULL;
+		}
+		XAIE_ATOMIC_STORE(&DevInst->TxnAsync, Async);
+	}
+	_XAie_MutexUnlock(DevInst->TxnListLock);
+
+	return Async;
+}
+#endif
+
+/*****************************************************************************/
+/**
+* This API waits until the asynchronous submissions of a device instance
+* queued so far completed.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None
+*
+* @note         Internal only. Returns immediately when called from the
+*		submission thread.
+*
+******************************************************************************/
+void _XAie_TxnAsyncDrain(XAie_DevInst *DevInst)
+{
+#ifdef __linux__
+	XAie_TxnAsync *Async = XAIE_ATOMIC_LOAD(&DevInst->TxnAsync);
+
+	if((Async == NULL) || pthread_equal(Async->Thread, pthread_self())) {
+		return;
+	}
+
+	pthread_mutex_lock(&Async->Lock);
+	while(Async->NumPending != 0U) {
+		pthread_cond_wait(&Async->DoneCond, &Async->Lock);
+	}
+	pthread_mutex_unlock(&Async->Lock);
+#else
+	(void)DevInst;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API completes the pending asynchronous submissions of a device instance
+* and stops its submission thread.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None
+*
+* @note         Internal only. Fences of the device instance stay valid until
+*		they are freed.
+*
+******************************************************************************/
+void _XAie_TxnAsyncFree(XAie_DevInst *DevInst)
+{
+#ifdef __linux__
+	XAie_TxnAsync *Async = DevInst->TxnAsync;
+
+	if(Async == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&Async->Lock);
+	Async->Exit = 1U;
+	pthread_cond_signal(&Async->WorkCond);
+	pthread_mutex_unlock(&Async->Lock);
+	pthread_join(Async->Thread, NULL);
+
+	pthread_cond_destroy(&Async->DoneCond);
+	pthread_cond_destroy(&Async->WorkCond);
+	pthread_mutex_destroy(&Async->Lock);
+	free(Async);
+	DevInst->TxnAsync = NULL;
+#else
+	(void)DevInst;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits a transaction without waiting for its execution. The
+* submissions of a device instance are executed in order by a submission
+* thread of the device instance, so that the calling thread can prepare the
+* next transaction while the current one is executed.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the transaction being recorded by the calling thread is
+*		submitted and released once executed, and the calling thread
+*		can start a new transaction immediately.
+* @param	Callback: Optional callback called from the submission thread
+*		once the submission completed.
+* @param	Arg: Argument passed to the callback.
+*
+* @return	Pointer to the fence of the submission on success and NULL on
+*		error. The fence is freed with XAie_FreeTxnFence().
+*
+* @note		An exported transaction instance must not be modified or
+*		freed before the submission completed. Synchronous submissions
+*		and transaction flushes wait for the pending asynchronous
+*		submissions of the device instance. Register accesses outside
+*		of transactions are not ordered with pending submissions, wait
+*		for the fence first. If the submission thread cannot be
+*		started, the transaction is submitted synchronously and the
+*		returned fence is already completed.
+*
+******************************************************************************/
+XAie_TxnFence* XAie_SubmitTransactionAsync(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnFenceCallback Callback,
+		void *Arg)
+{
+	XAie_TxnFence *Fence;
+#ifdef __linux__
+	XAie_TxnAsync *Async;
+#endif
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return NULL;
+	}
+
+	if((TxnInst != NULL) &&
+			!(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		XAIE_ERROR("Transaction instance was not exported.\n");
+		return NULL;
+	}
+
+	Fence = (XAie_TxnFence *)calloc(1U, sizeof(*Fence));
+	if(Fence == NULL) {
+		XAIE_ERROR("Failed to allocate memory for transaction fence\n");
+		return NULL;
+	}
+
+	if(TxnInst == NULL) {
+		TxnInst = _XAie_TxnDetach(DevInst);
+		if(TxnInst == NULL) {
+			free(Fence);
+			return NULL;
+		}
+		Fence->ReleaseInst = 1U;
+	}
+
+	Fence->DevInst = DevInst;
+	Fence->TxnInst = TxnInst;
+	Fence->Callback = Callback;
+	Fence->CallbackArg = Arg;
+	Fence->RC = XAIE_OK;
+
+#ifdef __linux__
+	Async = _XAie_TxnAsyncGet(DevInst);
+	if(Async != NULL) {
+		Fence->Async = Async;
+		pthread_mutex_lock(&Async->Lock);
+		if(Async->Tail != NULL) {
+			Async->Tail->Next = Fence;
+		} else {
+			Async->Head = Fence;
+		}
+		Async->Tail = Fence;
+		Async->NumPending++;
+		pthread_cond_signal(&Async->WorkCond);
+		pthread_mutex_unlock(&Async->Lock);
+
+		return Fence;
+	}
+#endif
+
+	_XAie_TxnAsyncExec(Fence);
+	Fence->Done = 1U;
+
+	return Fence;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if an asynchronous submission completed without blocking.
+*
+* @param	Fence: Pointer to the fence of the submission.
+* @param	Done: Pointer to return XAIE_ENABLE if the submission completed,
+*		XAIE_DISABLE otherwise.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The result of a completed submission is returned by
+*		XAie_TxnFenceWait().
+*
+******************************************************************************/
+AieRC XAie_TxnFencePoll(XAie_TxnFence *Fence, u8 *Done)
+{
+	if((Fence == NULL) || (Done == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Done = (XAIE_ATOMIC_LOAD(&Fence->Done) != 0U) ? XAIE_ENABLE :
+		XAIE_DISABLE;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits until an asynchronous submission completed.
+*
+* @param	Fence: Pointer to the fence of the submission.
+*
+* @return	Result of the submission, XAIE_OK if the transaction was
+*		executed successfully.
+*
+* @note		Must not be called from a fence callback.
+*
+******************************************************************************/
+AieRC XAie_TxnFenceWait(XAie_TxnFence *Fence)
+{
+	if(Fence == NULL) {
+		XAIE_ERROR("Invalid fence\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+#ifdef __linux__
+	if(XAIE_ATOMIC_LOAD(&Fence->Done) == 0U) {
+		XAie_TxnAsync *Async = Fence->Async;
+
+		pthread_mutex_lock(&Async->Lock);
+		while(Fence->Done == 0U) {
+			pthread_cond_wait(&Async->DoneCond, &Async->Lock);
+		}
+		pthread_mutex_unlock(&Async->Lock);
+	}
+#endif
+
+	return Fence->RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the fence of an asynchronous submission. It waits for the
+* submission to complete first.
+*
+* @param	Fence: Pointer to the fence of the submission.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_FreeTxnFence(XAie_TxnFence *Fence)
+{
+	if(Fence == NULL) {
+		return;
+	}
+
+	(void)XAie_TxnFenceWait(Fence);
+	free(Fence);
+}
+
+/** @} */
@@ -17,6 +17,12 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Keyur   08/25/2023  Initial creation
+* 1.1   Tejus   10/16/2026  Add transaction optimizer APIs
+* 1.2   Tejus   10/16/2026  Add custom op handler APIs
+* 1.3   Tejus   10/16/2026  Add transaction template APIs
+* 1.4   Tejus   10/16/2026  Add transaction statistics APIs
+* 1.5   Tejus   10/16/2026  Add transaction cache APIs
+* 1.6   Tejus   10/16/2026  Add asynchronous transaction submission APIs
 * </pre>
 *
 ******************************************************************************/
@@ -24,6 +30,25 @@
 #define XAIETXN_H
 
 /***************************** Include Files *********************************/
+#include <limits.h>
+
+#include "xaiegbl.h"
+
+/************************** Constant Definitions *****************************/
+/* Transaction optimizer passes */
+#define XAIE_TXN_OPT_COALESCE		(1U << 0) /* Merge address contiguous
+						     writes into block writes */
+#define XAIE_TXN_OPT_FOLD_MASKWRITE	(1U << 1) /* Fold masked writes to a
+						     register into one write */
+#define XAIE_TXN_OPT_DEAD_STORE		(1U << 2) /* Drop overwritten writes */
+#define XAIE_TXN_OPT_ALL		(XAIE_TXN_OPT_COALESCE | \
+					 XAIE_TXN_OPT_FOLD_MASKWRITE | \
+					 XAIE_TXN_OPT_DEAD_STORE)
+
+#define XAIE_TXN_TEMPLATE_NAME_MAX	32U /* Including the terminator */
+#define XAIE_TXN_TAG_NAME_MAX		32U /* Including the terminator */
+
+/**************************** Type Definitions *******************************/
 /* All New custom Ops should be added above XAIE_IO_CUSTOM_OP_NEXT
  * To support backward compatibility existing enums should not be
  * modified. */
@@ -51,4 +76,141 @@ struct XAie_TxnCmd {
 	u32 Size;
 };
 
+/*
+ * This typedef captures the result of a transaction optimizer run.
+ */
+typedef struct {
+	u32 NumOpsBefore;	/* Number of commands before optimization */
+	u32 NumOpsAfter;	/* Number of commands after optimization */
+	u32 NumCoalesced;	/* Commands merged into block writes */
+	u32 NumFolded;		/* Masked writes folded into a later write */
+	u32 NumDropped;		/* Writes dropped as a later write overwrites
+				   them */
+} XAie_TxnOptStats;
+
+/*
+ * Handler of a custom operation. The handler is called with the payload
+ * recorded by XAie_AddCustomTxnOp() when the operation is executed on the
+ * host. Register accesses done by the handler are not recorded in the
+ * transaction being executed.
+ */
+typedef AieRC (*XAie_TxnCustomOpHandler)(XAie_DevInst *DevInst, u8 OpNumber,
+		const void *Args, u32 Size, void *Priv);
+
+/*
+ * Arguments of the XAIE_IO_CUSTOM_OP_DDR_PATCH operation. The address of the
+ * buffer with index ArgIdx plus ArgPlus is patched into the address fields of
+ * the shim DMA buffer descriptor at register offset RegAddr.
+ */
+typedef struct {
+	u64 RegAddr;	/* Register offset of the shim DMA buffer descriptor */
+	u64 ArgIdx;	/* Index of the buffer argument */
+	u64 ArgPlus;	/* Offset added to the buffer address */
+} XAie_TxnDdrPatch;
+
+/*
+ * Transaction template. A template holds named patch slots of an exported
+ * transaction instance. Values set to a slot are patched in place into the
+ * recorded commands, so that the transaction can be submitted again without
+ * recording it again.
+ */
+typedef struct XAie_TxnTemplate XAie_TxnTemplate;
+
+/*
+ * Modules the register accesses of a transaction are attributed to.
+ */
+typedef enum {
+	XAIE_TXN_STATS_MOD_CORE,	/* Core control and status registers */
+	XAIE_TXN_STATS_MOD_MEMORY,	/* Program and data memories */
+	XAIE_TXN_STATS_MOD_DMA,		/* DMA descriptors and channels */
+	XAIE_TXN_STATS_MOD_STRMSW,	/* Stream switch ports */
+	XAIE_TXN_STATS_MOD_EVENT,	/* Event module registers */
+	XAIE_TXN_STATS_MOD_LOCK,	/* Lock registers */
+	XAIE_TXN_STATS_MOD_OTHER,
+	XAIE_TXN_STATS_MOD_MAX,
+} XAie_TxnStatsModule;
+
+/*
+ * Number of commands and their size in the serialized transaction format.
+ */
+typedef struct {
+	u32 NumOps;
+	u64 NumBytes;
+} XAie_TxnStatsEntry;
+
+/*
+ * Statistics of the commands recorded under a tag set with XAie_TxnSetTag().
+ */
+typedef struct {
+	char Name[XAIE_TXN_TAG_NAME_MAX];
+	XAie_TxnStatsEntry Stats;
+} XAie_TxnTagStats;
+
+/*
+ * This typedef captures the breakdown of the commands of a transaction.
+ * Masked writes are accounted as XAIE_IO_MASKWRITE. Custom operations are
+ * not accounted to a tile or module. Register accesses outside of the
+ * partition are not accounted to a tile.
+ */
+typedef struct {
+	XAie_TxnStatsEntry Total;
+	XAie_TxnStatsEntry Opcode[XAIE_IO_CUSTOM_OP_MAX + 1]; /* By opcode */
+	XAie_TxnStatsEntry Module[XAIE_TXN_STATS_MOD_MAX]; /* By module */
+	u8 NumCols;
+	u8 NumRows;
+	XAie_TxnStatsEntry *Tile; /* By tile, index is Col * NumRows + Row */
+	u32 NumTags;
+	XAie_TxnTagStats *Tag; /* By tag, in order of first use */
+} XAie_TxnStats;
+
+/*
+ * Completion fence of an asynchronous transaction submission. The fence holds
+ * the result of the submission once it completed.
+ */
+typedef struct XAie_TxnFence XAie_TxnFence;
+
+/*
+ * Callback called from the submission thread once an asynchronous submission
+ * completed, with the result of the submission. The callback must not wait
+ * for or free fences of the device instance.
+ */
+typedef void (*XAie_TxnFenceCallback)(XAie_TxnFence *Fence, AieRC RC,
+		void *Arg);
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_RegisterCustomTxnOpHandler(XAie_DevInst *DevInst, u8 OpNumber,
+		XAie_TxnCustomOpHandler Handler, void *Priv);
+AieRC XAie_OptimizeTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Opts, XAie_TxnOptStats *Stats);
+XAie_TxnTemplate* XAie_CreateTxnTemplate(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst);
+AieRC XAie_AddTxnTemplateSlot(XAie_TxnTemplate *Tmpl, const char *Name,
+		u64 RegOff, u32 Mask, u8 Shift);
+AieRC XAie_AddTxnTemplateShimBdSlots(XAie_TxnTemplate *Tmpl, XAie_LocType Loc,
+		u16 BdNum, const char *AddrName, const char *LenName);
+AieRC XAie_SetTxnTemplateSlot(XAie_TxnTemplate *Tmpl, const char *Name,
+		u64 Value);
+AieRC XAie_SetTxnTemplateArg(XAie_TxnTemplate *Tmpl, u64 ArgIdx, u64 Addr);
+AieRC XAie_SubmitTxnTemplate(XAie_TxnTemplate *Tmpl);
+void XAie_FreeTxnTemplate(XAie_TxnTemplate *Tmpl);
+AieRC XAie_TxnSetTag(XAie_DevInst *DevInst, const char *Tag);
+XAie_TxnStats* XAie_GetTxnStats(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
+XAie_TxnStats* XAie_GetSerializedTxnStats(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size);
+void XAie_FreeTxnStats(XAie_TxnStats *Stats);
+AieRC XAie_SetTxnCacheBudget(XAie_DevInst *DevInst, u64 Budget);
+AieRC XAie_HashTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u64 *Key);
+AieRC XAie_AddCachedTransaction(XAie_DevInst *DevInst, u64 Key,
+		XAie_TxnInst *TxnInst);
+AieRC XAie_SubmitCachedTransaction(XAie_DevInst *DevInst, u64 Key, u8 *Hit);
+AieRC XAie_SubmitTransactionWithCache(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst);
+XAie_TxnFence* XAie_SubmitTransactionAsync(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnFenceCallback Callback,
+		void *Arg);
+AieRC XAie_TxnFencePoll(XAie_TxnFence *Fence, u8 *Done);
+AieRC XAie_TxnFenceWait(XAie_TxnFence *Fence);
+void XAie_FreeTxnFence(XAie_TxnFence *Fence);
+
 #endif
@@ -41,7 +41,6 @@
 #ifdef XAIE_FEATURE_DMA_ENABLE
 
 /************************** Constant Definitions *****************************/
-#define XAIE_DMA_32BIT_TXFER_LEN			2U
 #define XAIE_DMA_MAX_QUEUE_SIZE				4U
 
 #define XAIE_SHIM_BLEN_SHIFT				0x3
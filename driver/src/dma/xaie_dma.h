@@ -30,6 +30,9 @@
 #include "xaiegbl.h"
 #include "xaiegbl_defs.h"
 
+/************************** Constant Definitions *****************************/
+#define XAIE_DMA_32BIT_TXFER_LEN	2U /* Shift of byte lengths to words */
+
 /**************************** Type Definitions *******************************/
 /*
  * This enum captures the DMA Fifo Counters
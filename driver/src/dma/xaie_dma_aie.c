@@ -18,6 +18,7 @@
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus   03/23/2020  Initial creation
 * 1.1   Tejus   06/10/2020  Switch to new io backend apis.
+* 1.2   Tejus   10/16/2026  Read buffer descriptors with one block read.
 * </pre>
 *
 ******************************************************************************/
@@ -339,12 +340,10 @@ AieRC _XAie_ShimDmaReadBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIE_SHIMDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord,
+			XAIE_SHIMDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	DmaDesc->AddrDesc.Address |= (u64)XAie_GetField(BdWord[0U],
@@ -597,12 +596,10 @@ AieRC _XAie_TileDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIE_TILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord,
+			XAIE_TILEDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	DmaDesc->LockDesc.LockAcqId = (u8)XAie_GetField(BdWord[0U],
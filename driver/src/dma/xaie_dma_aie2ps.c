@@ -17,6 +17,7 @@
 * Ver   Who	Date     Changes
 * ----- ------     -------- -----------------------------------------------------
 * 1.0   Sankarji   10/04/2022  Initial creation
+* 1.1   Tejus      10/16/2026  Read buffer descriptors with one block read.
 ** </pre>
 *
 ******************************************************************************/
@@ -439,12 +440,10 @@ AieRC _XAie2PS_ShimDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIE2PS_SHIMDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord,
+			XAIE2PS_SHIMDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	DmaDesc->AddrDesc.Length = XAie_GetField(BdWord[0U],
@@ -48,6 +48,9 @@
 
 /**************************** Macro Definitions ******************************/
 #define XAIE_ECC_BROADCAST_ID		6U
+#define XAIE_POLL_SPIN_US		20U
+#define XAIE_POLL_MIN_SLEEP_US		10U
+#define XAIE_POLL_MAX_SLEEP_US		200U
 
 /************************** Variable Definitions *****************************/
 extern XAie_TileMod AieMod[XAIEGBL_TILE_TYPE_MAX];
@@ -195,16 +198,46 @@ AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr)
 	InstPtr->AieTileRowStart = ConfigPtr->AieTileRowStart;
 	InstPtr->AieTileNumRows = ConfigPtr->AieTileNumRows;
 	InstPtr->EccStatus = XAIE_ENABLE;
-	InstPtr->TxnList.Next = NULL;
+	_XAie_TxnListInit(InstPtr);
+	InstPtr->TxnListLock = _XAie_MutexCreate();
+#ifdef __linux__
+	if(InstPtr->TxnListLock == NULL) {
+		InstPtr->IsReady = 0;
+		return XAIE_ERR;
+	}
+#endif
+	InstPtr->TxnCustomOps = NULL;
+	InstPtr->RegLocks = NULL;
+	InstPtr->TxnCache = NULL;
+	InstPtr->TxnAsync = NULL;
+	InstPtr->TxnFlushPool = NULL;
+	InstPtr->RegShadow = NULL;
+	XAie_ConfigPoll(InstPtr, NULL);
 
 	memcpy(&InstPtr->PartProp, &ConfigPtr->PartProp,
 		sizeof(ConfigPtr->PartProp));
 
 	RC = XAie_IOInit(InstPtr);
 	if(RC != XAIE_OK) {
+		_XAie_MutexDestroy(InstPtr->TxnListLock);
+		InstPtr->TxnListLock = NULL;
+		InstPtr->IsReady = 0;
 		return RC;
 	}
 
+	InstPtr->RegLocks = _XAie_RegLocksCreate(InstPtr);
+#ifdef __linux__
+	/* Register accesses are not serialized without the register locks */
+	if(InstPtr->RegLocks == NULL) {
+		XAIE_ERROR("Failed to create register locks\n");
+		InstPtr->Backend->Ops.Finish(InstPtr->IOInst);
+		_XAie_MutexDestroy(InstPtr->TxnListLock);
+		InstPtr->TxnListLock = NULL;
+		InstPtr->IsReady = 0;
+		return XAIE_ERR;
+	}
+#endif
+
 	return XAIE_OK;
 }
 
@@ -506,7 +539,16 @@ AieRC XAie_Finish(XAie_DevInst *DevInst)
 	}
 
 	/* Free transaction mode resources, if any */
+	_XAie_TxnAsyncFree(DevInst);
+	_XAie_TxnFlushPoolFree(DevInst);
 	_XAie_TxnResourceCleanup(DevInst);
+	_XAie_TxnCustomOpsFree(DevInst);
+	_XAie_TxnCacheFree(DevInst);
+	_XAie_RegShadowDestroy(DevInst);
+	_XAie_MutexDestroy(DevInst->TxnListLock);
+	DevInst->TxnListLock = NULL;
+	_XAie_RegLocksDestroy(DevInst->RegLocks);
+	DevInst->RegLocks = NULL;
 
 	CurrBackend = DevInst->Backend;
 	RC = CurrBackend->Ops.Finish(DevInst->IOInst);
@@ -548,6 +590,9 @@ AieRC XAie_SetIOBackend(XAie_DevInst *DevInst, XAie_BackendType Backend)
 		return XAIE_INVALID_ARGS;
 	}
 
+	/* The shadow is only valid for the backend that populated it */
+	_XAie_RegShadowDestroy(DevInst);
+
 	/* Release resources for current backend */
 	CurrBackend = DevInst->Backend;
 	RC = CurrBackend->Ops.Finish((void *)(DevInst->IOInst));
@@ -863,6 +908,9 @@ AieRC XAie_TurnEccOn(XAie_DevInst *DevInst)
 * @param	DevInst: Device instance pointer.
 * @param	Flags: Flags passed by the user.
 *			XAIE_TRANSACTION_ENABLE/DISBALE_AUTO_FLUSH
+*			XAIE_TRANSACTION_ENABLE_OPTIMIZE
+*			XAIE_TRANSACTION_DEFER_READS
+*			XAIE_TRANSACTION_ENABLE_PARALLEL_SUBMIT
 *
 * @return	XAIE_OK on success and error code on failure.
 *
@@ -870,10 +918,22 @@ AieRC XAie_TurnEccOn(XAie_DevInst *DevInst)
 *		automatically flush the transaction buffer when an API results
 *		in Read/MaskPoll/BlockWrite/BlockSet/CmdWrite/RunOp operation.
 *		If the DISABLE_AUTO_FLUSH flag is set, the driver will return an
-*		error when an API results in Read/MaskPoll/CmdWrite/RunOp
-*		operation. In both cases, the user has to call
+*		error when an API results in CmdWrite/RunOp operation. Reads
+*		of registers written by pending commands are served from the
+*		recorded values and reads of configuration registers are
+*		served without flushing. Other reads flush the pending
+*		commands, or with DEFER_READS return the current hardware
+*		value and record a mask poll for it. Block reads which cannot
+*		be served without flushing flush the pending commands once,
+*		also with DEFER_READS. In both cases, the user has to call
 *		XAie_SubmitTransaction API to flush all the pending I/O
 *		operations stored in the command buffer.
+*		If the ENABLE_PARALLEL_SUBMIT flag is set and the backend
+*		allows concurrent accesses to different columns, the commands
+*		are flushed as per column streams from worker threads. Only the
+*		order of the commands of a column is kept between custom, shim
+*		DMA buffer descriptor and poll operations, which are flushed
+*		in order.
 *
 ******************************************************************************/
 AieRC XAie_StartTransaction(XAie_DevInst *DevInst, u32 Flags)
@@ -1012,6 +1072,117 @@ AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr)
 			(void *)&NpiAddr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API enables or disables register writes through a writable mapping of
+* the partition registers. When enabled, the Linux backend writes registers of
+* the tiles in use directly through the mapping instead of issuing a system
+* call per write. Registers of the shim row are still written by the kernel.
+*
+* @param	DevInst: Global AIE device instance pointer.
+* @param	Enable: XAIE_ENABLE to enable, XAIE_DISABLE to disable.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend or
+*		the kernel does not allow register writes through the mapping.
+*
+* @note		Only supported by the Linux backend.
+*
+******************************************************************************/
+AieRC XAie_ConfigMmapRegWrite(XAie_DevInst *DevInst, u8 Enable)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->Backend->Type != XAIE_IO_BACKEND_LINUX) {
+		XAIE_ERROR("Register writes through mapping are only "
+				"supported by the Linux backend\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	Enable = (Enable != XAIE_DISABLE) ? XAIE_ENABLE : XAIE_DISABLE;
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_MMAP_WRITE,
+			(void *)&Enable);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the strategy of register mask polls of the device
+* instance, which are used by XAie_MaskPoll() and the wait APIs built on it
+* such as XAie_DmaWaitForDone() and XAie_CoreWaitForDone().
+*
+* @param	DevInst: Global AIE device instance pointer.
+* @param	Cfg: Poll configuration. NULL restores the default strategy,
+*		which busy polls for 20us, then sleeps from 10us doubling up to
+*		200us.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Supported by the Linux backend, the other backends keep their
+*		own poll loops. Must not be called concurrently with polls of
+*		the device instance.
+*
+******************************************************************************/
+AieRC XAie_ConfigPoll(XAie_DevInst *DevInst, const XAie_PollConfig *Cfg)
+{
+	if(DevInst == NULL) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Cfg == NULL) {
+		DevInst->PollCfg.SpinUs = XAIE_POLL_SPIN_US;
+		DevInst->PollCfg.MinSleepUs = XAIE_POLL_MIN_SLEEP_US;
+		DevInst->PollCfg.MaxSleepUs = XAIE_POLL_MAX_SLEEP_US;
+		DevInst->PollCfg.WaitFn = NULL;
+		DevInst->PollCfg.WaitArg = NULL;
+		return XAIE_OK;
+	}
+
+	if((Cfg->MinSleepUs == 0U) || (Cfg->MinSleepUs > Cfg->MaxSleepUs)) {
+		XAIE_ERROR("Invalid poll sleep range %u - %u us\n",
+				Cfg->MinSleepUs, Cfg->MaxSleepUs);
+		return XAIE_INVALID_ARGS;
+	}
+
+	DevInst->PollCfg = *Cfg;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sends the register writes buffered by the IO backend to the device.
+* Reads and polls send the buffered writes before accessing the device, this
+* API is needed before waiting on the device by other means.
+*
+* @param	DevInst: Global AIE device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Only the socket backend buffers register writes. For the other
+*		backends this API does nothing.
+*
+******************************************************************************/
+AieRC XAie_FlushIO(XAie_DevInst *DevInst)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->Backend->Type != XAIE_IO_BACKEND_SOCKET) {
+		return XAIE_OK;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_FLUSH_IO, NULL);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1022,7 +1193,8 @@ AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr)
 * @param	DevInst: Device instance pointer.
 * @param	NumConsumers: Number of consumers for the generated
 *		transactions (Unused for now)
-* @param	Flags: Flags (Unused for now)
+* @param	Flags: XAIE_TRANSACTION_EXPORT_COMPACT to use the compact
+*		serialized format, 0 otherwise.
 *
 * @return	Pointer to copy of transaction instance on success and NULL
 *		on error.
@@ -1040,6 +1212,71 @@ u8* XAie_ExportSerializedTransaction(XAie_DevInst *DevInst,
 	return _XAie_TxnExportSerialized(DevInst, NumConsumers, Flags);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API returns the exact size of the buffer required to serialize a
+* transaction with XAie_SerializeTransaction().
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the transaction being recorded by the calling thread is used.
+* @param	Flags: XAIE_TRANSACTION_EXPORT_* flags.
+* @param	Size: Pointer to return the size in bytes.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The transaction is optimized by this API if it was started
+*		with XAIE_TRANSACTION_ENABLE_OPTIMIZE.
+*
+******************************************************************************/
+AieRC XAie_GetSerializedTransactionSize(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u32 Flags, u32 *Size)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+		(Size == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnGetSerializedSize(DevInst, TxnInst, Flags, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API serializes a transaction into a buffer owned by the caller. The
+* format is the same as the one of XAie_ExportSerializedTransaction().
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Pointer to an exported transaction instance. If NULL,
+*		the transaction being recorded by the calling thread is used.
+* @param	Flags: XAIE_TRANSACTION_EXPORT_* flags.
+* @param	Buf: Pointer to the destination buffer.
+* @param	BufSize: Size of the destination buffer in bytes.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if BufSize is
+*		smaller than the size returned by
+*		XAie_GetSerializedTransactionSize() and error code on other
+*		failures.
+*
+* @note		The transaction is not consumed and can still be submitted.
+*
+******************************************************************************/
+AieRC XAie_SerializeTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u8 *Buf, u32 BufSize)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+		(Buf == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnSerialize(DevInst, TxnInst, Flags, Buf, BufSize);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1058,6 +1295,68 @@ void XAie_FreeSerializedTransaction(void *Ptr)
 	_XAie_FreeTxnPtr(Ptr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API decodes a transaction serialized by
+* XAie_ExportSerializedTransaction() into a transaction instance. The header of
+* the serialized transaction is validated against the device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnPtr: Pointer to the serialized transaction.
+* @param	Size: Size of the buffer pointed by TxnPtr in bytes.
+*
+* @return	Pointer to transaction instance on success and NULL on error.
+*
+* @note		The transaction instance can be submitted any number of times
+*		using XAie_SubmitTransaction() and must be explicitly freed
+*		using the XAie_FreeTransactionInstance API.
+*
+******************************************************************************/
+XAie_TxnInst* XAie_ImportSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+		(TxnPtr == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	return _XAie_TxnImportSerialized(DevInst, TxnPtr, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API replays a transaction serialized by
+* XAie_ExportSerializedTransaction() on the device instance without creating a
+* transaction instance. The header of the serialized transaction is validated
+* against the device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnPtr: Pointer to the serialized transaction.
+* @param	Size: Size of the buffer pointed by TxnPtr in bytes.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The operations are issued to the backend directly. They are not
+*		recorded in a transaction started by the calling thread.
+*
+******************************************************************************/
+AieRC XAie_SubmitSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+		(TxnPtr == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnSubmitSerialized(DevInst, TxnPtr, Size);
+}
+
 AieRC XAie_ClearTransaction(XAie_DevInst* DevInst)
 {
 	if((DevInst == XAIE_NULL) ||
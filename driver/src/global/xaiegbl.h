@@ -52,6 +52,11 @@
 
 #define XAIE_TRANSACTION_ENABLE_AUTO_FLUSH	0b1U
 #define XAIE_TRANSACTION_DISABLE_AUTO_FLUSH	0b0U
+#define XAIE_TRANSACTION_ENABLE_OPTIMIZE	0b100U
+#define XAIE_TRANSACTION_DEFER_READS		0b1000U
+#define XAIE_TRANSACTION_ENABLE_PARALLEL_SUBMIT	0b10000U
+
+#define XAIE_TRANSACTION_EXPORT_COMPACT		0b1U
 
 #define XAIE_PART_INIT_OPT_COLUMN_RST		(1U << 0)
 #define XAIE_PART_INIT_OPT_SHIM_RST		(1U << 1)
@@ -76,6 +81,16 @@ typedef struct XAie_LockMod XAie_LockMod;
 typedef struct XAie_Backend XAie_Backend;
 typedef struct XAie_TxnCmd XAie_TxnCmd;
 typedef struct XAie_ResourceManager XAie_ResourceManager;
+typedef struct XAie_Mutex XAie_Mutex;
+typedef struct XAie_TxnChunk XAie_TxnChunk;
+typedef struct XAie_TxnCustomOps XAie_TxnCustomOps;
+typedef struct XAie_RegLocks XAie_RegLocks;
+typedef struct XAie_TxnShadow XAie_TxnShadow;
+typedef struct XAie_TxnTags XAie_TxnTags;
+typedef struct XAie_TxnCache XAie_TxnCache;
+typedef struct XAie_TxnAsync XAie_TxnAsync;
+typedef struct XAie_TxnFlushPool XAie_TxnFlushPool;
+typedef struct XAie_RegShadow XAie_RegShadow;
 
 /*
  * This typedef captures all the properties of a AIE Device
@@ -98,6 +113,7 @@ typedef enum {
 	XAIE_IO_BACKEND_DEBUG, /* IO debug backend */
 	XAIE_IO_BACKEND_LINUX, /* Linux kernel backend */
 	XAIE_IO_BACKEND_SOCKET, /* Socket backend */
+	XAIE_IO_BACKEND_MODEL, /* In memory register model backend */
 	XAIE_IO_BACKEND_MAX
 } XAie_BackendType;
 
@@ -117,6 +133,28 @@ typedef struct {
 			 * is closed. */
 } XAie_PartitionProp;
 
+/*
+ * Callback to wait for a register change once the backoff of a mask poll
+ * reached its maximum sleep. It returns 0 when woken up, for example by an
+ * event or an interrupt, or when TimeOutUs elapsed. A non-zero return value
+ * stops further calls for the current poll.
+ */
+typedef int (*XAie_PollWaitFn)(void *Arg, u64 RegOff, u32 TimeOutUs);
+
+/*
+ * This typedef captures the strategy of register mask polls. A poll busy
+ * reads the register for SpinUs, then sleeps with an exponential backoff from
+ * MinSleepUs up to MaxSleepUs and, if WaitFn is set, waits with WaitFn
+ * instead of sleeping once MaxSleepUs is reached.
+ */
+typedef struct {
+	u32 SpinUs;		/* Busy poll time in micro seconds */
+	u32 MinSleepUs;		/* First sleep of the backoff in micro seconds */
+	u32 MaxSleepUs;		/* Maximum sleep of the backoff */
+	XAie_PollWaitFn WaitFn;	/* Optional wait after the backoff */
+	void *WaitArg;		/* Argument passed to WaitFn */
+} XAie_PollConfig;
+
 /* Generic linked list structure */
 typedef struct XAie_List {
 	struct XAie_List *Next;
@@ -146,6 +184,15 @@ typedef struct {
 	XAie_PartitionProp PartProp; /* Partition property */
 	XAie_List TxnList; /* Head of the list of txn buffers */
 	XAie_List PartitionList;
+	XAie_Mutex *TxnListLock; /* Serializes updates to TxnList */
+	u32 TxnListGen; /* Generation of TxnList, changes on resets */
+	XAie_TxnCustomOps *TxnCustomOps; /* Custom op handlers */
+	XAie_RegLocks *RegLocks; /* Per column shards of register locks */
+	XAie_TxnCache *TxnCache; /* Cache of serialized transactions */
+	XAie_TxnAsync *TxnAsync; /* Queue of asynchronous submissions */
+	XAie_TxnFlushPool *TxnFlushPool; /* Workers of parallel flushes */
+	XAie_RegShadow *RegShadow; /* Shadow of configuration registers */
+	XAie_PollConfig PollCfg; /* Register mask poll strategy */
 } XAie_DevInst;
 
 /* typedef to capture transaction buffer data */
@@ -156,6 +203,10 @@ typedef struct {
 	u32 MaxCmds;
 	u8  NextCustomOp;
 	XAie_TxnCmd *CmdBuf;
+	XAie_TxnChunk *Chunks; /* Memory backing the command payloads */
+	XAie_TxnShadow *Shadow; /* Register values of the pending writes */
+	XAie_TxnTags *Tags; /* Tags of the recorded commands */
+	u32 NumTemplates; /* Templates patching the recorded commands */
 	XAie_List Node;
 } XAie_TxnInst;
 
@@ -537,6 +588,12 @@ typedef struct {
 	XAie_Range Cols;
 } XAie_ErrorMetaData;
 
+/*
+ * Header of a serialized transaction.
+ * NumOps: number of records following the header. In the compact format a
+ *	   write run record stands for several write commands.
+ * TxnSize: size of the serialized transaction including the header.
+ */
 typedef struct {
 	uint8_t Major;
 	uint8_t Minor;
@@ -640,10 +697,22 @@ AieRC XAie_SubmitTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
 XAie_TxnInst* XAie_ExportTransactionInstance(XAie_DevInst *DevInst);
 u8* XAie_ExportSerializedTransaction(XAie_DevInst *DevInst,
 		u8 NumConsumers, u32 Flags);
+AieRC XAie_GetSerializedTransactionSize(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u32 Flags, u32 *Size);
+AieRC XAie_SerializeTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 Flags, u8 *Buf, u32 BufSize);
+void XAie_FreeSerializedTransaction(void *Ptr);
+XAie_TxnInst* XAie_ImportSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size);
+AieRC XAie_SubmitSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 Size);
 AieRC XAie_FreeTransactionInstance(XAie_TxnInst *TxnInst);
 AieRC XAie_ClearTransaction(XAie_DevInst* DevInst);
 AieRC XAie_IsDeviceCheckerboard(XAie_DevInst *DevInst, u8 *IsCheckerBoard);
 AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr);
+AieRC XAie_ConfigMmapRegWrite(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_ConfigPoll(XAie_DevInst *DevInst, const XAie_PollConfig *Cfg);
+AieRC XAie_FlushIO(XAie_DevInst *DevInst);
 AieRC XAie_MapIrqIdToCols(u8 IrqId, XAie_Range *Range);
 AieRC XAie_PerfUtilization(XAie_DevInst *DevInst, XAie_PerfInst *PerfInst);
 AieRC XAie_EnquirePartitions(XAie_DevInst *DevInst);
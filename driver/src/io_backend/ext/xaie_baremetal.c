@@ -18,6 +18,7 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus   07/04/2020 Initial creation.
+* 1.1   Tejus   10/16/2026 Add block read.
 * </pre>
 *
 ******************************************************************************/
@@ -143,6 +144,35 @@ static AieRC XAie_BaremetalIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of 32bit data from the
+* specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_BaremetalIO_BlockRead32(void *IOInst, u64 RegOff,
+		u32 *Data, u32 Size)
+{
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
+
+	for(u32 i = 0U; i < Size; i++) {
+		Data[i] = Xil_In32(BaremetalIOInst->BaseAddr + RegOff +
+				i * 4U);
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -588,6 +618,17 @@ static AieRC XAie_BaremetalIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	return XAIE_ERR;
 }
 
+static AieRC XAie_BaremetalIO_BlockRead32(void *IOInst, u64 RegOff,
+		u32 *Data, u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+	return XAIE_ERR;
+}
+
 static AieRC XAie_BaremetalIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
@@ -710,6 +751,7 @@ const XAie_Backend BaremetalBackend =
 	.Ops.Finish = XAie_BaremetalIO_Finish,
 	.Ops.Write32 = XAie_BaremetalIO_Write32,
 	.Ops.Read32 = XAie_BaremetalIO_Read32,
+	.Ops.BlockRead32 = XAie_BaremetalIO_BlockRead32,
 	.Ops.MaskWrite32 = XAie_BaremetalIO_MaskWrite32,
 	.Ops.MaskPoll = XAie_BaremetalIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_BaremetalIO_BlockWrite32,
@@ -17,6 +17,8 @@
 * Ver   Who     Date        Changes
 * ----- ------  --------    ---------------------------------------------------
 * 1.0   Dishita 03/08/2021  Initial creation
+* 1.1   Tejus   10/16/2026  Add adaptive register mask poll
+* 1.2   Tejus   10/16/2026  Add vectorized memory copy and fill
 *
 * </pre>
 *
@@ -24,11 +26,30 @@
 /***************************** Include Files *********************************/
 #include <stdlib.h>
 #include <string.h>
+#ifdef __linux__
+#include <time.h>
+#include <unistd.h>
+#endif
 
 #include "xaie_feature_config.h"
 #include "xaie_io.h"
 #include "xaie_helper.h"
 #include "xaie_helper_internal.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define XAIE_IO_SIMD_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#define XAIE_IO_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/***************************** Macro Definitions *****************************/
+/* Transfers below this number of words are copied one word at a time */
+#define XAIE_IO_SIMD_MIN_WORDS		16U
+/* Transfers from this number of words bypass the cache */
+#define XAIE_IO_NT_MIN_WORDS		2048U
+
 /*****************************************************************************/
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -76,4 +97,483 @@ void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 	}
 }
 
+/*****************************************************************************/
+/**
+* This function copies 32-bit words one at a time.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_IOCommon_CopyScalar(u32 *Dest, const u32 *Src,
+		u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		Dest[i] = Src[i];
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function fills 32-bit words one at a time.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Value: Value to fill the words with.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_IOCommon_SetScalar(u32 *Dest, u32 Value, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		Dest[i] = Value;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of words to write one at a time before the
+* destination is aligned to a vector of Align bytes.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Size: Number of 32-bit words.
+* @param	Align: Vector size in bytes.
+*
+* @return	Number of words before the aligned destination.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_IOCommon_HeadWords(const u32 *Dest, u32 Size,
+		u32 Align)
+{
+	u32 Head;
+
+	Head = (u32)(((Align - ((uintptr_t)Dest & (Align - 1U))) &
+				(Align - 1U)) / sizeof(u32));
+
+	return (Head < Size) ? Head : Size;
+}
+
+#ifdef XAIE_IO_SIMD_X86
+/*****************************************************************************/
+/**
+* This function copies 32-bit words with aligned 128-bit SSE2 stores. Large
+* copies use non-temporal stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("sse2")))
+static void _XAie_IOCommon_CopySse2(u32 *Dest, const u32 *Src, u32 Size)
+{
+	u32 Head = _XAie_IOCommon_HeadWords(Dest, Size, 16U);
+	u32 NumVec;
+	__m128i *VDest;
+
+	_XAie_IOCommon_CopyScalar(Dest, Src, Head);
+	Dest += Head;
+	Src += Head;
+	Size -= Head;
+
+	NumVec = Size / 4U;
+	VDest = (__m128i *)Dest;
+	if(Size >= XAIE_IO_NT_MIN_WORDS) {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm_stream_si128(&VDest[i], _mm_loadu_si128(
+						(const __m128i *)Src + i));
+		}
+		_mm_sfence();
+	} else {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm_store_si128(&VDest[i], _mm_loadu_si128(
+						(const __m128i *)Src + i));
+		}
+	}
+
+	_XAie_IOCommon_CopyScalar(Dest + NumVec * 4U, Src + NumVec * 4U,
+			Size - NumVec * 4U);
+}
+
+/*****************************************************************************/
+/**
+* This function fills 32-bit words with aligned 128-bit SSE2 stores. Large
+* fills use non-temporal stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Value: Value to fill the words with.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("sse2")))
+static void _XAie_IOCommon_SetSse2(u32 *Dest, u32 Value, u32 Size)
+{
+	u32 Head = _XAie_IOCommon_HeadWords(Dest, Size, 16U);
+	__m128i Vec = _mm_set1_epi32((int)Value);
+	u32 NumVec;
+	__m128i *VDest;
+
+	_XAie_IOCommon_SetScalar(Dest, Value, Head);
+	Dest += Head;
+	Size -= Head;
+
+	NumVec = Size / 4U;
+	VDest = (__m128i *)Dest;
+	if(Size >= XAIE_IO_NT_MIN_WORDS) {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm_stream_si128(&VDest[i], Vec);
+		}
+		_mm_sfence();
+	} else {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm_store_si128(&VDest[i], Vec);
+		}
+	}
+
+	_XAie_IOCommon_SetScalar(Dest + NumVec * 4U, Value,
+			Size - NumVec * 4U);
+}
+
+/*****************************************************************************/
+/**
+* This function copies 32-bit words with aligned 256-bit AVX2 stores. Large
+* copies use non-temporal stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("avx2")))
+static void _XAie_IOCommon_CopyAvx2(u32 *Dest, const u32 *Src, u32 Size)
+{
+	u32 Head = _XAie_IOCommon_HeadWords(Dest, Size, 32U);
+	u32 NumVec;
+	__m256i *VDest;
+
+	_XAie_IOCommon_CopyScalar(Dest, Src, Head);
+	Dest += Head;
+	Src += Head;
+	Size -= Head;
+
+	NumVec = Size / 8U;
+	VDest = (__m256i *)Dest;
+	if(Size >= XAIE_IO_NT_MIN_WORDS) {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm256_stream_si256(&VDest[i], _mm256_loadu_si256(
+						(const __m256i *)Src + i));
+		}
+		_mm_sfence();
+	} else {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm256_store_si256(&VDest[i], _mm256_loadu_si256(
+						(const __m256i *)Src + i));
+		}
+	}
+
+	_XAie_IOCommon_CopyScalar(Dest + NumVec * 8U, Src + NumVec * 8U,
+			Size - NumVec * 8U);
+}
+
+/*****************************************************************************/
+/**
+* This function fills 32-bit words with aligned 256-bit AVX2 stores. Large
+* fills use non-temporal stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Value: Value to fill the words with.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("avx2")))
+static void _XAie_IOCommon_SetAvx2(u32 *Dest, u32 Value, u32 Size)
+{
+	u32 Head = _XAie_IOCommon_HeadWords(Dest, Size, 32U);
+	__m256i Vec = _mm256_set1_epi32((int)Value);
+	u32 NumVec;
+	__m256i *VDest;
+
+	_XAie_IOCommon_SetScalar(Dest, Value, Head);
+	Dest += Head;
+	Size -= Head;
+
+	NumVec = Size / 8U;
+	VDest = (__m256i *)Dest;
+	if(Size >= XAIE_IO_NT_MIN_WORDS) {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm256_stream_si256(&VDest[i], Vec);
+		}
+		_mm_sfence();
+	} else {
+		for(u32 i = 0U; i < NumVec; i++) {
+			_mm256_store_si256(&VDest[i], Vec);
+		}
+	}
+
+	_XAie_IOCommon_SetScalar(Dest + NumVec * 8U, Value,
+			Size - NumVec * 8U);
+}
+#endif /* XAIE_IO_SIMD_X86 */
+
+#ifdef XAIE_IO_SIMD_NEON
+/*****************************************************************************/
+/**
+* This function copies 32-bit words with aligned 128-bit NEON stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IOCommon_CopyNeon(u32 *Dest, const u32 *Src, u32 Size)
+{
+	u32 Head = _XAie_IOCommon_HeadWords(Dest, Size, 16U);
+	u32 NumVec;
+
+	_XAie_IOCommon_CopyScalar(Dest, Src, Head);
+	Dest += Head;
+	Src += Head;
+	Size -= Head;
+
+	NumVec = Size / 4U;
+	for(u32 i = 0U; i < NumVec; i++) {
+		vst1q_u32(Dest + i * 4U, vld1q_u32(Src + i * 4U));
+	}
+
+	_XAie_IOCommon_CopyScalar(Dest + NumVec * 4U, Src + NumVec * 4U,
+			Size - NumVec * 4U);
+}
+
+/*****************************************************************************/
+/**
+* This function fills 32-bit words with aligned 128-bit NEON stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Value: Value to fill the words with.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IOCommon_SetNeon(u32 *Dest, u32 Value, u32 Size)
+{
+	u32 Head = _XAie_IOCommon_HeadWords(Dest, Size, 16U);
+	uint32x4_t Vec = vdupq_n_u32(Value);
+	u32 NumVec;
+
+	_XAie_IOCommon_SetScalar(Dest, Value, Head);
+	Dest += Head;
+	Size -= Head;
+
+	NumVec = Size / 4U;
+	for(u32 i = 0U; i < NumVec; i++) {
+		vst1q_u32(Dest + i * 4U, Vec);
+	}
+
+	_XAie_IOCommon_SetScalar(Dest + NumVec * 4U, Value,
+			Size - NumVec * 4U);
+}
+#endif /* XAIE_IO_SIMD_NEON */
+
+/*****************************************************************************/
+/**
+* This API copies 32-bit words to memory mapped device memory. The widest
+* vector stores supported by the CPU are selected at runtime, and large copies
+* use non-temporal stores where available.
+*
+* @param	Dest: Pointer to the 32-bit aligned destination address.
+* @param	Src: Pointer to the 32-bit aligned source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_IOCommon_CopyWords(u32 *Dest, const u32 *Src, u32 Size)
+{
+	if(Size < XAIE_IO_SIMD_MIN_WORDS) {
+		_XAie_IOCommon_CopyScalar(Dest, Src, Size);
+		return;
+	}
+
+#if defined(XAIE_IO_SIMD_X86)
+	if(__builtin_cpu_supports("avx2")) {
+		_XAie_IOCommon_CopyAvx2(Dest, Src, Size);
+		return;
+	}
+	if(__builtin_cpu_supports("sse2")) {
+		_XAie_IOCommon_CopySse2(Dest, Src, Size);
+		return;
+	}
+#elif defined(XAIE_IO_SIMD_NEON)
+	_XAie_IOCommon_CopyNeon(Dest, Src, Size);
+	return;
+#endif
+
+	_XAie_IOCommon_CopyScalar(Dest, Src, Size);
+}
+
+/*****************************************************************************/
+/**
+* This API fills memory mapped device memory with a 32-bit value. The widest
+* vector stores supported by the CPU are selected at runtime, and large fills
+* use non-temporal stores where available.
+*
+* @param	Dest: Pointer to the 32-bit aligned destination address.
+* @param	Value: Value to fill the words with.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_IOCommon_SetWords(u32 *Dest, u32 Value, u32 Size)
+{
+	if(Size < XAIE_IO_SIMD_MIN_WORDS) {
+		_XAie_IOCommon_SetScalar(Dest, Value, Size);
+		return;
+	}
+
+#if defined(XAIE_IO_SIMD_X86)
+	if(__builtin_cpu_supports("avx2")) {
+		_XAie_IOCommon_SetAvx2(Dest, Value, Size);
+		return;
+	}
+	if(__builtin_cpu_supports("sse2")) {
+		_XAie_IOCommon_SetSse2(Dest, Value, Size);
+		return;
+	}
+#elif defined(XAIE_IO_SIMD_NEON)
+	_XAie_IOCommon_SetNeon(Dest, Value, Size);
+	return;
+#endif
+
+	_XAie_IOCommon_SetScalar(Dest, Value, Size);
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+* This function returns the time of the monotonic clock in micro seconds.
+*
+* @return	Time in micro seconds.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u64 _XAie_IOCommon_TimeUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return (u64)Ts.tv_sec * 1000000U + (u64)Ts.tv_nsec / 1000U;
+}
+
+/*****************************************************************************/
+/**
+* This API polls a register until the masked value matches. The register is
+* first busy polled, then read between sleeps growing exponentially, and
+* finally read after each call of the wait callback if one is configured.
+*
+* @param	IOInst: IO instance pointer
+* @param	Cfg: Poll configuration of the device instance
+* @param	Read32: Backend function to read a register
+* @param	RegOff: Register offset to poll.
+* @param	Mask: Mask to be applied to the register value.
+* @param	Value: 32-bit value to poll for
+* @param	TimeOutUs: Timeout in micro seconds.
+*
+* @return	XAIE_OK if the value matched, XAIE_ERR on timeout, or the error
+*		code of the register read.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_IOCommon_MaskPoll(void *IOInst, const XAie_PollConfig *Cfg,
+		AieRC (*Read32)(void *IOInst, u64 RegOff, u32 *Data),
+		u64 RegOff, u32 Mask, u32 Value, u32 TimeOutUs)
+{
+	XAie_PollConfig Poll = *Cfg;
+	u64 Start, Now, SpinEnd, End;
+	u32 RegVal, SleepUs;
+	AieRC RC;
+
+	Start = _XAie_IOCommon_TimeUs();
+	End = Start + TimeOutUs;
+	SpinEnd = Start + ((Poll.SpinUs < TimeOutUs) ? Poll.SpinUs : TimeOutUs);
+	SleepUs = Poll.MinSleepUs;
+
+	while(1) {
+		RC = Read32(IOInst, RegOff, &RegVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		if((RegVal & Mask) == Value) {
+			return XAIE_OK;
+		}
+
+		Now = _XAie_IOCommon_TimeUs();
+		if(Now >= End) {
+			return XAIE_ERR;
+		}
+		if(Now < SpinEnd) {
+			continue;
+		}
+
+		if(SleepUs > End - Now) {
+			SleepUs = (u32)(End - Now);
+		}
+
+		if((SleepUs >= Poll.MaxSleepUs) && (Poll.WaitFn != NULL)) {
+			if(Poll.WaitFn(Poll.WaitArg, RegOff,
+						(u32)(End - Now)) != 0) {
+				Poll.WaitFn = NULL;
+			}
+			continue;
+		}
+
+		usleep(SleepUs);
+		if(SleepUs < Poll.MaxSleepUs) {
+			SleepUs = (SleepUs * 2U < Poll.MaxSleepUs) ?
+				SleepUs * 2U : Poll.MaxSleepUs;
+		}
+	}
+}
+#endif /* __linux__ */
+
 /** @} */
@@ -18,6 +18,8 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus   01/20/2021 Initial creation.
+* 1.1   Tejus   10/16/2026 Add adaptive register mask poll.
+* 1.2   Tejus   10/16/2026 Add vectorized memory copy and fill.
 * </pre>
 *
 ******************************************************************************/
@@ -38,6 +40,13 @@ static inline int XAie_IODummyGetPartFd(void *IOInst)
 
 void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 		XAie_BackendTilesArray *Args);
+void _XAie_IOCommon_CopyWords(u32 *Dest, const u32 *Src, u32 Size);
+void _XAie_IOCommon_SetWords(u32 *Dest, u32 Value, u32 Size);
+#ifdef __linux__
+AieRC _XAie_IOCommon_MaskPoll(void *IOInst, const XAie_PollConfig *Cfg,
+		AieRC (*Read32)(void *IOInst, u64 RegOff, u32 *Data),
+		u64 RegOff, u32 Mask, u32 Value, u32 TimeOutUs);
+#endif
 
 #endif /* XAIE_IO_COMMON_H */
 
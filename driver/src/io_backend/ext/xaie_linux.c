@@ -17,6 +17,13 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus    07/29/2020  Initial creation
+* 1.1   Tejus    10/16/2026  Synchronize partition fd ioctls
+* 1.2   Tejus    10/16/2026  Add register writes through writable mapping
+* 1.3   Tejus    10/16/2026  Submit register block writes in one ioctl
+* 1.4   Tejus    10/16/2026  Use adaptive register mask poll
+* 1.5   Tejus    10/16/2026  Use vectorized copy and fill for memories
+* 1.6   Tejus    10/16/2026  Add per tile classification table
+* 1.7   Tejus    10/16/2026  Add block read
 * </pre>
 *
 ******************************************************************************/
@@ -49,7 +56,6 @@
 #include "xaie_npi.h"
 
 /***************************** Macro Definitions *****************************/
-#define XAIE_128BIT_ALIGN_MASK 0xFF
 #define XAIE_DEVICE_FILE "/dev/aie0"
 
 #ifdef __AIELINUX__
@@ -67,11 +73,26 @@ typedef struct XAie_MemMap {
 	u64 MapSize;
 } XAie_MemMap;
 
+/*
+ * Classification of a tile of the partition. Memory bases point to the mapping
+ * of the tile memories, with the tile offset of the memory already applied.
+ */
+typedef struct XAie_LinuxTile {
+	u8 TileType;		/* Tile type, XAIEGBL_TILE_TYPE_MAX if invalid */
+	u8 Gated;		/* 1 if the tile is not in use */
+	u8 *ProgMem;		/* Base of program memory, NULL if none */
+	u8 *Mem;		/* Base of data or mem tile memory, NULL if none */
+	u64 ProgMemEnd;		/* End offset of program memory in the tile */
+	u64 MemAddr;		/* Start offset of Mem in the tile */
+	u64 MemEnd;		/* End offset of Mem in the tile */
+} XAie_LinuxTile;
+
 typedef struct XAie_LinuxIO {
 	XAie_DevInst *DevInst;
 	int DeviceFd;		/* File descriptor of the device */
 	int PartitionFd;	/* File descriptor of the partition */
 	XAie_MemMap RegMap;	/* Read only mapping of registers */
+	XAie_MemMap RegWrMap;	/* Writable mapping of registers, if granted */
 	XAie_MemMap ProgMem;	/* Mapping of program memory of aie */
 	XAie_MemMap DataMem;  	/* Mapping of data memory of aie */
 	XAie_MemMap MemTileMem;	/* Mapping of memory tile mem */
@@ -87,6 +108,11 @@ typedef struct XAie_LinuxIO {
 	u8 RowShift;
 	u8 ColShift;
 	u64 BaseAddr;
+	u8 MmapWrite;		/* Write registers through RegWrMap */
+	XAie_LinuxTile *Tiles;	/* Classification of tiles, column major */
+	pthread_rwlock_t PartLock; /* Held exclusive by partition and tile
+				      state changes, shared by register
+				      accesses */
 } XAie_LinuxIO;
 
 typedef struct XAie_LinuxMem {
@@ -155,6 +181,157 @@ static inline u8 _XAie_GetColNum(XAie_LinuxIO *IOInst, u64 RegOff)
 	return RegOff >> IOInst->ColShift;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function computes the offset from the memory mapped region for a given
+* Col, Row coordinate of the aie tile.
+*
+* @param	IOInst: IO instance pointer
+* @param	Col: Column number
+* @param	Row: Row number
+* @param	MemSize: Total size of the PM/DM for the aie tile.
+*
+* @return	Memory offset.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u64 _XAie_GetMemOffset(XAie_LinuxIO *IOInst, u8 TileType, u8 Col,
+		u8 Row, u64 MemSize)
+{
+	u8 AieTileNumRows = IOInst->DevInst->AieTileNumRows;
+	u8 MemTileNumRows = IOInst->DevInst->MemTileNumRows;
+
+	if(TileType == XAIEGBL_TILE_TYPE_AIETILE)
+		return (u64)(Col * AieTileNumRows * MemSize) +
+			((u64)(Row - MemTileNumRows - 1) * MemSize);
+	else if(TileType == XAIEGBL_TILE_TYPE_MEMTILE)
+		return (u64)(Col * MemTileNumRows * MemSize) +
+			((u64)(Row - 1) * MemSize);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the classification of the tile of a register offset.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset.
+*
+* @return	Pointer to the tile classification, NULL if the offset is outside
+*		of the partition.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline const XAie_LinuxTile *_XAie_LinuxIO_GetTile(
+		XAie_LinuxIO *IOInst, u64 RegOff)
+{
+	u8 Row = _XAie_GetRowNum(IOInst, RegOff);
+	u8 Col = _XAie_GetColNum(IOInst, RegOff);
+
+	if((Row >= IOInst->NumRows) || (Col >= IOInst->NumCols)) {
+		return NULL;
+	}
+
+	return &IOInst->Tiles[Col * IOInst->NumRows + Row];
+}
+
+/*****************************************************************************/
+/**
+*
+* This function updates the gated state of the tile classification table from
+* the bitmap of tiles in use.
+*
+* @param	IOInst: IO instance pointer
+*
+* @return	None.
+*
+* @note		Internal only. Called with the partition lock held exclusive.
+*
+*******************************************************************************/
+static void _XAie_LinuxIO_UpdateTileGating(XAie_LinuxIO *IOInst)
+{
+	XAie_DevInst *DevInst = IOInst->DevInst;
+
+	for(u8 C = 0U; C < IOInst->NumCols; C++) {
+		for(u8 R = 1U; R < IOInst->NumRows; R++) {
+			u32 Bit = _XAie_GetTileBitPosFromLoc(DevInst,
+					XAie_TileLoc(C, R));
+
+			IOInst->Tiles[C * IOInst->NumRows + R].Gated =
+				CheckBit(DevInst->DevOps->TilesInUse, Bit) ?
+				0U : 1U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds the tile classification table of the partition. It must
+* be called after the memories are mapped.
+*
+* @param	IOInst: IO instance pointer
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_BuildTiles(XAie_LinuxIO *IOInst)
+{
+	XAie_DevInst *DevInst = IOInst->DevInst;
+
+	IOInst->Tiles = (XAie_LinuxTile *)calloc((size_t)IOInst->NumCols *
+			IOInst->NumRows, sizeof(*IOInst->Tiles));
+	if(IOInst->Tiles == NULL) {
+		XAIE_ERROR("Failed to allocate tile classification table\n");
+		return XAIE_ERR;
+	}
+
+	for(u8 C = 0U; C < IOInst->NumCols; C++) {
+		for(u8 R = 0U; R < IOInst->NumRows; R++) {
+			XAie_LinuxTile *Tile =
+				&IOInst->Tiles[C * IOInst->NumRows + R];
+
+			Tile->TileType = DevInst->DevOps->GetTTypefromLoc(
+					DevInst, XAie_TileLoc(C, R));
+			if(Tile->TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+				Tile->ProgMem = (u8 *)IOInst->ProgMem.VAddr +
+					_XAie_GetMemOffset(IOInst,
+						Tile->TileType, C, R,
+						IOInst->ProgMemSize);
+				Tile->ProgMemEnd = IOInst->ProgMemAddr +
+					IOInst->ProgMemSize;
+				Tile->Mem = (u8 *)IOInst->DataMem.VAddr +
+					_XAie_GetMemOffset(IOInst,
+						Tile->TileType, C, R,
+						IOInst->DataMemSize);
+				Tile->MemAddr = IOInst->DataMemAddr;
+				Tile->MemEnd = IOInst->DataMemAddr +
+					IOInst->DataMemSize;
+			} else if((Tile->TileType == XAIEGBL_TILE_TYPE_MEMTILE)
+					&& (IOInst->MemTileMem.VAddr != NULL)) {
+				Tile->Mem = (u8 *)IOInst->MemTileMem.VAddr +
+					_XAie_GetMemOffset(IOInst,
+						Tile->TileType, C, R,
+						IOInst->MemTileMemSize);
+				Tile->MemAddr = IOInst->MemTileMemAddr;
+				Tile->MemEnd = IOInst->MemTileMemAddr +
+					IOInst->MemTileMemSize;
+			}
+		}
+	}
+
+	_XAie_LinuxIO_UpdateTileGating(IOInst);
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -175,6 +352,9 @@ static AieRC XAie_LinuxIO_Finish(void *IOInst)
 		LinuxIOInst->DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_MEMTILE].MemMod;
 
 	munmap(LinuxIOInst->RegMap.VAddr, LinuxIOInst->RegMap.MapSize);
+	if(LinuxIOInst->RegWrMap.VAddr != NULL)
+		munmap(LinuxIOInst->RegWrMap.VAddr,
+				LinuxIOInst->RegWrMap.MapSize);
 	if(MemTileMod != NULL)
 		munmap(LinuxIOInst->MemTileMem.VAddr, LinuxIOInst->MemTileMem.MapSize);
 	munmap(LinuxIOInst->ProgMem.VAddr, LinuxIOInst->ProgMem.MapSize);
@@ -186,7 +366,9 @@ static AieRC XAie_LinuxIO_Finish(void *IOInst)
 		close(LinuxIOInst->MemTileMem.Fd);
 	close(LinuxIOInst->PartitionFd);
 	close(LinuxIOInst->DeviceFd);
+	pthread_rwlock_destroy(&LinuxIOInst->PartLock);
 
+	free(LinuxIOInst->Tiles);
 	free(IOInst);
 
 	return XAIE_OK;
@@ -473,10 +655,18 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 		return XAIE_ERR;
 	}
 
+	if(pthread_rwlock_init(&IOInst->PartLock, NULL) != 0) {
+		XAIE_ERROR("Initialization failed. Failed to initialize "
+				"partition lock\n");
+		free(IOInst);
+		return XAIE_ERR;
+	}
+
 	Fd = open(XAIE_DEVICE_FILE, O_RDWR);
 	if(Fd < 0) {
 		XAIE_ERROR("Failed to open aie device %s, %d: %s\n",
 			"/dev/aie0", errno, strerror(errno));
+		pthread_rwlock_destroy(&IOInst->PartLock);
 		free(IOInst);
 		return XAIE_ERR;
 	}
@@ -485,9 +675,17 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 	IOInst->ColShift = DevInst->DevProp.ColShift;
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->DeviceFd = Fd;
+	IOInst->RegWrMap.VAddr = NULL;
+	IOInst->RegWrMap.MapSize = 0U;
+	IOInst->MmapWrite = 0U;
+	IOInst->Tiles = NULL;
+	IOInst->ProgMem.VAddr = NULL;
+	IOInst->DataMem.VAddr = NULL;
+	IOInst->MemTileMem.VAddr = NULL;
 
 	RC = _XAie_LinuxIO_GetPartition(DevInst, IOInst);
 	if(RC != XAIE_OK) {
+		pthread_rwlock_destroy(&IOInst->PartLock);
 		free(IOInst);
 		return RC;
 	}
@@ -497,6 +695,7 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 
 	RC = _XAie_LinuxIO_MapMemory(DevInst, IOInst);
 	if(RC != XAIE_OK) {
+		pthread_rwlock_destroy(&IOInst->PartLock);
 		free(IOInst);
 		return XAIE_ERR;
 	}
@@ -507,12 +706,51 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 	_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse, SetTileStatus,
 				NumTiles);
 
-	DevInst->IOInst = (void *)IOInst;
 	IOInst->DevInst = DevInst;
+	RC = _XAie_LinuxIO_BuildTiles(IOInst);
+	if(RC != XAIE_OK) {
+		pthread_rwlock_destroy(&IOInst->PartLock);
+		free(IOInst);
+		return RC;
+	}
+
+	DevInst->IOInst = (void *)IOInst;
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function checks if a register can be written through the writable
+* register mapping instead of the register ioctl.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write to.
+*
+* @return	1 if the register can be written through the mapping, else 0.
+*
+* @note		Registers of the shim row, which include the clock, reset and
+*		protection registers owned by the kernel, and registers of
+*		gated tiles are always written by the kernel. Internal only.
+*
+*******************************************************************************/
+static inline u8 _XAie_LinuxIO_IsMmapWritable(XAie_LinuxIO *IOInst,
+		u64 RegOff)
+{
+	const XAie_LinuxTile *Tile;
+
+	if((IOInst->MmapWrite == 0U) ||
+			(RegOff + sizeof(u32) > IOInst->RegWrMap.MapSize) ||
+			(_XAie_GetRowNum(IOInst, RegOff) == 0U)) {
+		return 0U;
+	}
+
+	Tile = _XAie_LinuxIO_GetTile(IOInst, RegOff);
+
+	return ((Tile != NULL) && (Tile->Gated == 0U)) ? 1U : 0U;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -527,12 +765,18 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+static AieRC _XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 	int Ret;
 	struct aie_reg_args Args;
 
+	if(_XAie_LinuxIO_IsMmapWritable(LinuxIOInst, RegOff)) {
+		*((volatile u32 *)(LinuxIOInst->RegWrMap.VAddr + RegOff)) =
+			Value;
+		return XAIE_OK;
+	}
+
 	Args.op = AIE_REG_WRITE;
 	Args.offset = RegOff;
 	Args.val = Value;
@@ -552,6 +796,33 @@ static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write 32bit data to the specified address
+* with the partition lock held shared.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: 32-bit data to be written.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC;
+
+	pthread_rwlock_rdlock(&LinuxIOInst->PartLock);
+	RC = _XAie_LinuxIO_Write32(IOInst, RegOff, Value);
+	pthread_rwlock_unlock(&LinuxIOInst->PartLock);
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -566,48 +837,28 @@ static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+static AieRC _XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
-	u32 ColClockStatus;
-	u64 OffsetAddr = 0U, MemSize = 0U;
-	XAie_DevInst *DevInst = LinuxIOInst->DevInst;
-	u8 Row = _XAie_GetRowNum(LinuxIOInst, RegOff);
-	u8 Col = _XAie_GetColNum(LinuxIOInst, RegOff);
-	XAie_LocType Loc = {Row, Col};
-
-	/*
-	 * Check bitmap position of the requested tile, If it is
-	 * gated tile return XAIE_INVALID_TILE,
-	 */
-	if(Row != 0U) {
-		ColClockStatus = _XAie_GetTileBitPosFromLoc(DevInst,Loc);
-		if(!CheckBit(DevInst->DevOps->TilesInUse, ColClockStatus)) {
-			XAIE_ERROR("Tile(%d,%d) is gated \n",Col,Row);
+	const XAie_LinuxTile *Tile = _XAie_LinuxIO_GetTile(LinuxIOInst, RegOff);
+	u64 RegAddr;
+
+	if(Tile != NULL) {
+		/* Gated tiles return XAIE_INVALID_TILE */
+		if(Tile->Gated != 0U) {
+			XAIE_ERROR("Tile(%d,%d) is gated \n",
+					_XAie_GetColNum(LinuxIOInst, RegOff),
+					_XAie_GetRowNum(LinuxIOInst, RegOff));
 			return XAIE_INVALID_TILE;
 		}
-	}
 
-	u8 TileType = XAie_GetTileTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-		OffsetAddr = LinuxIOInst->DataMemAddr + XAie_GetTileAddr(DevInst, Row, Col);
-		MemSize = OffsetAddr + LinuxIOInst->DataMemSize;
-	} else if(TileType == XAIEGBL_TILE_TYPE_MEMTILE) {
-		OffsetAddr = LinuxIOInst->MemTileMemAddr + XAie_GetTileAddr(DevInst, Row, Col);
-		MemSize = OffsetAddr + LinuxIOInst->MemTileMemSize;
-	}
-
-	if(RegOff >= OffsetAddr && RegOff <=  MemSize) {
-		if((RegOff+sizeof(u32)) > MemSize) {
+		RegAddr = _XAie_GetRegAddr(LinuxIOInst, RegOff);
+		if((Tile->Mem != NULL) && (RegAddr < Tile->MemEnd) &&
+				(RegAddr + sizeof(u32) > Tile->MemEnd)) {
 			XAIE_ERROR(" Reading register failed for offset 0x%lx",
 					RegOff);
 			return XAIE_ERR;
 		}
-	} else if(RegOff < OffsetAddr && ((RegOff+sizeof(u32)) >= OffsetAddr
-				&& (RegOff+sizeof(u32)) <=  MemSize)) {
-		XAIE_ERROR(" Reading register failed for offset 0x%lx",
-					RegOff);
-		return XAIE_ERR;
 	}
 
 	*Data = *((u32 *)(LinuxIOInst->RegMap.VAddr + RegOff));
@@ -615,6 +866,33 @@ static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read 32bit data from the specified address
+* with the partition lock held shared.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the 32 bit value
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC;
+
+	pthread_rwlock_rdlock(&LinuxIOInst->PartLock);
+	RC = _XAie_LinuxIO_Read32(IOInst, RegOff, Data);
+	pthread_rwlock_unlock(&LinuxIOInst->PartLock);
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -637,6 +915,15 @@ static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 	int Ret;
 	struct aie_reg_args Args;
+	volatile u32 *Reg;
+
+	pthread_rwlock_rdlock(&LinuxIOInst->PartLock);
+	if(_XAie_LinuxIO_IsMmapWritable(LinuxIOInst, RegOff)) {
+		Reg = (volatile u32 *)(LinuxIOInst->RegWrMap.VAddr + RegOff);
+		*Reg = (*Reg & ~Mask) | (Value & Mask);
+		pthread_rwlock_unlock(&LinuxIOInst->PartLock);
+		return XAIE_OK;
+	}
 
 	Args.op = AIE_REG_WRITE;
 	Args.offset = RegOff;
@@ -648,6 +935,7 @@ static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 	 * check for errors. Kernels prints error messages anyway.
 	 */
 	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_REG_IOCTL, &Args);
+	pthread_rwlock_unlock(&LinuxIOInst->PartLock);
 	if(Ret < 0) {
 		XAIE_ERROR("Register write failed for offset 0x%lx, %d: %s\n",
 			RegOff, errno, strerror(errno));
@@ -676,199 +964,210 @@ static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_LinuxIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			return XAIE_OK;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 
-	/* Check for the break from timed-out loop */
-	XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
-	if((RegVal & Mask) == Value) {
-		return XAIE_OK;
-	}
+	return _XAie_IOCommon_MaskPoll(IOInst, &LinuxIOInst->DevInst->PollCfg,
+			XAie_LinuxIO_Read32, RegOff, Mask, Value, TimeOutUs);
+}
 
-	return XAIE_ERR;
+/*****************************************************************************/
+/**
+*
+* This function copies data to the device with the widest stores supported by
+* the CPU. The function accepts a 32 bit aligned address. Unaligned head and
+* tail words are written one at a time.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CopyDataToMem(u32 *Dest, const u32 *Src, u32 Size)
+{
+	_XAie_IOCommon_CopyWords(Dest, Src, Size);
 }
 
 /*****************************************************************************/
 /**
 *
-* This function computes the offset from the memory mapped region for a given
-* Col, Row coordinate of the aie tile.
+* This function returns the virtual address of the memory mapped PM/DM section
+* of the array given a register offset.
 *
 * @param	IOInst: IO instance pointer
-* @param	Col: Column number
-* @param	Row: Row number
-* @param	MemSize: Total size of the PM/DM for the aie tile.
+* @param	RegOff: Register offset to read from.
+* @param	Size: Number of 32-bit words.
 *
-* @return	Memory offset.
+* @return	Valid address on success. NULL on non PM/DM register offset.
 *
 * @note		Internal only.
 *
 *******************************************************************************/
-static inline u64 _XAie_GetMemOffset(XAie_LinuxIO *IOInst, u8 TileType, u8 Col,
-		u8 Row, u64 MemSize)
+static u32* _XAie_GetVirtAddrFromOffset(XAie_LinuxIO *IOInst, u64 RegOff,
+		u32 Size)
 {
-	u8 AieTileNumRows = IOInst->DevInst->AieTileNumRows;
-	u8 MemTileNumRows = IOInst->DevInst->MemTileNumRows;
+	const XAie_LinuxTile *Tile = _XAie_LinuxIO_GetTile(IOInst, RegOff);
+	u64 RegAddr = _XAie_GetRegAddr(IOInst, RegOff);
+	u64 RegEnd = RegAddr + (u64)Size * sizeof(u32);
 
-	if(TileType == XAIEGBL_TILE_TYPE_AIETILE)
-		return (u64)(Col * AieTileNumRows * MemSize) +
-			((u64)(Row - MemTileNumRows - 1) * MemSize);
-	else if(TileType == XAIEGBL_TILE_TYPE_MEMTILE)
-		return (u64)(Col * MemTileNumRows * MemSize) +
-			((u64)(Row - 1) * MemSize);
+	if(Tile == NULL) {
+		return NULL;
+	}
 
-	return 0;
+	/* Gated tiles return XAIE_INVALID_TILE */
+	if(Tile->Gated != 0U) {
+		XAIE_ERROR("Tile(%d,%d) is gated \n",
+				_XAie_GetColNum(IOInst, RegOff),
+				_XAie_GetRowNum(IOInst, RegOff));
+		return (u32 *)XAIE_INVALID_TILE;
+	}
+
+	if((Tile->ProgMem != NULL) && (RegAddr >= IOInst->ProgMemAddr) &&
+			(RegEnd <= Tile->ProgMemEnd)) {
+		/* Handle program memory block write */
+		return (u32 *)(Tile->ProgMem + RegAddr - IOInst->ProgMemAddr);
+	}
+
+	if((Tile->Mem != NULL) && (RegAddr >= Tile->MemAddr) &&
+			(RegEnd <= Tile->MemEnd)) {
+		/* Handle data memory and mem tile memory block write */
+		return (u32 *)(Tile->Mem + RegAddr - Tile->MemAddr);
+	}
+
+	return NULL;
 }
 
 /*****************************************************************************/
 /**
 *
-* This function copies data to the device using memcpy. The function accepts
-* a 32 bit aligned address. 128bit unaligned addresses are managed within the
-* funtion.
+* This function writes a block of registers outside of the program and data
+* memories. The block is written through the writable register mapping if
+* enabled, else it is submitted to the kernel as a single command transaction.
 *
-* @param	Dest: Pointer to the destination address.
-* @param	Src: Pointer to the source buffer.
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write to.
+* @param	Data: Pointer to the data buffer, NULL to set all the registers
+*		to Value.
+* @param	Value: Value to set the registers to if Data is NULL.
 * @param	Size: Number of 32-bit words.
 *
-* @return	None.
+* @return	XAIE_OK on success, error code on failure.
 *
-* @note		Internal only.
+* @note		Internal only. Called with the partition lock held shared.
 *
 *******************************************************************************/
-static void _XAie_CopyDataToMem(u32 *Dest, const u32 *Src, u32 Size)
+static AieRC _XAie_LinuxIO_BlockRegWrite(XAie_LinuxIO *IOInst, u64 RegOff,
+		const u32 *Data, u32 Value, u32 Size)
 {
-	u32 StartExtraWrds = 0, EndExtraWrds = 0;
+	int Ret;
+	volatile u32 *Reg;
+	struct aie_txn_inst Args;
+	XAie_TxnCmd Cmd;
+	AieRC RC = XAIE_OK;
 
-	if((u64)Dest & XAIE_128BIT_ALIGN_MASK) {
-		StartExtraWrds = ((XAIE_128BIT_ALIGN_MASK + 1) -
-				(((u64)Dest) & XAIE_128BIT_ALIGN_MASK)) / 4;
+	if(Size == 0U) {
+		return XAIE_OK;
 	}
 
-	if(StartExtraWrds > 0) {
-		for(u8 i = 0; i < StartExtraWrds && Size > 0;  i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
+	if(_XAie_LinuxIO_IsMmapWritable(IOInst, RegOff) &&
+			_XAie_LinuxIO_IsMmapWritable(IOInst,
+				RegOff + (Size - 1U) * sizeof(u32))) {
+		Reg = (volatile u32 *)(IOInst->RegWrMap.VAddr + RegOff);
+		for(u32 i = 0U; i < Size; i++) {
+			Reg[i] = (Data != NULL) ? Data[i] : Value;
 		}
+		return XAIE_OK;
 	}
 
-	if((u64)(Dest + Size) & XAIE_128BIT_ALIGN_MASK) {
-		EndExtraWrds = (((u64)(Dest + Size)) &
-				XAIE_128BIT_ALIGN_MASK) / 4;
+	Cmd.Opcode = (Data != NULL) ? XAIE_IO_BLOCKWRITE : XAIE_IO_BLOCKSET;
+	Cmd.Mask = 0U;
+	Cmd.RegOff = RegOff;
+	Cmd.Value = Value;
+	Cmd.DataPtr = (u64)(uintptr_t)Data;
+	Cmd.Size = Size;
+
+	Args.num_cmds = 1U;
+	Args.cmdsptr = (u64)(uintptr_t)&Cmd;
+
+	Ret = ioctl(IOInst->PartitionFd, AIE_TRANSACTION_IOCTL, &Args);
+	if(Ret == 0) {
+		return XAIE_OK;
 	}
 
-	if(Size >= (XAIE_128BIT_ALIGN_MASK + 1)) {
-		memcpy((void *)Dest, (void *)Src,
-				(Size - EndExtraWrds) * sizeof(u32));
-		Dest += Size - EndExtraWrds;
-		Src += Size - EndExtraWrds;
-		Size -= Size - EndExtraWrds;
+	/*
+	 * Fall back to one write per register only if the kernel does not
+	 * support the command. Other failures may have applied part of the
+	 * block, and registers such as DMA queues or locks must not be written
+	 * twice.
+	 */
+	if((errno != ENOTTY) && (errno != EINVAL)) {
+		XAIE_ERROR("Block register write of 0x%lx failed, %d: %s\n",
+				RegOff, errno, strerror(errno));
+		return XAIE_ERR;
 	}
 
-	if(Size > 0) {
-		for(u8 i = 0; Size > 0; i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
+	XAIE_DBG("Block register write of 0x%lx is not supported, %d: %s. "
+			"Writing registers one by one\n", RegOff, errno,
+			strerror(errno));
+	for(u32 i = 0U; i < Size; i++) {
+		RC = _XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U,
+				(Data != NULL) ? Data[i] : Value);
+		if(RC != XAIE_OK) {
+			break;
 		}
 	}
 
-	if(Size != 0) {
-		XAIE_ERROR("Copying data to memory failed. %u words not"
-				"written to device\n", Size);
-	}
+	return RC;
 }
 
 /*****************************************************************************/
 /**
 *
-* This function returns the virtual address of the memory mapped PM/DM section
-* of the array given a register offset.
+* This is the memory IO function to read a block of 32bit data with the
+* partition lock held shared. Blocks within the program, data or mem tile
+* memory of a tile are copied from the memory mapping, other blocks are read
+* one register at a time.
 *
 * @param	IOInst: IO instance pointer
 * @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data
 * @param	Size: Number of 32-bit words.
 *
-* @return	Valid address on success. NULL on non PM/DM register offset.
+* @return	XAIE_OK on success, error code on failure.
 *
 * @note		Internal only.
 *
 *******************************************************************************/
-static u32* _XAie_GetVirtAddrFromOffset(XAie_LinuxIO *IOInst, u64 RegOff,
+static AieRC XAie_LinuxIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
 		u32 Size)
 {
-	u32 *VirtAddr = NULL;
-	u32 ColClockStatus;
-	u64 MemOffset;
-	XAie_DevInst *DevInst = IOInst->DevInst;
-	u64 RegAddr = _XAie_GetRegAddr(IOInst, RegOff);
-	u8 Row = _XAie_GetRowNum(IOInst, RegOff);
-	u8 Col = _XAie_GetColNum(IOInst, RegOff);
-	XAie_LocType Loc = {Row, Col};
-	u8 TileType;
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	u32 *VirtAddr;
+	AieRC RC = XAIE_OK;
 
-	/*
-	 * Check bitmap position of the requested tile, If it is
-	 * gated tile return XAIE_INVALID_TILE,
-	 */
-	if(Row != 0U) {
-		ColClockStatus = _XAie_GetTileBitPosFromLoc(DevInst,Loc);
-		if(!CheckBit(DevInst->DevOps->TilesInUse, ColClockStatus)) {
-			XAIE_ERROR("Tile(%d,%d) is gated \n",Col,Row);
-			return (u32 *)XAIE_INVALID_TILE;
-		}
-	}
+	pthread_rwlock_rdlock(&LinuxIOInst->PartLock);
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_MEMTILE) {
-		u64 MemRange = IOInst->MemTileMemAddr + IOInst->MemTileMemSize;
-		if(((RegAddr + Size) < (MemRange)) &&
-				(RegAddr >= IOInst->MemTileMemAddr)) {
-			MemOffset = _XAie_GetMemOffset(IOInst, TileType, Col, Row,
-					IOInst->MemTileMemSize);
-			VirtAddr = (u32 *)((char *)IOInst->MemTileMem.VAddr +
-					MemOffset + RegAddr);
+	VirtAddr = _XAie_GetVirtAddrFromOffset(LinuxIOInst, RegOff, Size);
+	if(VirtAddr == (u32 *)XAIE_INVALID_TILE) {
+		pthread_rwlock_unlock(&LinuxIOInst->PartLock);
+		return XAIE_INVALID_TILE;
+	}
 
-			return VirtAddr;
+	if(VirtAddr != NULL) {
+		_XAie_IOCommon_CopyWords(Data, VirtAddr, Size);
+	} else {
+		for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+			RC = _XAie_LinuxIO_Read32(IOInst, RegOff + i * 4U,
+					&Data[i]);
 		}
 	}
 
-	if(((RegAddr + Size) < (IOInst->ProgMemAddr + IOInst->ProgMemSize)) &&
-			(RegAddr >= IOInst->ProgMemAddr)) {
-		/* Handle program memory block write */
-		MemOffset = _XAie_GetMemOffset(IOInst, TileType, Col, Row,
-				IOInst->ProgMemSize);
-		VirtAddr = (u32 *)((char *) IOInst->ProgMem.VAddr + MemOffset +
-				RegAddr - IOInst->ProgMemAddr);
-	} else if(((RegAddr + Size) < (IOInst->DataMemAddr +
-					IOInst->DataMemSize)) &&
-			(RegAddr >= IOInst->DataMemAddr)) {
-		/* Handle data memory block write */
-		MemOffset = _XAie_GetMemOffset(IOInst, TileType, Col, Row,
-				IOInst->DataMemSize);
-		VirtAddr = (u32 *)((char *)IOInst->DataMem.VAddr + MemOffset +
-				RegAddr);
-	}
+	pthread_rwlock_unlock(&LinuxIOInst->PartLock);
 
-	return VirtAddr;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -891,28 +1190,30 @@ static AieRC XAie_LinuxIO_BlockWrite32(void *IOInst, u64 RegOff,
 {
 	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
 	u32 *VirtAddr;
-	AieRC RC;
+	AieRC RC = XAIE_OK;
+
+	pthread_rwlock_rdlock(&Inst->PartLock);
 
 	/* Handle PM and DM sections */
 	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
 	if(VirtAddr != NULL && VirtAddr != (u32 *)XAIE_INVALID_TILE) {
 		_XAie_CopyDataToMem(VirtAddr, Data, Size);
+		pthread_rwlock_unlock(&Inst->PartLock);
 		return XAIE_OK;
 	}else if(VirtAddr == (u32 *)XAIE_INVALID_TILE) {
+		pthread_rwlock_unlock(&Inst->PartLock);
 		XAIE_ERROR("Tile is gated \n");
 		return XAIE_ERR;
 	}
 	/* Handle other registers */
-	for(u32 i = 0; i < Size; i++) {
-		RC = XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, *Data);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Block Write Failed!\n");
-			return RC;
-		}
-		Data++;
+	RC = _XAie_LinuxIO_BlockRegWrite(Inst, RegOff, Data, 0U, Size);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Block Write Failed!\n");
 	}
 
-	return XAIE_OK;
+	pthread_rwlock_unlock(&Inst->PartLock);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -936,25 +1237,28 @@ static AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 {
 	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
 	u32 *VirtAddr;
+	AieRC RC;
+
+	pthread_rwlock_rdlock(&Inst->PartLock);
 
 	/* Handle PM and DM sections */
 	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
 	if(VirtAddr != NULL && VirtAddr != (u32 *)XAIE_INVALID_TILE) {
-		for(u32 i = 0; i < Size; i++) {
-			*VirtAddr++ = Data;
-		}
+		_XAie_IOCommon_SetWords(VirtAddr, Data, Size);
+		pthread_rwlock_unlock(&Inst->PartLock);
 		return XAIE_OK;
 	}else if(VirtAddr == (u32 *)XAIE_INVALID_TILE) {
+		pthread_rwlock_unlock(&Inst->PartLock);
 		XAIE_ERROR("Tile is gated \n");
 		return XAIE_ERR;
 	}
 
 	/* Handle other registers */
-	for(u32 i = 0; i < Size; i++) {
-		XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, Data);
-	}
+	RC = _XAie_LinuxIO_BlockRegWrite(Inst, RegOff, NULL, Data, Size);
 
-	return XAIE_OK;
+	pthread_rwlock_unlock(&Inst->PartLock);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -1707,6 +2011,63 @@ AieRC _XAie_LinuxIO_TeardownPart(void *IOInst)
 
 	return XAIE_OK;
 }
+
+/*****************************************************************************/
+/**
+*
+* This function enables or disables the register writes through a writable
+* mapping of the partition registers. The kernel decides if a writable
+* mapping of the registers is granted to the application.
+*
+* @param	IOInst: IO instance pointer
+* @param	Enable: Pointer to 1 to enable and 0 to disable the mapping.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the kernel
+*		does not grant a writable mapping.
+*
+* @note		Internal only. Called with the partition lock held exclusive.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_ConfigMmapWrite(XAie_LinuxIO *IOInst, u8 *Enable)
+{
+	void *VAddr;
+
+	if(Enable == NULL) {
+		XAIE_ERROR("Invalid mmap write configuration\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(*Enable == 0U) {
+		IOInst->MmapWrite = 0U;
+		if(IOInst->RegWrMap.VAddr != NULL) {
+			munmap(IOInst->RegWrMap.VAddr,
+					IOInst->RegWrMap.MapSize);
+			IOInst->RegWrMap.VAddr = NULL;
+			IOInst->RegWrMap.MapSize = 0U;
+		}
+		return XAIE_OK;
+	}
+
+	if(IOInst->RegWrMap.VAddr == NULL) {
+		VAddr = mmap(NULL, IOInst->RegMap.MapSize,
+				PROT_READ | PROT_WRITE, MAP_SHARED,
+				IOInst->PartitionFd, 0);
+		if(VAddr == MAP_FAILED) {
+			XAIE_WARN("Kernel did not grant writable register "
+					"mapping, %d: %s\n", errno,
+					strerror(errno));
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+
+		IOInst->RegWrMap.VAddr = VAddr;
+		IOInst->RegWrMap.MapSize = IOInst->RegMap.MapSize;
+	}
+
+	IOInst->MmapWrite = 1U;
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 
@@ -1725,35 +2086,85 @@ AieRC _XAie_LinuxIO_TeardownPart(void *IOInst)
 static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		XAie_BackendOpCode Op, void *Arg)
 {
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 	AieRC RC;
 
+	/*
+	 * Operations changing the partition or the tiles in use exclude all
+	 * other partition fd accesses, the others run concurrently.
+	 */
+	switch(Op) {
+	case XAIE_BACKEND_OP_REQUEST_TILES:
+	case XAIE_BACKEND_OP_RELEASE_TILES:
+	case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+	case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+	case XAIE_BACKEND_OP_PARTITION_CLEAR_CONTEXT:
+	case XAIE_BACKEND_OP_SET_COLUMN_CLOCK:
+	case XAIE_BACKEND_OP_CONFIG_MMAP_WRITE:
+		pthread_rwlock_wrlock(&LinuxIOInst->PartLock);
+		break;
+	default:
+		pthread_rwlock_rdlock(&LinuxIOInst->PartLock);
+		break;
+	}
+
 	switch(Op) {
 	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
-		return _XAie_LinuxIO_ConfigShimDmaBd(IOInst, Arg);
+		RC = _XAie_LinuxIO_ConfigShimDmaBd(IOInst, Arg);
+		break;
 	case XAIE_BACKEND_OP_UPDATE_SHIM_DMA_BD_ADDR:
-		return _XAie_LinuxIO_UpdateShimDmaBdAddrOff(IOInst, Arg);
+		RC = _XAie_LinuxIO_UpdateShimDmaBdAddrOff(IOInst, Arg);
+		break;
 	case XAIE_BACKEND_OP_REQUEST_TILES:
 		RC = _XAie_LinuxIO_RequestTiles(IOInst, Arg);
 		if(RC == XAIE_OK)
 			_XAie_IOCommon_MarkTilesInUse(DevInst,
 					(XAie_BackendTilesArray *)Arg);
-		return RC;
+		break;
 	case XAIE_BACKEND_OP_RELEASE_TILES:
-		return _XAie_LinuxIO_ReleaseTiles(IOInst, Arg);
+		RC = _XAie_LinuxIO_ReleaseTiles(IOInst, Arg);
+		break;
 	case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
-		return _XAie_LinuxIO_InitPart(IOInst, (XAie_PartInitOpts *)Arg);
+		RC = _XAie_LinuxIO_InitPart(IOInst, (XAie_PartInitOpts *)Arg);
+		break;
 	case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
-		return _XAie_LinuxIO_TeardownPart(IOInst);
+		RC = _XAie_LinuxIO_TeardownPart(IOInst);
+		break;
 	case XAIE_BACKEND_OP_PARTITION_CLEAR_CONTEXT:
-		return _XAie_LinuxIO_PartClearContext((XAie_LinuxIO *)IOInst);
+		RC = _XAie_LinuxIO_PartClearContext((XAie_LinuxIO *)IOInst);
+		break;
 	case XAIE_BACKEND_OP_SET_COLUMN_CLOCK:
-		return _XAie_LinuxIO_SetColumnClock(IOInst, Arg);
+		RC = _XAie_LinuxIO_SetColumnClock(IOInst, Arg);
+		break;
 	case XAIE_BACKEND_OP_PERFORMANCE_UTILIZATION:
-		return _XAie_LinuxIO_PerfUtilization(IOInst, Arg);
+		RC = _XAie_LinuxIO_PerfUtilization(IOInst, Arg);
+		break;
+	case XAIE_BACKEND_OP_CONFIG_MMAP_WRITE:
+		RC = _XAie_LinuxIO_ConfigMmapWrite(LinuxIOInst, (u8 *)Arg);
+		break;
 	default:
 		XAIE_ERROR("Linux backend does not support operation %d\n", Op);
-		return XAIE_FEATURE_NOT_SUPPORTED;
+		RC = XAIE_FEATURE_NOT_SUPPORTED;
+		break;
 	}
+
+	/* Tiles in use may have changed, even if the operation failed */
+	switch(Op) {
+	case XAIE_BACKEND_OP_REQUEST_TILES:
+	case XAIE_BACKEND_OP_RELEASE_TILES:
+	case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+	case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+	case XAIE_BACKEND_OP_PARTITION_CLEAR_CONTEXT:
+	case XAIE_BACKEND_OP_SET_COLUMN_CLOCK:
+		_XAie_LinuxIO_UpdateTileGating(LinuxIOInst);
+		break;
+	default:
+		break;
+	}
+
+	pthread_rwlock_unlock(&LinuxIOInst->PartLock);
+
+	return RC;
 }
 
 static u64 XAie_LinuxGetTid(void)
@@ -1792,7 +2203,9 @@ static AieRC XAie_LinuxSubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
 	Args.num_cmds = TxnInst->NumCmds;
 	Args.cmdsptr = (u64)TxnInst->CmdBuf;
 
+	pthread_rwlock_rdlock(&LinuxIOInst->PartLock);
 	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_TRANSACTION_IOCTL, &Args);
+	pthread_rwlock_unlock(&LinuxIOInst->PartLock);
 	if(Ret < 0) {
 		XAIE_ERROR("Submitting transaction to device failed, %d: %s\n",
 			errno, strerror(errno));
@@ -1829,6 +2242,17 @@ static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	return 0;
 }
 
+static AieRC XAie_LinuxIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+	return XAIE_ERR;
+}
+
 static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Data)
 {
 	/* no-op */
@@ -1990,6 +2414,7 @@ const XAie_Backend LinuxBackend =
 	.Ops.Finish = XAie_LinuxIO_Finish,
 	.Ops.Write32 = XAie_LinuxIO_Write32,
 	.Ops.Read32 = XAie_LinuxIO_Read32,
+	.Ops.BlockRead32 = XAie_LinuxIO_BlockRead32,
 	.Ops.MaskWrite32 = XAie_LinuxIO_MaskWrite32,
 	.Ops.MaskPoll = XAie_LinuxIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_LinuxIO_BlockWrite32,
@@ -20,6 +20,7 @@
 * 1.1  Hyun    10/11/2018  Initialize the IO device for mem instance
 * 1.2  Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.3  Tejus   06/09/2020  Rename and import file from legacy driver.
+* 1.4  Tejus   10/16/2026  Add block read.
 * </pre>
 *
 ******************************************************************************/
@@ -249,6 +250,37 @@ static AieRC XAie_MetalIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of 32bit data from the
+* specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_MetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
+	const volatile u32 *Src = (const volatile u32 *)(MetalIOInst->BaseAddr +
+			RegOff);
+
+	/* Word accesses, the mapping may not support wider or byte accesses */
+	for(u32 i = 0U; i < Size; i++) {
+		Data[i] = Src[i];
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -617,6 +649,17 @@ static AieRC XAie_MetalIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	return XAIE_ERR;
 }
 
+static AieRC XAie_MetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+	return XAIE_ERR;
+}
+
 static AieRC XAie_MetalIO_Write32(void *IOInst, u64 RegOff, u32 Data)
 {
 	/* no-op */
@@ -750,6 +793,7 @@ const XAie_Backend MetalBackend =
 	.Ops.Finish = XAie_MetalIO_Finish,
 	.Ops.Write32 = XAie_MetalIO_Write32,
 	.Ops.Read32 = XAie_MetalIO_Read32,
+	.Ops.BlockRead32 = XAie_MetalIO_BlockRead32,
 	.Ops.MaskWrite32 = XAie_MetalIO_MaskWrite32,
 	.Ops.MaskPoll = XAie_MetalIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_MetalIO_BlockWrite32,
@@ -0,0 +1,897 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_model.c
+* @{
+*
+* This file contains the data structures and routines for the functional
+* register model backend. The backend keeps the AIE and NPI address spaces of
+* the partition in host memory, so that register writes can be read back and
+* the driver can be tested and benchmarked without hardware or simulator.
+*
+* The address space is modelled as sparse 4KB pages which are allocated on the
+* first write. Reads of addresses which were never written return zero. The
+* model does not emulate the hardware: mask polls are always satisfied, and
+* locks, DMAs and cores do not make progress.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation.
+* 1.1   Tejus   10/16/2026  Add vectored command execution.
+* 1.2   Tejus   10/16/2026  Add block read.
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+#include "xaie_helper_internal.h"
+#include "xaie_io.h"
+#include "xaie_io_common.h"
+#include "xaie_io_privilege.h"
+#include "xaie_npi.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_MODEL_PAGE_SHIFT		12U
+#define XAIE_MODEL_PAGE_WORDS		((1U << XAIE_MODEL_PAGE_SHIFT) / 4U)
+#define XAIE_MODEL_MIN_SLOTS		256U
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 PageNum;	/* Page number of the page, address >> 12 */
+	u32 *Words;	/* Page contents, NULL for an empty slot */
+} XAie_ModelPage;
+
+/* Sparse address space, open addressing hash table of pages */
+typedef struct {
+	XAie_ModelPage *Pages;
+	u32 NumSlots;
+	u32 NumPages;
+	XAie_ModelPage Last;	/* Last page accessed */
+} XAie_ModelMem;
+
+typedef struct {
+	u64 BaseAddr;
+	u64 NpiBaseAddr;
+	XAie_ModelMem Aie;	/* AIE address space, by register offset */
+	XAie_ModelMem Npi;	/* NPI address space, by absolute address */
+	XAie_Mutex *Lock;	/* Serializes accesses to the model */
+} XAie_ModelIO;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function returns the slot of a page in the page table, which is either
+* the slot holding the page or the empty slot the page would be stored in.
+*
+* @param	Mem: Model address space
+* @param	PageNum: Page number
+*
+* @return	Slot index.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_ModelIO_PageSlot(const XAie_ModelMem *Mem, u64 PageNum)
+{
+	u32 Slot = (u32)((PageNum * 0x9E3779B97F4A7C15ULL) >> 32U) &
+		(Mem->NumSlots - 1U);
+
+	while((Mem->Pages[Slot].Words != NULL) &&
+			(Mem->Pages[Slot].PageNum != PageNum)) {
+		Slot = (Slot + 1U) & (Mem->NumSlots - 1U);
+	}
+
+	return Slot;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function doubles the size of the page table.
+*
+* @param	Mem: Model address space
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_ModelIO_Grow(XAie_ModelMem *Mem)
+{
+	XAie_ModelMem New;
+
+	New.NumSlots = (Mem->NumSlots == 0U) ? XAIE_MODEL_MIN_SLOTS :
+		Mem->NumSlots * 2U;
+	New.NumPages = Mem->NumPages;
+	New.Last = Mem->Last;
+	New.Pages = (XAie_ModelPage *)calloc(New.NumSlots,
+			sizeof(*New.Pages));
+	if(New.Pages == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < Mem->NumSlots; i++) {
+		if(Mem->Pages[i].Words != NULL) {
+			New.Pages[_XAie_ModelIO_PageSlot(&New,
+					Mem->Pages[i].PageNum)] = Mem->Pages[i];
+		}
+	}
+
+	free(Mem->Pages);
+	*Mem = New;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the contents of the page holding an address.
+*
+* @param	Mem: Model address space
+* @param	Addr: Address within the page
+* @param	Alloc: Allocate the page if it was never written
+*
+* @return	Pointer to the words of the page. NULL if the page was never
+*		written and Alloc is zero, or if the allocation failed.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32* _XAie_ModelIO_GetPage(XAie_ModelMem *Mem, u64 Addr, u8 Alloc)
+{
+	u64 PageNum = Addr >> XAIE_MODEL_PAGE_SHIFT;
+	u32 Slot;
+
+	if((Mem->Last.Words != NULL) && (Mem->Last.PageNum == PageNum)) {
+		return Mem->Last.Words;
+	}
+
+	if(Mem->NumSlots != 0U) {
+		Slot = _XAie_ModelIO_PageSlot(Mem, PageNum);
+		if(Mem->Pages[Slot].Words != NULL) {
+			Mem->Last = Mem->Pages[Slot];
+			return Mem->Last.Words;
+		}
+	}
+
+	if(Alloc == 0U) {
+		return NULL;
+	}
+
+	/* Keep the load factor of the table at or below one half */
+	if(((Mem->NumPages + 1U) * 2U > Mem->NumSlots) &&
+			(_XAie_ModelIO_Grow(Mem) != XAIE_OK)) {
+		return NULL;
+	}
+
+	Slot = _XAie_ModelIO_PageSlot(Mem, PageNum);
+	Mem->Pages[Slot].Words = (u32 *)calloc(XAIE_MODEL_PAGE_WORDS,
+			sizeof(u32));
+	if(Mem->Pages[Slot].Words == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return NULL;
+	}
+	Mem->Pages[Slot].PageNum = PageNum;
+	Mem->NumPages++;
+	Mem->Last = Mem->Pages[Slot];
+
+	return Mem->Last.Words;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function releases all pages of a model address space.
+*
+* @param	Mem: Model address space
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_ModelIO_FreeMem(XAie_ModelMem *Mem)
+{
+	for(u32 i = 0U; i < Mem->NumSlots; i++) {
+		free(Mem->Pages[i].Words);
+	}
+	free(Mem->Pages);
+	memset(Mem, 0, sizeof(*Mem));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes or fills a range of words of a model address space.
+*
+* @param	Mem: Model address space
+* @param	Addr: Start address
+* @param	Data: Data to write, NULL to fill the range with Value
+* @param	Value: Value to fill the range with if Data is NULL
+* @param	Size: Number of 32-bit words
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_ModelIO_WriteRange(XAie_ModelMem *Mem, u64 Addr,
+		const u32 *Data, u32 Value, u32 Size)
+{
+	while(Size > 0U) {
+		u32 Word = (u32)(Addr >> 2U) & (XAIE_MODEL_PAGE_WORDS - 1U);
+		u32 Len = XAIE_MODEL_PAGE_WORDS - Word;
+		u32 *Page;
+
+		Page = _XAie_ModelIO_GetPage(Mem, Addr, 1U);
+		if(Page == NULL) {
+			return XAIE_ERR;
+		}
+
+		if(Len > Size) {
+			Len = Size;
+		}
+
+		if(Data != NULL) {
+			memcpy(&Page[Word], Data, Len * sizeof(u32));
+			Data += Len;
+		} else {
+			for(u32 i = 0U; i < Len; i++) {
+				Page[Word + i] = Value;
+			}
+		}
+
+		Addr += (u64)Len * sizeof(u32);
+		Size -= Len;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to free the global IO instance
+*
+* @param	IOInst: IO Instance pointer.
+*
+* @return	XAIE_OK.
+*
+* @note		The contents of the model are discarded.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_Finish(void *IOInst)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+
+	_XAie_ModelIO_FreeMem(&ModelIOInst->Aie);
+	_XAie_ModelIO_FreeMem(&ModelIOInst->Npi);
+	_XAie_MutexDestroy(ModelIOInst->Lock);
+	free(ModelIOInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to initialize the global IO instance. The
+* model starts with all registers and memories cleared.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success. Error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_Init(XAie_DevInst *DevInst)
+{
+	XAie_ModelIO *IOInst;
+
+	IOInst = (XAie_ModelIO *)calloc(1U, sizeof(*IOInst));
+	if(IOInst == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+#ifdef __linux__
+	IOInst->Lock = _XAie_MutexCreate();
+	if(IOInst->Lock == NULL) {
+		free(IOInst);
+		return XAIE_ERR;
+	}
+#endif
+
+	IOInst->BaseAddr = DevInst->BaseAddr;
+	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	DevInst->IOInst = IOInst;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write 32bit data to the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write to.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+	AieRC RC;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	RC = _XAie_ModelIO_WriteRange(&ModelIOInst->Aie, RegOff, &Value, 0U,
+			1U);
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read 32bit data from the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the 32 bit value
+*
+* @return	XAIE_OK.
+*
+* @note		Registers which were never written read as zero.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+	u32 *Page;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	Page = _XAie_ModelIO_GetPage(&ModelIOInst->Aie, RegOff, 0U);
+	*Data = (Page == NULL) ? 0U :
+		Page[(RegOff >> 2U) & (XAIE_MODEL_PAGE_WORDS - 1U)];
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of 32bit data from the
+* specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK.
+*
+* @note		Words which were never written read as zero.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	while(Size > 0U) {
+		u32 Word = (u32)(RegOff >> 2U) & (XAIE_MODEL_PAGE_WORDS - 1U);
+		u32 Len = XAIE_MODEL_PAGE_WORDS - Word;
+		u32 *Page;
+
+		if(Len > Size) {
+			Len = Size;
+		}
+
+		Page = _XAie_ModelIO_GetPage(&ModelIOInst->Aie, RegOff, 0U);
+		if(Page == NULL) {
+			memset(Data, 0, Len * sizeof(u32));
+		} else {
+			memcpy(Data, &Page[Word], Len * sizeof(u32));
+		}
+
+		Data += Len;
+		RegOff += (u64)Len * sizeof(u32);
+		Size -= Len;
+	}
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write masked 32bit data to the specified
+* address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write to.
+* @param	Mask: Mask to be applied to Data.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+	u32 *Page, Word;
+	AieRC RC = XAIE_OK;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	Page = _XAie_ModelIO_GetPage(&ModelIOInst->Aie, RegOff, 1U);
+	if(Page == NULL) {
+		RC = XAIE_ERR;
+	} else {
+		Word = (u32)(RegOff >> 2U) & (XAIE_MODEL_PAGE_WORDS - 1U);
+		Page[Word] = (Page[Word] & ~Mask) | (Value & Mask);
+	}
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to mask poll an address for a value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Mask: Mask to be applied to Data.
+* @param	Value: 32-bit value to poll for
+* @param	TimeOutUs: Timeout in micro seconds.
+*
+* @return	XAIE_OK.
+*
+* @note		The model does not emulate hardware progress, so the polled
+*		condition is always considered satisfied.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value, u32 TimeOutUs)
+{
+	(void)IOInst;
+	(void)RegOff;
+	(void)Mask;
+	(void)Value;
+	(void)TimeOutUs;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write a block of data to aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write to.
+* @param	Data: Pointer to the data buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_BlockWrite32(void *IOInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+	AieRC RC;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	RC = _XAie_ModelIO_WriteRange(&ModelIOInst->Aie, RegOff, Data, 0U,
+			Size);
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to initialize a chunk of aie address space with
+* a specified value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write to.
+* @param	Data: Data to initialize a chunk of aie address space..
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+	AieRC RC;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	RC = _XAie_ModelIO_WriteRange(&ModelIOInst->Aie, RegOff, NULL, Data,
+			Size);
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to execute an array of transaction commands.
+* The model is locked once for all the commands.
+*
+* @param	IOInst: IO instance pointer
+* @param	Cmds: Pointer to the commands
+* @param	NumCmds: Number of commands
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_ExecCmds(void *IOInst, const XAie_TxnCmd *Cmds,
+		u32 NumCmds)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+	XAie_ModelMem *Mem = &ModelIOInst->Aie;
+	AieRC RC = XAIE_OK;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	for(u32 i = 0U; (i < NumCmds) && (RC == XAIE_OK); i++) {
+		const XAie_TxnCmd *Cmd = &Cmds[i];
+		u32 *Page, Word;
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			Page = _XAie_ModelIO_GetPage(Mem, Cmd->RegOff, 1U);
+			if(Page == NULL) {
+				RC = XAIE_ERR;
+				break;
+			}
+			Word = (u32)(Cmd->RegOff >> 2U) &
+				(XAIE_MODEL_PAGE_WORDS - 1U);
+			if(Cmd->Mask == 0U) {
+				Page[Word] = Cmd->Value;
+			} else {
+				Page[Word] = (Page[Word] & ~Cmd->Mask) |
+					(Cmd->Value & Cmd->Mask);
+			}
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			RC = _XAie_ModelIO_WriteRange(Mem, Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					0U, Cmd->Size);
+			break;
+		case XAIE_IO_BLOCKSET:
+			RC = _XAie_ModelIO_WriteRange(Mem, Cmd->RegOff, NULL,
+					Cmd->Value, Cmd->Size);
+			break;
+		case XAIE_IO_MASKPOLL:
+			/* Polls are always satisfied, see XAie_ModelIO_MaskPoll */
+			break;
+		default:
+			XAIE_ERROR("Invalid transaction opcode %d\n",
+					Cmd->Opcode);
+			RC = XAIE_INVALID_ARGS;
+			break;
+		}
+	}
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return RC;
+}
+
+static AieRC XAie_ModelIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)Col;
+	(void)Row;
+	(void)Command;
+	(void)CmdWd0;
+	(void)CmdWd1;
+	(void)CmdStr;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to write to AI engine NPI registers
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write.
+* @param	RegVal: Register value to write
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC _XAie_ModelIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
+{
+	XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+	AieRC RC;
+
+	_XAie_MutexLock(ModelIOInst->Lock);
+	RC = _XAie_ModelIO_WriteRange(&ModelIOInst->Npi,
+			ModelIOInst->NpiBaseAddr + RegOff, &RegVal, 0U, 1U);
+	_XAie_MutexUnlock(ModelIOInst->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to run backend operations
+*
+* @param	IOInst: IO instance pointer
+* @param	DevInst: AI engine partition device instance
+* @param	Op: Backend operation code
+* @param	Arg: Backend operation argument
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_ModelIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		     XAie_BackendOpCode Op, void *Arg)
+{
+	AieRC RC = XAIE_OK;
+
+	switch(Op) {
+		case XAIE_BACKEND_OP_NPIWR32:
+		{
+			XAie_BackendNpiWrReq *Req = Arg;
+
+			RC = _XAie_ModelIO_NpiWrite32(IOInst, Req->NpiRegOff,
+					Req->Val);
+			break;
+		}
+		case XAIE_BACKEND_OP_NPIMASKPOLL32:
+			/* Polls are always satisfied, see XAie_ModelIO_MaskPoll */
+			break;
+		case XAIE_BACKEND_OP_ASSERT_SHIMRST:
+		{
+			u8 RstEnable = (u8)((uintptr_t)Arg & 0xFFU);
+
+			RC = _XAie_NpiSetShimReset(DevInst, RstEnable);
+			break;
+		}
+		case XAIE_BACKEND_OP_SET_PROTREG:
+		{
+			RC = _XAie_NpiSetProtectedRegEnable(DevInst, Arg);
+			break;
+		}
+		case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
+		{
+			XAie_ShimDmaBdArgs *BdArgs =
+				(XAie_ShimDmaBdArgs *)Arg;
+
+			RC = XAie_ModelIO_BlockWrite32(IOInst, BdArgs->Addr,
+				BdArgs->BdWords, BdArgs->NumBdWords);
+			break;
+		}
+		case XAIE_BACKEND_OP_REQUEST_TILES:
+			return _XAie_PrivilegeRequestTiles(DevInst,
+					(XAie_BackendTilesArray *)Arg);
+		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+			return _XAie_PrivilegeInitPart(DevInst,
+					(XAie_PartInitOpts *)Arg);
+		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+			return _XAie_PrivilegeTeardownPart(DevInst);
+		case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
+		{
+			XAie_ModelIO *ModelIOInst = (XAie_ModelIO *)IOInst;
+
+			ModelIOInst->NpiBaseAddr = *((u64 *)Arg);
+			break;
+		}
+		case XAIE_BACKEND_OP_SET_COLUMN_CLOCK:
+			return _XAie_PrivilegeSetColumnClk(DevInst,
+					(XAie_BackendColumnReq *)Arg);
+		default:
+			XAIE_ERROR("Model backend doesn't support operation"
+					" %u.\n", Op);
+			RC = XAIE_FEATURE_NOT_SUPPORTED;
+			break;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to allocate a memory
+*
+* @param	DevInst: Device Instance
+* @param	Size: Size of the memory
+* @param	Cache: Buffer to be cacheable or not
+*
+* @return	Pointer to the allocated memory instance.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_MemInst* XAie_ModelMemAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
+{
+	XAie_MemInst *MemInst;
+
+	MemInst = (XAie_MemInst *)malloc(sizeof(*MemInst));
+	if(MemInst == NULL) {
+		XAIE_ERROR("memory allocation failed\n");
+		return NULL;
+	}
+
+	MemInst->VAddr = (void *)malloc(Size);
+	if(MemInst->VAddr == NULL) {
+		XAIE_ERROR("malloc failed\n");
+		free(MemInst);
+		return NULL;
+	}
+	MemInst->DevAddr = (u64)(uintptr_t)MemInst->VAddr;
+	MemInst->Size = Size;
+	MemInst->DevInst = DevInst;
+
+	(void)Cache;
+	XAIE_DBG("Cache attribute is ignored\n");
+
+	return MemInst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to free the memory
+*
+* @param	MemInst: Memory instance pointer.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_ModelMemFree(XAie_MemInst *MemInst)
+{
+	free(MemInst->VAddr);
+	free(MemInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to sync the memory for CPU
+*
+* @param	MemInst: Memory instance pointer.
+*
+* @return	XAIE_OK.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_ModelMemSyncForCPU(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to sync the memory for device
+*
+* @param	MemInst: Memory instance pointer.
+*
+* @return	XAIE_OK.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_ModelMemSyncForDev(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+
+	return XAIE_OK;
+}
+
+static AieRC XAie_ModelMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+{
+	(void)MemInst;
+	(void)MemHandle;
+	XAIE_DBG("Mem attach is no-op in model backend\n");
+
+	return XAIE_OK;
+}
+
+static AieRC XAie_ModelMemDetach(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	XAIE_DBG("Mem detach is no-op in model backend\n");
+
+	return XAIE_OK;
+}
+
+static u64 XAie_ModelGetTid(void)
+{
+#ifdef __linux__
+	return (u64)pthread_self();
+#else
+	return 0;
+#endif
+}
+
+const XAie_Backend ModelBackend =
+{
+	.Type = XAIE_IO_BACKEND_MODEL,
+	.Ops.Init = XAie_ModelIO_Init,
+	.Ops.Finish = XAie_ModelIO_Finish,
+	.Ops.Write32 = XAie_ModelIO_Write32,
+	.Ops.Read32 = XAie_ModelIO_Read32,
+	.Ops.BlockRead32 = XAie_ModelIO_BlockRead32,
+	.Ops.MaskWrite32 = XAie_ModelIO_MaskWrite32,
+	.Ops.MaskPoll = XAie_ModelIO_MaskPoll,
+	.Ops.BlockWrite32 = XAie_ModelIO_BlockWrite32,
+	.Ops.BlockSet32 = XAie_ModelIO_BlockSet32,
+	.Ops.CmdWrite = XAie_ModelIO_CmdWrite,
+	.Ops.RunOp = XAie_ModelIO_RunOp,
+	.Ops.MemAllocate = XAie_ModelMemAllocate,
+	.Ops.MemFree = XAie_ModelMemFree,
+	.Ops.MemSyncForCPU = XAie_ModelMemSyncForCPU,
+	.Ops.MemSyncForDev = XAie_ModelMemSyncForDev,
+	.Ops.MemAttach = XAie_ModelMemAttach,
+	.Ops.MemDetach = XAie_ModelMemDetach,
+	.Ops.GetTid = XAie_ModelGetTid,
+	.Ops.GetPartFd = XAie_IODummyGetPartFd,
+	.Ops.SubmitTxn = NULL,
+	.Ops.ExecCmds = XAie_ModelIO_ExecCmds,
+};
+
+/** @} */
@@ -17,6 +17,11 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus    08/12/2021  Initial creation
+* 1.1   Tejus    10/16/2026  Add binary framed protocol and write buffering
+* 1.2   Tejus    10/16/2026  Add vectored command execution
+* 1.3   Tejus    10/16/2026  Add block read
+* 1.4   Tejus    10/16/2026  Serialize accesses to the connection
+* 1.5   Tejus    10/16/2026  Drain or reconnect after failed negotiation
 * </pre>
 *
 ******************************************************************************/
@@ -28,6 +33,7 @@
 
 #include <errno.h>
 #include <netdb.h>
+#include <poll.h>
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -39,28 +45,533 @@
 #endif /* __AIESOCKET__ */
 
 #include "xaie_helper.h"
+#include "xaie_helper_internal.h"
 #include "xaie_io.h"
 #include "xaie_io_common.h"
 #include "xaie_io_privilege.h"
 #include "xaie_npi.h"
+#include "xaie_txn.h"
 
 /***************************** Macro Definitions *****************************/
 #define XAIE_IO_SOCKET_CMDBUFSIZE	48U
 #define XAIE_IO_SOCKET_RDBUFSIZE	11U /* "0xDEADBEEF\n" */
+#define XAIE_IO_SOCKET_SNDBUFSIZE	65536U
+#define XAIE_IO_SOCKET_PROTOCOL_ENV	"XAIE_SOCKET_PROTOCOL"
+#define XAIE_IO_SOCKET_NEGOTIATE_MS	1000
+#define XAIE_IO_SOCKET_RDCHUNK		256U /* Words per block read request */
+
+/*
+ * Binary protocol frames start with a 16 byte little endian header: opcode
+ * (1 byte), 3 reserved bytes, number of words (4 bytes) and address (8
+ * bytes). Write and block set frames carry one data word, block write frames
+ * carry the number of words of data. Read frames carry no data and are
+ * answered with one little endian data word, block read frames are answered
+ * with the number of words of data.
+ */
+#define XAIE_IO_SOCKET_HDRSIZE		16U
+#define XAIE_IO_SOCKET_OP_WRITE		0x1U
+#define XAIE_IO_SOCKET_OP_READ		0x2U
+#define XAIE_IO_SOCKET_OP_BLOCKWRITE	0x3U
+#define XAIE_IO_SOCKET_OP_BLOCKSET	0x4U
+#define XAIE_IO_SOCKET_OP_BLOCKREAD	0x5U
 
 /****************************** Type Definitions *****************************/
 #ifdef __AIESOCKET__
 
+/*
+ * The connection and the send buffer are shared by all threads using the
+ * device instance. Lock is held while commands are queued or flushed and for
+ * the round trip of a read, so that replies are not interleaved.
+ */
 typedef struct XAie_SocketIO {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
 	int SocketFd;
+	XAie_Mutex *Lock;	/* Serializes accesses to the connection */
+	u8 Binary;		/* Binary framed protocol is negotiated */
+	u32 SndLen;		/* Number of bytes pending in SndBuf */
+	u8 SndBuf[XAIE_IO_SOCKET_SNDBUFSIZE]; /* Buffered commands */
 } XAie_SocketIO;
 
 #endif /* __AIESOCKET__ */
 /************************** Function Definitions *****************************/
 #ifdef __AIESOCKET__
 
+/*****************************************************************************/
+/**
+*
+* This function sends a buffer to the socket, retrying on partial writes.
+*
+* @param	Fd: Socket file descriptor
+* @param	Buf: Buffer to send
+* @param	Len: Number of bytes to send
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Send(int Fd, const void *Buf, size_t Len)
+{
+	const u8 *Ptr = (const u8 *)Buf;
+	ssize_t Ret;
+
+	while(Len > 0U) {
+		Ret = write(Fd, Ptr, Len);
+		if(Ret < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			XAIE_ERROR("Failed to write to socket, %d: %s\n",
+					errno, strerror(errno));
+			return XAIE_ERR;
+		}
+		Ptr += Ret;
+		Len -= (size_t)Ret;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function receives a number of bytes from the socket.
+*
+* @param	Fd: Socket file descriptor
+* @param	Buf: Buffer to store the received bytes
+* @param	Len: Number of bytes to receive
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Recv(int Fd, void *Buf, size_t Len)
+{
+	u8 *Ptr = (u8 *)Buf;
+	ssize_t Ret;
+
+	while(Len > 0U) {
+		Ret = read(Fd, Ptr, Len);
+		if((Ret < 0) && (errno == EINTR)) {
+			continue;
+		}
+		if(Ret <= 0) {
+			XAIE_ERROR("Failed to read from socket, %d: %s\n",
+					errno, strerror(errno));
+			return XAIE_ERR;
+		}
+		Ptr += Ret;
+		Len -= (size_t)Ret;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends the buffered commands to the socket.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Errors of buffered writes are reported by the flush. Internal
+*		only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Flush(XAie_SocketIO *SocketIOInst)
+{
+	AieRC RC;
+
+	if(SocketIOInst->SndLen == 0U) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_SocketIO_Send(SocketIOInst->SocketFd, SocketIOInst->SndBuf,
+			SocketIOInst->SndLen);
+	SocketIOInst->SndLen = 0U;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends bytes to the send buffer. The buffer is flushed when
+* full, and data larger than the buffer is sent directly.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Buf: Bytes to send
+* @param	Len: Number of bytes
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Queue(XAie_SocketIO *SocketIOInst,
+		const void *Buf, size_t Len)
+{
+	AieRC RC;
+
+	if(SocketIOInst->SndLen + Len > XAIE_IO_SOCKET_SNDBUFSIZE) {
+		RC = _XAie_SocketIO_Flush(SocketIOInst);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if(Len > XAIE_IO_SOCKET_SNDBUFSIZE) {
+		return _XAie_SocketIO_Send(SocketIOInst->SocketFd, Buf, Len);
+	}
+
+	memcpy(SocketIOInst->SndBuf + SocketIOInst->SndLen, Buf, Len);
+	SocketIOInst->SndLen += (u32)Len;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stores a 32-bit value in little endian byte order.
+*
+* @param	Buf: Destination buffer
+* @param	Value: Value to store
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_SocketIO_PutU32(u8 *Buf, u32 Value)
+{
+	for(u32 i = 0U; i < sizeof(u32); i++) {
+		Buf[i] = (u8)(Value >> (8U * i));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a binary protocol frame.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Op: Frame opcode
+* @param	Addr: Absolute address
+* @param	NumWords: Number of words the frame applies to
+* @param	Data: Data words of the frame, NULL if none
+* @param	DataWords: Number of data words carried by the frame
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_QueueFrame(XAie_SocketIO *SocketIOInst, u8 Op,
+		u64 Addr, u32 NumWords, const u32 *Data, u32 DataWords)
+{
+	u8 Frame[XAIE_IO_SOCKET_HDRSIZE + sizeof(u32)];
+	u32 Len = XAIE_IO_SOCKET_HDRSIZE;
+	AieRC RC;
+
+	memset(Frame, 0, XAIE_IO_SOCKET_HDRSIZE);
+	Frame[0U] = Op;
+	_XAie_SocketIO_PutU32(&Frame[4U], NumWords);
+	_XAie_SocketIO_PutU32(&Frame[8U], (u32)Addr);
+	_XAie_SocketIO_PutU32(&Frame[12U], (u32)(Addr >> 32U));
+
+	if(DataWords == 1U) {
+		_XAie_SocketIO_PutU32(&Frame[Len], *Data);
+		return _XAie_SocketIO_Queue(SocketIOInst, Frame,
+				Len + sizeof(u32));
+	}
+
+	RC = _XAie_SocketIO_Queue(SocketIOInst, Frame, Len);
+	if((RC != XAIE_OK) || (DataWords == 0U)) {
+		return RC;
+	}
+
+	/* The binary protocol is little endian, as are all supported hosts */
+	return _XAie_SocketIO_Queue(SocketIOInst, Data,
+			(size_t)DataWords * sizeof(u32));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a write of a 32-bit value to an absolute address.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Addr: Absolute address
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_WriteAddr(XAie_SocketIO *SocketIOInst, u64 Addr,
+		u32 Value)
+{
+	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
+	int Len;
+
+	if(SocketIOInst->Binary != 0U) {
+		return _XAie_SocketIO_QueueFrame(SocketIOInst,
+				XAIE_IO_SOCKET_OP_WRITE, Addr, 1U, &Value, 1U);
+	}
+
+	Len = snprintf(CmdBuf, sizeof(CmdBuf), "W 0X%016lX 0X%08X\n", Addr,
+			Value);
+	XAIE_DBG("SEND: %s", CmdBuf);
+
+	return _XAie_SocketIO_Queue(SocketIOInst, CmdBuf, (size_t)Len);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a 32-bit value from an absolute address. Buffered
+* commands are sent first.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Addr: Absolute address
+* @param	Data: Pointer to store the 32 bit value
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_ReadAddr(XAie_SocketIO *SocketIOInst, u64 Addr,
+		u32 *Data)
+{
+	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
+	char RdBuf[XAIE_IO_SOCKET_RDBUFSIZE + 1U];
+	u8 Word[sizeof(u32)];
+	AieRC RC;
+	int Len;
+
+	if(SocketIOInst->Binary != 0U) {
+		RC = _XAie_SocketIO_QueueFrame(SocketIOInst,
+				XAIE_IO_SOCKET_OP_READ, Addr, 1U, NULL, 0U);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_Flush(SocketIOInst);
+		}
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_Recv(SocketIOInst->SocketFd, Word,
+					sizeof(Word));
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		*Data = (u32)Word[0U] | ((u32)Word[1U] << 8U) |
+			((u32)Word[2U] << 16U) | ((u32)Word[3U] << 24U);
+		return XAIE_OK;
+	}
+
+	Len = snprintf(CmdBuf, sizeof(CmdBuf), "R 0X%016lX\n", Addr);
+	XAIE_DBG("SEND: %s", CmdBuf);
+	RC = _XAie_SocketIO_Queue(SocketIOInst, CmdBuf, (size_t)Len);
+	if(RC == XAIE_OK) {
+		RC = _XAie_SocketIO_Flush(SocketIOInst);
+	}
+	if(RC == XAIE_OK) {
+		RC = _XAie_SocketIO_Recv(SocketIOInst->SocketFd, RdBuf,
+				XAIE_IO_SOCKET_RDBUFSIZE);
+	}
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RdBuf[XAIE_IO_SOCKET_RDBUFSIZE] = '\0';
+	XAIE_DBG("RCVD: %s", RdBuf);
+	*Data = (u32)strtoul(RdBuf, NULL, 0);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function connects to the simulator listening on a localhost port.
+*
+* @param	PortNum: Port number string
+* @param	SocketFd: Pointer to return the socket file descriptor
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Connect(const char *PortNum, int *SocketFd)
+{
+	struct addrinfo hints, *slist, *p;
+	int ret;
+	int Fd = -1;
+
+	memset(&hints, 0, sizeof(struct addrinfo));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_protocol = IPPROTO_TCP;
+
+	ret = getaddrinfo("localhost", PortNum, &hints, &slist);
+	if(ret != 0) {
+		XAIE_ERROR("get addr info failed. ec %s\n", gai_strerror(ret));
+		return XAIE_ERR;
+	}
+
+	for(p = slist; p != NULL; p = p->ai_next) {
+
+		Fd = socket(p->ai_family, p->ai_socktype, p->ai_protocol);
+		if(Fd < 0)
+			continue;
+
+		ret = connect(Fd, p->ai_addr, p->ai_addrlen);
+		if(ret != -1)
+			break;
+
+		close(Fd);
+	}
+
+	freeaddrinfo(slist);
+	if(p == NULL) {
+		XAIE_ERROR("failed to connect to sim\n");
+		return XAIE_ERR;
+	}
+
+	*SocketFd = Fd;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function receives up to a number of bytes from the socket, waiting at
+* most XAIE_IO_SOCKET_NEGOTIATE_MS for each part of the reply.
+*
+* @param	Fd: Socket file descriptor
+* @param	Buf: Buffer to store the received bytes
+* @param	Len: Number of bytes to receive
+*
+* @return	Number of bytes received, -1 if the connection is closed or
+*		failed.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static ssize_t _XAie_SocketIO_RecvTimed(int Fd, void *Buf, size_t Len)
+{
+	struct pollfd Pfd;
+	size_t Count = 0U;
+	ssize_t Ret;
+
+	Pfd.fd = Fd;
+	Pfd.events = POLLIN;
+	while((Count < Len) &&
+			(poll(&Pfd, 1U, XAIE_IO_SOCKET_NEGOTIATE_MS) == 1)) {
+		Ret = read(Fd, (u8 *)Buf + Count, Len - Count);
+		if((Ret < 0) && (errno == EINTR)) {
+			continue;
+		}
+		if(Ret <= 0) {
+			return -1;
+		}
+		Count += (size_t)Ret;
+	}
+
+	return (ssize_t)Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function restores the connection for the text protocol after a failed
+* negotiation. Late or unexpected replies to the request are discarded until
+* the server is quiet for XAIE_IO_SOCKET_NEGOTIATE_MS. If the server closed the
+* connection, the simulator is connected again.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	PortNum: Port number string of the simulator
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Drain(XAie_SocketIO *SocketIOInst,
+		const char *PortNum)
+{
+	u8 Buf[XAIE_IO_SOCKET_CMDBUFSIZE];
+	ssize_t Ret;
+
+	do {
+		Ret = _XAie_SocketIO_RecvTimed(SocketIOInst->SocketFd, Buf,
+				sizeof(Buf));
+	} while(Ret > 0);
+
+	if(Ret == 0) {
+		return XAIE_OK;
+	}
+
+	XAIE_WARN("Simulator closed the connection, reconnecting\n");
+	close(SocketIOInst->SocketFd);
+	SocketIOInst->SocketFd = -1;
+
+	return _XAie_SocketIO_Connect(PortNum, &SocketIOInst->SocketFd);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function switches the connection to the binary protocol if requested
+* with the XAIE_SOCKET_PROTOCOL=binary environment variable. The request is
+* sent as the text command "P BINARY", which servers supporting the binary
+* protocol acknowledge with "OK". The text protocol is kept otherwise.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	PortNum: Port number string of the simulator
+*
+* @return	XAIE_OK on success, XAIE_ERR if the connection is lost.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Negotiate(XAie_SocketIO *SocketIOInst,
+		const char *PortNum)
+{
+	const char *Protocol = getenv(XAIE_IO_SOCKET_PROTOCOL_ENV);
+	char Ack[3U];
+
+	if((Protocol == NULL) || (strcmp(Protocol, "binary") != 0)) {
+		return XAIE_OK;
+	}
+
+	if(_XAie_SocketIO_Send(SocketIOInst->SocketFd, "P BINARY\n", 9U) !=
+			XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	if((_XAie_SocketIO_RecvTimed(SocketIOInst->SocketFd, Ack,
+					sizeof(Ack)) == (ssize_t)sizeof(Ack)) &&
+			(memcmp(Ack, "OK\n", sizeof(Ack)) == 0)) {
+		SocketIOInst->Binary = 1U;
+		XAIE_DBG("Using binary socket protocol\n");
+		return XAIE_OK;
+	}
+
+	XAIE_WARN("Server does not support binary protocol, using text "
+			"protocol\n");
+
+	return _XAie_SocketIO_Drain(SocketIOInst, PortNum);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -78,7 +589,9 @@ static AieRC XAie_SocketIO_Finish(void *IOInst)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
 
+	_XAie_SocketIO_Flush(SocketIOInst);
 	close(SocketIOInst->SocketFd);
+	_XAie_MutexDestroy(SocketIOInst->Lock);
 	free(IOInst);
 
 	return XAIE_OK;
@@ -100,7 +613,6 @@ static AieRC XAie_SocketIO_Finish(void *IOInst)
 static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 {
 	XAie_SocketIO *IOInst;
-	struct addrinfo hints, *slist, *p;
 	u32 FileSize;
 	char *PortNum;
 	int ret;
@@ -114,6 +626,14 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 		return XAIE_ERR;
 	}
 
+	IOInst->Lock = _XAie_MutexCreate();
+	if(IOInst->Lock == NULL) {
+		XAIE_ERROR("Socket backend init failed. failed to create "
+				"lock\n");
+		free(IOInst);
+		return XAIE_ERR;
+	}
+
 	/* Get port number from mesim_output/mesimulator_aximm_port */
 	Fd = fopen("./mesim_output/mesimulator_aximm_port", "r");
 	if(Fd == NULL){
@@ -153,41 +673,30 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 	PortNum[FileSize] = '\0';
 	printf("[AIE INFO]: Connecting to simulator - localhost:%s\n", PortNum);
 
-	memset(&hints, 0, sizeof(struct addrinfo));
-	hints.ai_family = AF_INET;
-	hints.ai_socktype = SOCK_STREAM;
-	hints.ai_protocol = IPPROTO_TCP;
-
-	ret = getaddrinfo("localhost", PortNum, &hints, &slist);
-	if(ret != 0) {
-		XAIE_ERROR("get addr info failed. ec %s\n", gai_strerror(ret));
-		return XAIE_ERR;
-	}
-
-	for(p = slist; p != NULL; p = p->ai_next) {
-
-		SocketFd = socket(p->ai_family, p->ai_socktype, p->ai_protocol);
-		if(SocketFd < 0)
-			continue;
-
-		ret = connect(SocketFd, p->ai_addr, p->ai_addrlen);
-		if(ret != -1)
-			break;
-
-		close(SocketFd);
-	}
-
-	if(p == NULL) {
-		XAIE_ERROR("failed to connect to sim\n");
+	if(_XAie_SocketIO_Connect(PortNum, &SocketFd) != XAIE_OK) {
+		_XAie_MutexDestroy(IOInst->Lock);
+		free(IOInst);
+		free(PortNum);
 		return XAIE_ERR;
 	}
 
 	IOInst->SocketFd = SocketFd;
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->Binary = 0U;
+	IOInst->SndLen = 0U;
+	if(_XAie_SocketIO_Negotiate(IOInst, PortNum) != XAIE_OK) {
+		XAIE_ERROR("Lost connection to sim\n");
+		if(IOInst->SocketFd >= 0) {
+			close(IOInst->SocketFd);
+		}
+		_XAie_MutexDestroy(IOInst->Lock);
+		free(IOInst);
+		free(PortNum);
+		return XAIE_ERR;
+	}
 	DevInst->IOInst = IOInst;
 
-	freeaddrinfo(slist);
 	free(PortNum);
 	return XAIE_OK;
 }
@@ -196,12 +705,13 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 /**
 *
 * This is the memory IO function to write 32bit data to the specified address.
+* The write is buffered until the next read, poll or flush.
 *
 * @param	IOInst: IO instance pointer
 * @param	RegOff: Register offset to read from.
 * @param	Value: 32-bit data to be written.
 *
-* @return	None.
+* @return	XAIE_OK on success, XAIE_ERR on failure.
 *
 * @note		Internal only.
 *
@@ -209,20 +719,14 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 static AieRC XAie_SocketIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
-	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	size_t Len;
-
-	sprintf(CmdBuf, "W 0X%016lX 0X%08X\n", SocketIOInst->BaseAddr + RegOff,
-			Value);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return XAIE_ERR;
-	}
+	AieRC RC;
 
-	XAIE_DBG("SEND: %s", CmdBuf);
+	_XAie_MutexLock(SocketIOInst->Lock);
+	RC = _XAie_SocketIO_WriteAddr(SocketIOInst,
+			SocketIOInst->BaseAddr + RegOff, Value);
+	_XAie_MutexUnlock(SocketIOInst->Lock);
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -242,29 +746,129 @@ static AieRC XAie_SocketIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 static AieRC XAie_SocketIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	AieRC RC;
+
+	_XAie_MutexLock(SocketIOInst->Lock);
+	RC = _XAie_SocketIO_ReadAddr(SocketIOInst,
+			SocketIOInst->BaseAddr + RegOff, Data);
+	_XAie_MutexUnlock(SocketIOInst->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a chunk of consecutive 32-bit values with one round
+* trip. Text protocol reads are pipelined, binary protocol reads are sent as
+* one block read frame.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Addr: Absolute address
+* @param	Data: Pointer to store the 32 bit values
+* @param	Size: Number of words, at most XAIE_IO_SOCKET_RDCHUNK.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_ReadChunk(XAie_SocketIO *SocketIOInst, u64 Addr,
+		u32 *Data, u32 Size)
+{
 	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	char RdBuf[XAIE_IO_SOCKET_RDBUFSIZE];
-	size_t Len;
-	int Ret;
-
-	sprintf(CmdBuf, "R 0X%016lX\n", SocketIOInst->BaseAddr + RegOff);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return XAIE_ERR;
+	char RdBuf[XAIE_IO_SOCKET_RDCHUNK * XAIE_IO_SOCKET_RDBUFSIZE];
+	u8 *Word;
+	AieRC RC = XAIE_OK;
+	int Len;
+
+	if(SocketIOInst->Binary != 0U) {
+		RC = _XAie_SocketIO_QueueFrame(SocketIOInst,
+				XAIE_IO_SOCKET_OP_BLOCKREAD, Addr, Size, NULL,
+				0U);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_Flush(SocketIOInst);
+		}
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_Recv(SocketIOInst->SocketFd, RdBuf,
+					(size_t)Size * sizeof(u32));
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		for(u32 i = 0U; i < Size; i++) {
+			Word = (u8 *)&RdBuf[i * sizeof(u32)];
+			Data[i] = (u32)Word[0U] | ((u32)Word[1U] << 8U) |
+				((u32)Word[2U] << 16U) | ((u32)Word[3U] << 24U);
+		}
+		return XAIE_OK;
 	}
 
-	XAIE_DBG("SEND: %s", CmdBuf);
+	for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+		Len = snprintf(CmdBuf, sizeof(CmdBuf), "R 0X%016lX\n",
+				Addr + i * sizeof(u32));
+		RC = _XAie_SocketIO_Queue(SocketIOInst, CmdBuf, (size_t)Len);
+	}
+	if(RC == XAIE_OK) {
+		RC = _XAie_SocketIO_Flush(SocketIOInst);
+	}
+	if(RC == XAIE_OK) {
+		RC = _XAie_SocketIO_Recv(SocketIOInst->SocketFd, RdBuf,
+				(size_t)Size * XAIE_IO_SOCKET_RDBUFSIZE);
+	}
+	if(RC != XAIE_OK) {
+		return RC;
+	}
 
-	Ret = read(SocketIOInst->SocketFd, RdBuf, XAIE_IO_SOCKET_RDBUFSIZE);
-	if(Ret == -1) {
-		XAIE_ERROR("Failed to read from socket, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_ERR;
+	for(u32 i = 0U; i < Size; i++) {
+		/* Replies are fixed size lines, the newline ends each value */
+		Data[i] = (u32)strtoul(&RdBuf[i * XAIE_IO_SOCKET_RDBUFSIZE],
+				NULL, 0);
 	}
 
-	XAIE_DBG("RCVD: %s", RdBuf);
-	*Data = (u32)strtol(RdBuf, NULL, 0);
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of 32bit data from the
+* specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		The block is read in chunks, so that the replies of a request
+*		fit in the socket buffers. Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_SocketIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	u64 Addr = SocketIOInst->BaseAddr + RegOff;
+	AieRC RC;
+	u32 Len;
+
+	while(Size > 0U) {
+		Len = (Size > XAIE_IO_SOCKET_RDCHUNK) ?
+			XAIE_IO_SOCKET_RDCHUNK : Size;
+		_XAie_MutexLock(SocketIOInst->Lock);
+		RC = _XAie_SocketIO_ReadChunk(SocketIOInst, Addr, Data, Len);
+		_XAie_MutexUnlock(SocketIOInst->Lock);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		Addr += (u64)Len * sizeof(u32);
+		Data += Len;
+		Size -= Len;
+	}
 
 	return XAIE_OK;
 }
@@ -288,18 +892,21 @@ static AieRC XAie_SocketIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 static AieRC XAie_SocketIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	u64 Addr = SocketIOInst->BaseAddr + RegOff;
 	AieRC RC;
 	u32 RegVal;
 
-	RC = XAie_SocketIO_Read32(IOInst, RegOff, &RegVal);
-	if(RC != XAIE_OK) {
-		return RC;
+	_XAie_MutexLock(SocketIOInst->Lock);
+	RC = _XAie_SocketIO_ReadAddr(SocketIOInst, Addr, &RegVal);
+	if(RC == XAIE_OK) {
+		RegVal &= ~Mask;
+		RegVal |= Value;
+		RC = _XAie_SocketIO_WriteAddr(SocketIOInst, Addr, RegVal);
 	}
+	_XAie_MutexUnlock(SocketIOInst->Lock);
 
-	RegVal &= ~Mask;
-	RegVal |= Value;
-
-	return XAie_SocketIO_Write32(IOInst, RegOff, RegVal);
+	return RC;
 }
 
 /*****************************************************************************/
@@ -367,12 +974,25 @@ static AieRC XAie_SocketIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_SocketIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
-	for(u32 i = 0U; i < Size; i++) {
-		XAie_SocketIO_Write32(IOInst, RegOff + i * 4U, *Data);
-		Data++;
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	u64 Addr = SocketIOInst->BaseAddr + RegOff;
+	AieRC RC = XAIE_OK;
+
+	_XAie_MutexLock(SocketIOInst->Lock);
+	if(SocketIOInst->Binary != 0U) {
+		RC = _XAie_SocketIO_QueueFrame(SocketIOInst,
+				XAIE_IO_SOCKET_OP_BLOCKWRITE, Addr, Size, Data,
+				Size);
+	} else {
+		for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+			RC = _XAie_SocketIO_WriteAddr(SocketIOInst,
+					Addr + i * 4U, *Data);
+			Data++;
+		}
 	}
+	_XAie_MutexUnlock(SocketIOInst->Lock);
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -394,10 +1014,91 @@ static AieRC XAie_SocketIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_SocketIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
-	for(u32 i = 0U; i < Size; i++)
-		XAie_SocketIO_Write32(IOInst, RegOff+ i * 4U, Data);
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	u64 Addr = SocketIOInst->BaseAddr + RegOff;
+	AieRC RC = XAIE_OK;
+
+	_XAie_MutexLock(SocketIOInst->Lock);
+	if(SocketIOInst->Binary != 0U) {
+		RC = _XAie_SocketIO_QueueFrame(SocketIOInst,
+				XAIE_IO_SOCKET_OP_BLOCKSET, Addr, Size, &Data,
+				1U);
+	} else {
+		for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+			RC = _XAie_SocketIO_WriteAddr(SocketIOInst,
+					Addr + i * 4U, Data);
+		}
+	}
+	_XAie_MutexUnlock(SocketIOInst->Lock);
 
-	return XAIE_OK;
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to execute an array of transaction commands.
+* The commands are buffered and sent together, mask writes and polls send the
+* buffered commands before reading.
+*
+* @param	IOInst: IO instance pointer
+* @param	Cmds: Pointer to the commands
+* @param	NumCmds: Number of commands
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_SocketIO_ExecCmds(void *IOInst, const XAie_TxnCmd *Cmds,
+		u32 NumCmds)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 i = 0U; (i < NumCmds) && (RC == XAIE_OK); i++) {
+		const XAie_TxnCmd *Cmd = &Cmds[i];
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			if(Cmd->Mask == 0U) {
+				RC = XAie_SocketIO_Write32(IOInst, Cmd->RegOff,
+						Cmd->Value);
+			} else {
+				RC = XAie_SocketIO_MaskWrite32(IOInst,
+						Cmd->RegOff, Cmd->Mask,
+						Cmd->Value);
+			}
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			RC = XAie_SocketIO_BlockWrite32(IOInst, Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			break;
+		case XAIE_IO_BLOCKSET:
+			RC = XAie_SocketIO_BlockSet32(IOInst, Cmd->RegOff,
+					Cmd->Value, Cmd->Size);
+			break;
+		case XAIE_IO_MASKPOLL:
+			RC = XAie_SocketIO_MaskPoll(IOInst, Cmd->RegOff,
+					Cmd->Mask, Cmd->Value, 0U);
+			break;
+		default:
+			XAIE_ERROR("Invalid transaction opcode %d\n",
+					Cmd->Opcode);
+			RC = XAIE_INVALID_ARGS;
+			break;
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+
+		_XAie_MutexLock(SocketIOInst->Lock);
+		RC = _XAie_SocketIO_Flush(SocketIOInst);
+		_XAie_MutexUnlock(SocketIOInst->Lock);
+	}
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -417,18 +1118,15 @@ static AieRC XAie_SocketIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 static void _XAie_SocketIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
-	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	size_t Len;
+	AieRC RC;
 
-	sprintf(CmdBuf, "W 0X%016lX 0X%08X\n",
+	_XAie_MutexLock(SocketIOInst->Lock);
+	RC = _XAie_SocketIO_WriteAddr(SocketIOInst,
 			SocketIOInst->NpiBaseAddr + RegOff, RegVal);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return;
+	_XAie_MutexUnlock(SocketIOInst->Lock);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to submit NPI write to 0x%x\n", RegOff);
 	}
-
-	XAIE_DBG("SEND NPI: %s", CmdBuf);
 }
 
 /*****************************************************************************/
@@ -449,31 +1147,14 @@ static void _XAie_SocketIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
 static AieRC _XAie_SocketIO_NpiRead32(void *IOInst, u64 RegOff, u32 *Data)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
-	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	char RdBuf[XAIE_IO_SOCKET_RDBUFSIZE];
-	size_t Len;
-	int Ret;
-
-	sprintf(CmdBuf, "R 0X%016lX\n", SocketIOInst->NpiBaseAddr + RegOff);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return XAIE_ERR;
-	}
-
-	XAIE_DBG("SEND NPI: %s", CmdBuf);
-
-	Ret = read(SocketIOInst->SocketFd, RdBuf, XAIE_IO_SOCKET_RDBUFSIZE);
-	if(Ret == -1) {
-		XAIE_ERROR("Failed to read from socket, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_ERR;
-	}
+	AieRC RC;
 
-	XAIE_DBG("RCVD NPI: %s", RdBuf);
-	*Data = (u32)strtol(RdBuf, NULL, 0);
+	_XAie_MutexLock(SocketIOInst->Lock);
+	RC = _XAie_SocketIO_ReadAddr(SocketIOInst,
+			SocketIOInst->NpiBaseAddr + RegOff, Data);
+	_XAie_MutexUnlock(SocketIOInst->Lock);
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -533,9 +1214,8 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			XAie_ShimDmaBdArgs *BdArgs =
 				(XAie_ShimDmaBdArgs *)Arg;
 
-			XAie_SocketIO_BlockWrite32(IOInst, BdArgs->Addr,
+			return XAie_SocketIO_BlockWrite32(IOInst, BdArgs->Addr,
 				BdArgs->BdWords, BdArgs->NumBdWords);
-			break;
 		}
 		case XAIE_BACKEND_OP_NPIWR32:
 		{
@@ -567,6 +1247,17 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		case XAIE_BACKEND_OP_SET_COLUMN_CLOCK:
 			return _XAie_PrivilegeSetColumnClk(DevInst,
 					(XAie_BackendColumnReq *)Arg);
+		case XAIE_BACKEND_OP_FLUSH_IO:
+		{
+			XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+			AieRC RC;
+
+			_XAie_MutexLock(SocketIOInst->Lock);
+			RC = _XAie_SocketIO_Flush(SocketIOInst);
+			_XAie_MutexUnlock(SocketIOInst->Lock);
+
+			return RC;
+		}
 		default:
 			XAIE_ERROR("Socket backend does not support operation "
 					"%d\n", Op);
@@ -613,6 +1304,17 @@ static AieRC XAie_SocketIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	return XAIE_ERR;
 }
 
+static AieRC XAie_SocketIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+	return XAIE_ERR;
+}
+
 static AieRC XAie_SocketIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
@@ -672,6 +1374,17 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
+static AieRC XAie_SocketIO_ExecCmds(void *IOInst, const XAie_TxnCmd *Cmds,
+		u32 NumCmds)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)Cmds;
+	(void)NumCmds;
+
+	return XAIE_ERR;
+}
+
 #endif /* __AIESOCKET__ */
 
 static XAie_MemInst* XAie_SocketMemAllocate(XAie_DevInst *DevInst, u64 Size,
@@ -736,6 +1449,7 @@ const XAie_Backend SocketBackend =
 	.Ops.Finish = XAie_SocketIO_Finish,
 	.Ops.Write32 = XAie_SocketIO_Write32,
 	.Ops.Read32 = XAie_SocketIO_Read32,
+	.Ops.BlockRead32 = XAie_SocketIO_BlockRead32,
 	.Ops.MaskWrite32 = XAie_SocketIO_MaskWrite32,
 	.Ops.MaskPoll = XAie_SocketIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_SocketIO_BlockWrite32,
@@ -751,6 +1465,7 @@ const XAie_Backend SocketBackend =
 	.Ops.GetTid = XAie_IODummyGetTid,
 	.Ops.GetPartFd = XAie_IODummyGetPartFd,
 	.Ops.SubmitTxn = NULL,
+	.Ops.ExecCmds = XAie_SocketIO_ExecCmds,
 };
 
 /** @} */
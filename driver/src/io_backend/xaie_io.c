@@ -21,6 +21,7 @@
 * 1.1   Tejus   06/10/2020 Add ess simulation backend.
 * 1.2   Tejus   06/10/2020 Add cdo backend.
 * 1.3   Tejus   06/10/2020 Add helper function to get backend pointer.
+* 1.4   Tejus   10/16/2026 Add register model backend.
 * </pre>
 *
 ******************************************************************************/
@@ -43,6 +44,8 @@
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_BAREMETAL
 #elif defined (__AIESOCKET__)
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_SOCKET
+#elif defined (__AIEMODEL__)
+	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_MODEL
 #else
 	#define __AIEDEBUG__
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_DEBUG
@@ -83,6 +86,8 @@
 #else
 	#define DEBUGBACKEND NULL
 #endif
+/* The register model only needs host memory and is always available */
+#define MODELBACKEND &ModelBackend
 
 /************************** Variable Definitions *****************************/
 extern const XAie_Backend MetalBackend;
@@ -92,6 +97,7 @@ extern const XAie_Backend BaremetalBackend;
 extern const XAie_Backend DebugBackend;
 extern const XAie_Backend LinuxBackend;
 extern const XAie_Backend SocketBackend;
+extern const XAie_Backend ModelBackend;
 
 static const XAie_Backend *IOBackend[XAIE_IO_BACKEND_MAX] =
 {
@@ -102,6 +108,7 @@ static const XAie_Backend *IOBackend[XAIE_IO_BACKEND_MAX] =
 	DEBUGBACKEND,
 	LINUXBACKEND,
 	SOCKETBACKEND,
+	MODELBACKEND,
 };
 
 /************************** Function Definitions *****************************/
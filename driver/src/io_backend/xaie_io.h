@@ -19,6 +19,8 @@
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus   06/09/2020 Initial creation.
 * 1.1   Tejus   06/10/2020 Add helper function to get backend pointer.
+* 1.2   Tejus   10/16/2026 Add vectored command execution backend operation.
+* 1.3   Tejus   10/16/2026 Add block read backend operation.
 * </pre>
 *
 ******************************************************************************/
@@ -50,6 +52,8 @@ typedef enum {
 	XAIE_BACKEND_OP_SET_COLUMN_CLOCK,
 	XAIE_BACKEND_OP_PERFORMANCE_UTILIZATION,
 	XAIE_BACKEND_OP_UPDATE_SHIM_DMA_BD_ADDR,
+	XAIE_BACKEND_OP_CONFIG_MMAP_WRITE,
+	XAIE_BACKEND_OP_FLUSH_IO,
 } XAie_BackendOpCode;
 
 /*
@@ -106,6 +110,8 @@ typedef struct XAie_ShimDmaBdArgs {
  *               should be part of this function.
  * Write32     : IO operation to write 32-bit data.
  * Read32      : IO operation to read 32-bit data.
+ * BlockRead32 : Optional IO operation to read a block of data at 32-bit
+ *		 granularity. Backends without it are read one word at a time.
  * MaskWrite32 : IO operation to write masked 32-bit data.
  * MaskPoll    : IO operation to mask poll an address for a value.
  * BlockWrite32: IO operation to write a block of data at 32-bit granularity.
@@ -126,12 +132,17 @@ typedef struct XAie_ShimDmaBdArgs {
  * GetTid	: Backend operation to get unique thread id.
  * GetPartFd   : Backend operation to get unique partition fd.
  * SubmitTxn	: Backend operation to submit transaction.
+ * ExecCmds	: Optional backend operation to execute an array of write, block
+ *		  write, block set and mask poll transaction commands in order.
+ *		  Mask polls use the default timeout of the backend. Backends
+ *		  without it execute the commands one by one.
  */
 typedef struct XAie_BackendOps {
 	AieRC (*Init)(XAie_DevInst *DevInst);
 	AieRC (*Finish)(void *IOInst);
 	AieRC (*Write32)(void *IOInst, u64 RegOff, u32 Value);
 	AieRC (*Read32)(void *IOInst,  u64 RegOff, u32 *Data);
+	AieRC (*BlockRead32)(void *IOInst, u64 RegOff, u32 *Data, u32 Size);
 	AieRC (*MaskWrite32)(void *IOInst, u64 RegOff, u32 Mask, u32 Value);
 	AieRC (*MaskPoll)(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 			u32 TimeOutUs);
@@ -151,6 +162,7 @@ typedef struct XAie_BackendOps {
 	u64 (*GetTid)(void);
 	int (*GetPartFd)(void *IOInst);
 	AieRC (*SubmitTxn)(void *IOInst, XAie_TxnInst *TxnInst);
+	AieRC (*ExecCmds)(void *IOInst, const XAie_TxnCmd *Cmds, u32 NumCmds);
 	void* (*GetShimDmaBdConfig)(XAie_ShimDmaBdArgs *Args);
 	AieRC (*GetPartitionList)(XAie_DevInst *DevInst);
 } XAie_BackendOps;
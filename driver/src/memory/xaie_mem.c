@@ -24,6 +24,7 @@
 * 1.5   Tejus   06/10/2020  Switch to new io backend apis.
 * 1.6   Nishad  07/30/2020  Add API to read and write block of data from tile
 *			    data memory.
+* 1.7   Tejus   10/16/2026  Read aligned words with one block read.
 * </pre>
 *
 ******************************************************************************/
@@ -426,13 +427,17 @@ AieRC XAie_SharedDataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 A
 	}
 
 	/* Aligned bytes */
-	for(u32 AlignedWord = 0; AlignedWord < RemBytes / 4U;
-		AlignedWord++, BytePtr += 4U, DmAddrRoundUp += 4U) {
-		RC = XAie_Read32(DevInst, DmAddrRoundUp,
-				(u32 *)(CharDst + BytePtr));
+	if(RemBytes >= XAIE_MEM_WORD_ALIGN_SIZE) {
+		RC = XAie_BlockRead32(DevInst, DmAddrRoundUp,
+				(u32 *)(CharDst + BytePtr),
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE));
 		if(RC != XAIE_OK) {
 			return RC;
 		}
+		BytePtr += XAIE_MEM_WORD_ALIGN_SIZE *
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE);
+		DmAddrRoundUp += (u64)(XAIE_MEM_WORD_ALIGN_SIZE *
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE));
 	}
 
 	/* Remaining bytes */
@@ -529,13 +534,17 @@ AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 	}
 
 	/* Aligned bytes */
-	for(u32 AlignedWord = 0; AlignedWord < RemBytes / 4U;
-		AlignedWord++, BytePtr += 4U, DmAddrRoundUp += 4U) {
-		RC = XAie_Read32(DevInst, DmAddrRoundUp,
-				(u32 *)(CharDst + BytePtr));
+	if(RemBytes >= XAIE_MEM_WORD_ALIGN_SIZE) {
+		RC = XAie_BlockRead32(DevInst, DmAddrRoundUp,
+				(u32 *)(CharDst + BytePtr),
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE));
 		if(RC != XAIE_OK) {
 			return RC;
 		}
+		BytePtr += XAIE_MEM_WORD_ALIGN_SIZE *
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE);
+		DmAddrRoundUp += (u64)(XAIE_MEM_WORD_ALIGN_SIZE *
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE));
 	}
 
 	/* Remaining bytes */
@@ -0,0 +1,755 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_util_checkpoint.c
+* @{
+*
+* This file contains routines to checkpoint the configuration of an AIE
+* partition and to restore it. The registers of the captured sections are read
+* from the device and recorded as block writes of a transaction, which is
+* optimized and serialized. Restoring a checkpoint submits the serialized
+* transaction, so that the configuration is replayed with a single submission
+* instead of rerunning the configuration program of the application.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* 1.1   Tejus   10/16/2026  Read register ranges with block reads
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+#include "xaie_txn.h"
+#include "xaie_util_checkpoint.h"
+
+#ifdef XAIE_FEATURE_UTIL_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_CKPT_DEFAULT_RANGES	256U
+
+/**************************** Type Definitions *******************************/
+/* Range of consecutive registers captured by a checkpoint */
+typedef struct {
+	u64 RegOff;
+	u32 NumWords;
+	u32 *Data;
+} XAie_CkptRange;
+
+/* Ranges of registers captured by a checkpoint, in restore order */
+typedef struct {
+	XAie_CkptRange *Ranges;
+	u32 NumRanges;
+	u32 MaxRanges;
+} XAie_CkptRangeList;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API adds a range of registers to a checkpoint. The range is merged with
+* the last range of the list if they are consecutive.
+*
+* @param	List: Pointer to the list of ranges.
+* @param	RegOff: Offset of the first register of the range.
+* @param	NumWords: Number of registers of the range.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CkptAddRange(XAie_CkptRangeList *List, u64 RegOff,
+		u32 NumWords)
+{
+	XAie_CkptRange *Last;
+
+	if(NumWords == 0U) {
+		return XAIE_OK;
+	}
+
+	if(List->NumRanges > 0U) {
+		Last = &List->Ranges[List->NumRanges - 1U];
+		if(Last->RegOff + sizeof(u32) * (u64)Last->NumWords ==
+				RegOff) {
+			Last->NumWords += NumWords;
+			return XAIE_OK;
+		}
+	}
+
+	if(List->NumRanges == List->MaxRanges) {
+		u32 MaxRanges = (List->MaxRanges == 0U) ?
+			XAIE_CKPT_DEFAULT_RANGES : List->MaxRanges * 2U;
+		XAie_CkptRange *Ranges;
+
+		Ranges = (XAie_CkptRange *)realloc((void *)List->Ranges,
+				sizeof(*Ranges) * MaxRanges);
+		if(Ranges == NULL) {
+			XAIE_ERROR("Failed to allocate memory for checkpoint "
+					"ranges\n");
+			return XAIE_ERR;
+		}
+		List->Ranges = Ranges;
+		List->MaxRanges = MaxRanges;
+	}
+
+	List->Ranges[List->NumRanges].RegOff = RegOff;
+	List->Ranges[List->NumRanges].NumWords = NumWords;
+	List->Ranges[List->NumRanges].Data = NULL;
+	List->NumRanges++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the registers of the ports of a stream switch port array to a
+* checkpoint.
+*
+* @param	List: Pointer to the list of ranges.
+* @param	TileAddr: Address of the tile.
+* @param	Ports: Port array of the stream switch, indexed by port type.
+* @param	Stride: Offset between the registers of two ports.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CkptAddStrmPorts(XAie_CkptRangeList *List, u64 TileAddr,
+		const XAie_StrmPort *Ports, u32 Stride)
+{
+	AieRC RC;
+
+	if(Ports == NULL) {
+		return XAIE_OK;
+	}
+
+	for(u8 i = 0U; i < (u8)SS_PORT_TYPE_MAX; i++) {
+		for(u8 p = 0U; p < Ports[i].NumPorts; p++) {
+			RC = _XAie_CkptAddRange(List, TileAddr +
+					Ports[i].PortBaseAddr +
+					(u64)p * Stride, 1U);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the stream switch configuration of a tile to a checkpoint.
+*
+* @param	List: Pointer to the list of ranges.
+* @param	TileAddr: Address of the tile.
+* @param	StrmSw: Stream switch module of the tile.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CkptAddStrmSw(XAie_CkptRangeList *List, u64 TileAddr,
+		const XAie_StrmMod *StrmSw)
+{
+	AieRC RC;
+
+	RC = _XAie_CkptAddStrmPorts(List, TileAddr, StrmSw->MstrConfig,
+			StrmSw->PortOffset);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_CkptAddStrmPorts(List, TileAddr, StrmSw->SlvConfig,
+			StrmSw->PortOffset);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return _XAie_CkptAddStrmPorts(List, TileAddr, StrmSw->SlvSlotConfig,
+			StrmSw->SlotOffsetPerPort);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the event and trace configuration of a module to a checkpoint:
+* broadcast, group event, stream port select, combo and edge detection event
+* registers and the trace control and event registers.
+*
+* @param	List: Pointer to the list of ranges.
+* @param	TileAddr: Address of the tile.
+* @param	EvntMod: Event module.
+* @param	TraceMod: Trace module, NULL if the module has no trace unit.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CkptAddEvents(XAie_CkptRangeList *List, u64 TileAddr,
+		const XAie_EvntMod *EvntMod, const XAie_TraceMod *TraceMod)
+{
+	u32 NumPortSelRegs = (EvntMod->StrmPortSelectIdsPerReg == 0U) ? 0U :
+		(EvntMod->NumStrmPortSelectIds +
+		 EvntMod->StrmPortSelectIdsPerReg - 1U) /
+		EvntMod->StrmPortSelectIdsPerReg;
+	const XAie_CkptRange Ranges[] = {
+		{EvntMod->BaseBroadcastRegOff, EvntMod->NumBroadcastIds, NULL},
+		{EvntMod->BaseGroupEventRegOff, EvntMod->NumGroupEvents, NULL},
+		{EvntMod->BaseStrmPortSelectRegOff, NumPortSelRegs, NULL},
+		{EvntMod->ComboInputRegOff, 1U, NULL},
+		{EvntMod->ComboCtrlRegOff, 1U, NULL},
+		{EvntMod->EdgeEventRegOff,
+			(EvntMod->NumEdgeSelectIds != 0U) ? 1U : 0U, NULL},
+	};
+	u32 NumTraceEventRegs = 0U;
+	AieRC RC;
+
+	for(u32 i = 0U; i < sizeof(Ranges) / sizeof(Ranges[0]); i++) {
+		RC = _XAie_CkptAddRange(List, TileAddr + Ranges[i].RegOff,
+				Ranges[i].NumWords);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if(TraceMod == NULL) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_CkptAddRange(List, TileAddr + TraceMod->CtrlRegOff, 1U);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_CkptAddRange(List, TileAddr + TraceMod->PktConfigRegOff, 1U);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(TraceMod->NumEventsPerSlot != 0U) {
+		NumTraceEventRegs = TraceMod->NumTraceSlotIds /
+			TraceMod->NumEventsPerSlot;
+	}
+
+	for(u32 i = 0U; i < NumTraceEventRegs; i++) {
+		RC = _XAie_CkptAddRange(List,
+				TileAddr + TraceMod->EventRegOffs[i], 1U);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the DMA channel registers of a tile to a checkpoint.
+*
+* @param	List: Pointer to the list of ranges.
+* @param	TileAddr: Address of the tile.
+* @param	DmaMod: DMA module of the tile.
+* @param	Base: Offset of the register of the first channel.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. There is a register for each channel of both
+*		directions.
+*
+******************************************************************************/
+static AieRC _XAie_CkptAddDmaChannels(XAie_CkptRangeList *List, u64 TileAddr,
+		const XAie_DmaMod *DmaMod, u32 Base)
+{
+	AieRC RC;
+
+	for(u32 Ch = 0U; Ch < 2U * (u32)DmaMod->NumChannels; Ch++) {
+		RC = _XAie_CkptAddRange(List,
+				TileAddr + Base + Ch * DmaMod->ChIdxOffset, 1U);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the configuration registers and memories of a tile to a
+* checkpoint.
+*
+* @param	DevInst: Device Instance.
+* @param	List: Pointer to the list of ranges.
+* @param	Loc: Location of the tile.
+* @param	Sections: XAIE_CHECKPOINT_* sections to capture.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. DMA channels are added separately, after the
+*		configuration of all the tiles.
+*
+******************************************************************************/
+static AieRC _XAie_CkptAddTile(XAie_DevInst *DevInst, XAie_CkptRangeList *List,
+		XAie_LocType Loc, u32 Sections)
+{
+	u8 TileType = XAie_GetTileTypefromLoc(DevInst, Loc);
+	u64 TileAddr = XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	const XAie_TileMod *TileMod = &DevInst->DevProp.DevMod[TileType];
+	AieRC RC = XAIE_OK;
+
+	if((Sections & XAIE_CHECKPOINT_STRMSW) && (TileMod->StrmSw != NULL)) {
+		RC = _XAie_CkptAddStrmSw(List, TileAddr, TileMod->StrmSw);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if((Sections & XAIE_CHECKPOINT_EVENTS) && (TileMod->EvntMod != NULL)) {
+		for(u8 i = 0U; i < TileMod->NumModules; i++) {
+			RC = _XAie_CkptAddEvents(List, TileAddr,
+					&TileMod->EvntMod[i],
+					(TileMod->TraceMod != NULL) ?
+					&TileMod->TraceMod[i] : NULL);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	/* Lock values can only be set on devices with lock value registers */
+	if((Sections & XAIE_CHECKPOINT_LOCKS) && (TileMod->LockMod != NULL) &&
+			(TileMod->LockMod->LockSetValOff != 0U)) {
+		const XAie_LockMod *LockMod = TileMod->LockMod;
+
+		for(u8 l = 0U; l < LockMod->NumLocks; l++) {
+			RC = _XAie_CkptAddRange(List, TileAddr +
+					LockMod->LockSetValBase +
+					(u64)l * LockMod->LockSetValOff, 1U);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	if((Sections & XAIE_CHECKPOINT_DMA_BD) && (TileMod->DmaMod != NULL)) {
+		RC = _XAie_CkptAddRange(List,
+				TileAddr + TileMod->DmaMod->BaseAddr,
+				(u32)TileMod->DmaMod->NumBds *
+				TileMod->DmaMod->IdxOffset / sizeof(u32));
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if((Sections & XAIE_CHECKPOINT_PROG_MEM) &&
+			(TileMod->CoreMod != NULL)) {
+		RC = _XAie_CkptAddRange(List,
+				TileAddr + TileMod->CoreMod->ProgMemHostOffset,
+				TileMod->CoreMod->ProgMemSize / sizeof(u32));
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if((Sections & XAIE_CHECKPOINT_DATA_MEM) && (TileMod->MemMod != NULL)) {
+		RC = _XAie_CkptAddRange(List,
+				TileAddr + TileMod->MemMod->MemAddr,
+				TileMod->MemMod->Size / sizeof(u32));
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API builds the list of the register ranges of a checkpoint. The
+* configuration of all the tiles comes first, the DMA channels are restored
+* last so that they only start once their buffer descriptors and locks are
+* restored.
+*
+* @param	DevInst: Device Instance.
+* @param	List: Pointer to the list of ranges.
+* @param	Sections: XAIE_CHECKPOINT_* sections to capture.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CkptBuildRanges(XAie_DevInst *DevInst,
+		XAie_CkptRangeList *List, u32 Sections)
+{
+	AieRC RC;
+
+	for(u8 Pass = 0U; Pass < 2U; Pass++) {
+		for(u8 C = 0U; C < DevInst->NumCols; C++) {
+			for(u8 R = 0U; R < DevInst->NumRows; R++) {
+				XAie_LocType Loc = XAie_TileLoc(C, R);
+				u8 TileType;
+				const XAie_DmaMod *DmaMod;
+				u64 TileAddr;
+
+				TileType = XAie_GetTileTypefromLoc(DevInst,
+						Loc);
+				if((TileType >= XAIEGBL_TILE_TYPE_MAX) ||
+						((TileType ==
+						  XAIEGBL_TILE_TYPE_MEMTILE) &&
+						 !(Sections &
+						   XAIE_CHECKPOINT_MEM_TILES))) {
+					continue;
+				}
+
+				if(Pass == 0U) {
+					RC = _XAie_CkptAddTile(DevInst, List,
+							Loc, Sections);
+					if(RC != XAIE_OK) {
+						return RC;
+					}
+					continue;
+				}
+
+				DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+				if(DmaMod == NULL) {
+					continue;
+				}
+
+				TileAddr = XAie_GetTileAddr(DevInst, R, C);
+				if(Sections & XAIE_CHECKPOINT_DMA_CH) {
+					RC = _XAie_CkptAddDmaChannels(List,
+							TileAddr, DmaMod,
+							DmaMod->ChCtrlBase);
+					if(RC != XAIE_OK) {
+						return RC;
+					}
+				}
+
+				if(Sections & XAIE_CHECKPOINT_DMA_QUEUE) {
+					RC = _XAie_CkptAddDmaChannels(List,
+							TileAddr, DmaMod,
+							DmaMod->StartQueueBase);
+					if(RC != XAIE_OK) {
+						return RC;
+					}
+				}
+			}
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the list of the register ranges of a checkpoint.
+*
+* @param	List: Pointer to the list of ranges.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_CkptFreeRanges(XAie_CkptRangeList *List)
+{
+	for(u32 i = 0U; i < List->NumRanges; i++) {
+		free(List->Ranges[i].Data);
+	}
+	free(List->Ranges);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the registers of the ranges of a checkpoint.
+*
+* @param	DevInst: Device Instance.
+* @param	List: Pointer to the list of ranges.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CkptReadRanges(XAie_DevInst *DevInst,
+		XAie_CkptRangeList *List)
+{
+	AieRC RC;
+
+	for(u32 i = 0U; i < List->NumRanges; i++) {
+		XAie_CkptRange *Range = &List->Ranges[i];
+
+		Range->Data = (u32 *)malloc(sizeof(u32) *
+				(u64)Range->NumWords);
+		if(Range->Data == NULL) {
+			XAIE_ERROR("Failed to allocate memory for checkpoint "
+					"data\n");
+			return XAIE_ERR;
+		}
+
+		RC = XAie_BlockRead32(DevInst, Range->RegOff, Range->Data,
+				Range->NumWords);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to read registers 0x%lx - 0x%lx\n",
+					Range->RegOff, Range->RegOff +
+					sizeof(u32) * (u64)Range->NumWords);
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API captures the configuration of a partition in a checkpoint. The
+* registers of the requested sections are read from the device and recorded as
+* block writes of an optimized transaction, which is exported in the compact
+* serialized format.
+*
+* @param	DevInst: Device Instance.
+* @param	Sections: XAIE_CHECKPOINT_* sections to capture, or
+*		XAIE_CHECKPOINT_DEFAULT.
+* @param	Ckpt: Pointer to return the checkpoint. It must be released with
+*		XAie_CheckpointFree().
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The calling thread must not have a transaction in progress. The
+*		partition should be quiesced, registers changed by the hardware
+*		while they are read are captured in an inconsistent state. Start
+*		queues are only restored with XAIE_CHECKPOINT_DMA_QUEUE, writing
+*		them enqueues the captured buffer descriptors again.
+*
+******************************************************************************/
+AieRC XAie_CheckpointCapture(XAie_DevInst *DevInst, u32 Sections,
+		XAie_Checkpoint *Ckpt)
+{
+	XAie_CkptRangeList List = {NULL, 0U, 0U};
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Ckpt == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Ckpt->Txn = NULL;
+	Ckpt->Size = 0U;
+
+	RC = _XAie_CkptBuildRanges(DevInst, &List, Sections);
+	if(RC == XAIE_OK) {
+		RC = _XAie_CkptReadRanges(DevInst, &List);
+	}
+	if(RC != XAIE_OK) {
+		_XAie_CkptFreeRanges(&List);
+		return RC;
+	}
+
+	RC = XAie_StartTransaction(DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH |
+			XAIE_TRANSACTION_ENABLE_OPTIMIZE);
+	if(RC != XAIE_OK) {
+		_XAie_CkptFreeRanges(&List);
+		return RC;
+	}
+
+	for(u32 i = 0U; i < List.NumRanges; i++) {
+		RC = XAie_BlockWrite32(DevInst, List.Ranges[i].RegOff,
+				List.Ranges[i].Data, List.Ranges[i].NumWords);
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+	_XAie_CkptFreeRanges(&List);
+
+	if(RC == XAIE_OK) {
+		Ckpt->Txn = XAie_ExportSerializedTransaction(DevInst, 0U,
+				XAIE_TRANSACTION_EXPORT_COMPACT);
+		if(Ckpt->Txn == NULL) {
+			RC = XAIE_ERR;
+		} else {
+			Ckpt->Size = ((XAie_TxnHeader *)Ckpt->Txn)->TxnSize;
+		}
+	}
+
+	XAie_ClearTransaction(DevInst);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API restores the configuration of a partition from a checkpoint. The
+* checkpoint is submitted as a single transaction.
+*
+* @param	DevInst: Device Instance.
+* @param	Ckpt: Pointer to the checkpoint.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The checkpoint must be captured from a partition of the same
+*		device generation and geometry.
+*
+******************************************************************************/
+AieRC XAie_CheckpointRestore(XAie_DevInst *DevInst,
+		const XAie_Checkpoint *Ckpt)
+{
+	if((DevInst == XAIE_NULL) || (Ckpt == NULL) || (Ckpt->Txn == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_SubmitSerializedTransaction(DevInst, Ckpt->Txn, Ckpt->Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API saves a checkpoint to a file.
+*
+* @param	Ckpt: Pointer to the checkpoint.
+* @param	Path: Path of the file.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_CheckpointSave(const XAie_Checkpoint *Ckpt, const char *Path)
+{
+	FILE *Fd;
+	size_t Len;
+
+	if((Ckpt == NULL) || (Ckpt->Txn == NULL) || (Path == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Fd = fopen(Path, "wb");
+	if(Fd == NULL) {
+		XAIE_ERROR("Failed to open %s\n", Path);
+		return XAIE_ERR;
+	}
+
+	Len = fwrite((const void *)Ckpt->Txn, 1U, Ckpt->Size, Fd);
+	if((fclose(Fd) != 0) || (Len != Ckpt->Size)) {
+		XAIE_ERROR("Failed to write checkpoint to %s\n", Path);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads a checkpoint saved with XAie_CheckpointSave().
+*
+* @param	Ckpt: Pointer to return the checkpoint. It must be released with
+*		XAie_CheckpointFree().
+* @param	Path: Path of the file.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The content of the checkpoint is validated against the device
+*		instance when it is restored.
+*
+******************************************************************************/
+AieRC XAie_CheckpointLoad(XAie_Checkpoint *Ckpt, const char *Path)
+{
+	FILE *Fd;
+	long Len;
+
+	if((Ckpt == NULL) || (Path == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Ckpt->Txn = NULL;
+	Ckpt->Size = 0U;
+
+	Fd = fopen(Path, "rb");
+	if(Fd == NULL) {
+		XAIE_ERROR("Failed to open %s\n", Path);
+		return XAIE_ERR;
+	}
+
+	if((fseek(Fd, 0L, SEEK_END) != 0) || ((Len = ftell(Fd)) <= 0) ||
+			((u64)Len > UINT32_MAX) ||
+			(fseek(Fd, 0L, SEEK_SET) != 0)) {
+		XAIE_ERROR("Invalid checkpoint file %s\n", Path);
+		fclose(Fd);
+		return XAIE_ERR;
+	}
+
+	Ckpt->Txn = (u8 *)malloc((size_t)Len);
+	if(Ckpt->Txn == NULL) {
+		XAIE_ERROR("Failed to allocate memory for checkpoint\n");
+		fclose(Fd);
+		return XAIE_ERR;
+	}
+
+	if(fread((void *)Ckpt->Txn, 1U, (size_t)Len, Fd) != (size_t)Len) {
+		XAIE_ERROR("Failed to read checkpoint from %s\n", Path);
+		fclose(Fd);
+		XAie_CheckpointFree(Ckpt);
+		return XAIE_ERR;
+	}
+
+	fclose(Fd);
+	Ckpt->Size = (u32)Len;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the memory of a checkpoint.
+*
+* @param	Ckpt: Pointer to the checkpoint.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_CheckpointFree(XAie_Checkpoint *Ckpt)
+{
+	if(Ckpt == NULL) {
+		return;
+	}
+
+	free(Ckpt->Txn);
+	Ckpt->Txn = NULL;
+	Ckpt->Size = 0U;
+}
+
+#endif /* XAIE_FEATURE_UTIL_ENABLE */
+/** @} */
@@ -0,0 +1,75 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_util_checkpoint.h
+* @{
+*
+* Header to include function prototypes for AIE partition checkpoint utilities
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_UTIL_CHECKPOINT_H
+#define XAIE_UTIL_CHECKPOINT_H
+
+#include "xaie_feature_config.h"
+#ifdef XAIE_FEATURE_UTIL_ENABLE
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+
+/************************** Constant Definitions *****************************/
+/* Sections of the partition state captured by a checkpoint */
+#define XAIE_CHECKPOINT_STRMSW		(1U << 0) /* Stream switch ports */
+#define XAIE_CHECKPOINT_DMA_BD		(1U << 1) /* DMA buffer descriptors */
+#define XAIE_CHECKPOINT_DMA_CH		(1U << 2) /* DMA channel controls */
+#define XAIE_CHECKPOINT_DMA_QUEUE	(1U << 3) /* DMA channel start queues */
+#define XAIE_CHECKPOINT_LOCKS		(1U << 4) /* Lock values */
+#define XAIE_CHECKPOINT_EVENTS		(1U << 5) /* Event and trace config */
+#define XAIE_CHECKPOINT_PROG_MEM	(1U << 6) /* Core program memories */
+#define XAIE_CHECKPOINT_DATA_MEM	(1U << 7) /* Data memories */
+#define XAIE_CHECKPOINT_MEM_TILES	(1U << 8) /* Include memory tiles */
+
+#define XAIE_CHECKPOINT_DEFAULT		(XAIE_CHECKPOINT_STRMSW | \
+					 XAIE_CHECKPOINT_DMA_BD | \
+					 XAIE_CHECKPOINT_DMA_CH | \
+					 XAIE_CHECKPOINT_LOCKS | \
+					 XAIE_CHECKPOINT_EVENTS | \
+					 XAIE_CHECKPOINT_PROG_MEM)
+
+/**************************** Type Definitions *******************************/
+/*
+ * Checkpoint of the configuration of a partition. The checkpoint is stored as
+ * a serialized transaction which writes the captured registers back.
+ */
+typedef struct {
+	u8 *Txn;	/* Serialized transaction */
+	u32 Size;	/* Size of the serialized transaction in bytes */
+} XAie_Checkpoint;
+
+/**************************** Function Prototypes *******************************/
+AieRC XAie_CheckpointCapture(XAie_DevInst *DevInst, u32 Sections,
+		XAie_Checkpoint *Ckpt);
+AieRC XAie_CheckpointRestore(XAie_DevInst *DevInst,
+		const XAie_Checkpoint *Ckpt);
+AieRC XAie_CheckpointSave(const XAie_Checkpoint *Ckpt, const char *Path);
+AieRC XAie_CheckpointLoad(XAie_Checkpoint *Ckpt, const char *Path);
+void XAie_CheckpointFree(XAie_Checkpoint *Ckpt);
+
+#endif  /* XAIE_FEATURE_UTIL_ENABLE */
+
+#endif	/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,177 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_model_utest.c
+* @{
+*
+* This file contains the driver of the unit tests run on the in-memory register
+* model backend. Every test runs on a freshly initialized device instance, so
+* the tests do not depend on each other. The instances are initialized with the
+* default IO backend of the driver before switching to the model, the tests
+* are skipped if the default backend is not available, such as the Linux
+* backend without an AI engine device. Build the driver with -D__AIEMODEL__ to
+* run them on any host.
+*
+* Usage: xaie_model_utest [test name]
+* All the tests are run if no test name is given. The exit status is the
+* number of failed tests.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+
+#include "xaie_utest.h"
+
+/************************** Variable Definitions *****************************/
+/*
+ * Description: Add function pointers to the test-api/s here
+ */
+static int (*tests_model[])(XAie_DevInst *DevInst) =
+{
+	test_model_io,
+	test_txn_optimize,
+	test_txn_compact,
+	test_txn_pending_read,
+	test_txn_cache,
+	test_txn_async,
+	test_reg_shadow_reset,
+	test_checkpoint,
+	test_exec_cmds,
+	test_block_read,
+};
+
+/*
+ * Description: Add the name of the test-api/s
+ */
+static const char *test_names_model[] =
+{
+	"test_model_io",
+	"test_txn_optimize",
+	"test_txn_compact",
+	"test_txn_pending_read",
+	"test_txn_cache",
+	"test_txn_async",
+	"test_reg_shadow_reset",
+	"test_checkpoint",
+	"test_exec_cmds",
+	"test_block_read",
+};
+
+/* Device instances are large, keep them off the stack */
+static XAie_DevInst DevInst;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function initializes the device instance with the default IO backend of
+* the driver.
+*
+* @param	None.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC init_dev_inst(void)
+{
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_UTEST_BASE_ADDR,
+			XAIE_UTEST_COL_SHIFT, XAIE_UTEST_ROW_SHIFT,
+			XAIE_UTEST_NUM_COLS, XAIE_UTEST_NUM_ROWS,
+			XAIE_UTEST_SHIM_ROW, XAIE_UTEST_MEM_TILE_ROW_START,
+			XAIE_UTEST_MEM_TILE_NUM_ROWS,
+			XAIE_UTEST_AIE_TILE_ROW_START,
+			XAIE_UTEST_AIE_TILE_NUM_ROWS);
+
+	memset(&DevInst, 0, sizeof(DevInst));
+
+	return XAie_CfgInitialize(&DevInst, &ConfigPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs a test on a device instance using the model backend.
+*
+* @param	Idx: Index of the test.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int run_test(u32 Idx)
+{
+	AieRC RC;
+	int Ret;
+
+	RC = init_dev_inst();
+	if(RC != XAIE_OK) {
+		printf("[utest] XAie_CfgInitialize failed.\n");
+		return -1;
+	}
+
+	RC = XAie_SetIOBackend(&DevInst, XAIE_IO_BACKEND_MODEL);
+	if(RC != XAIE_OK) {
+		printf("[utest] XAie_SetIOBackend failed.\n");
+		XAie_Finish(&DevInst);
+		return -1;
+	}
+
+	Ret = tests_model[Idx](&DevInst);
+
+	XAie_Finish(&DevInst);
+
+	return Ret;
+}
+
+int main(int argc, char **argv)
+{
+	u32 NumTests = sizeof(tests_model) / sizeof(tests_model[0]);
+	int NumFailed = 0, NumRun = 0;
+
+	if(init_dev_inst() != XAIE_OK) {
+		printf("Default IO backend is not available, tests skipped\n");
+		return 0;
+	}
+	XAie_Finish(&DevInst);
+
+	for(u32 i = 0U; i < NumTests; i++) {
+		if((argc > 1) && (strcmp(argv[1], test_names_model[i]) != 0)) {
+			continue;
+		}
+
+		NumRun++;
+		if(run_test(i) != 0) {
+			printf("%s: FAIL\n", test_names_model[i]);
+			NumFailed++;
+		} else {
+			printf("%s: PASS\n", test_names_model[i]);
+		}
+	}
+
+	if(NumRun == 0) {
+		printf("No test named %s\n", argv[1]);
+		return 1;
+	}
+
+	printf("%d of %d tests failed\n", NumFailed, NumRun);
+
+	return NumFailed;
+}
+/** @} */
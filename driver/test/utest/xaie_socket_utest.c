@@ -0,0 +1,212 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_socket_utest.c
+* @{
+*
+* This file contains the unit test of the socket backend. The test runs the
+* same register accesses with the text and with the binary protocol against
+* the reference server of driver/examples, and checks that each protocol reads
+* back the registers written with the other one. Register accesses from
+* several threads sharing the connection are checked as well.
+*
+* The driver must be built with the socket backend (-D__AIESOCKET__). Start
+* the server for two clients from the directory the test is run from:
+*	xaie_socket_ref_server 0 2 &
+*	xaie_socket_utest
+* The exit status is the number of failed protocols.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_utest.h"
+
+/************************** Constant Definitions *****************************/
+#define SOCKET_PROTOCOL_ENV	"XAIE_SOCKET_PROTOCOL"
+#define SOCKET_NUM_REGS		256U
+#define SOCKET_NUM_THREADS	4U
+#define SOCKET_NUM_ITERS	500U
+
+/************************** Variable Definitions *****************************/
+static XAie_DevInst DevInst;
+static u32 NumThreadErrors;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function returns the register offset of register Idx of the registers
+* written by a protocol.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Protocol: 0 for the text and 1 for the binary protocol.
+* @param	Idx: Index of the register.
+*
+* @return	Register offset.
+*
+* @note		None.
+*
+*******************************************************************************/
+static u64 reg_off(XAie_DevInst *DevInst, u32 Protocol, u32 Idx)
+{
+	return XAie_GetTileAddr(DevInst, 2U, (u8)Protocol) +
+		XAIE_UTEST_BD_OFF + 4U * Idx;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes and reads back registers from a thread.
+*
+* @param	Arg: Index of the thread.
+*
+* @return	NULL.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void* thread_rw(void *Arg)
+{
+	u32 Thread = (u32)(uintptr_t)Arg;
+	u64 RegOff = XAie_GetTileAddr(&DevInst, 3U, (u8)Thread) +
+		XAIE_UTEST_BD_OFF;
+	u32 Val, Errors = 0U;
+
+	for(u32 i = 0U; i < SOCKET_NUM_ITERS; i++) {
+		u32 Expected = (Thread << 24U) | i;
+
+		XAie_Write32(&DevInst, RegOff + 4U * (i % 16U), Expected);
+		if((XAie_Read32(&DevInst, RegOff + 4U * (i % 16U), &Val) !=
+					XAIE_OK) || (Val != Expected)) {
+			Errors++;
+		}
+	}
+
+	__atomic_add_fetch(&NumThreadErrors, Errors, __ATOMIC_SEQ_CST);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the test with one protocol.
+*
+* @param	Protocol: 0 for the text and 1 for the binary protocol.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		The registers written by the text protocol run are checked by
+*		the binary protocol run.
+*
+*******************************************************************************/
+static int test_socket(u32 Protocol)
+{
+	u32 Data[SOCKET_NUM_REGS], Read[SOCKET_NUM_REGS], Val;
+	pthread_t Threads[SOCKET_NUM_THREADS];
+
+	XAIE_UTEST_CHECK(DevInst.Backend->Type == XAIE_IO_BACKEND_SOCKET);
+
+	for(u32 i = 0U; i < SOCKET_NUM_REGS; i++) {
+		Data[i] = (Protocol << 28U) | (i * 7U);
+		XAie_Write32(&DevInst, reg_off(&DevInst, Protocol, i),
+				Data[i]);
+	}
+	XAie_MaskWrite32(&DevInst, reg_off(&DevInst, Protocol, 5U), 0xF0U,
+			0xA0U);
+	Data[5U] = (Data[5U] & ~0xF0U) | 0xA0U;
+	XAie_BlockSet32(&DevInst, reg_off(&DevInst, Protocol, 200U), 0x55U,
+			SOCKET_NUM_REGS - 200U);
+	for(u32 i = 200U; i < SOCKET_NUM_REGS; i++) {
+		Data[i] = 0x55U;
+	}
+	XAie_BlockWrite32(&DevInst, reg_off(&DevInst, Protocol, 100U),
+			&Data[100U], 50U);
+	XAIE_UTEST_CHECK(XAie_FlushIO(&DevInst) == XAIE_OK);
+
+	for(u32 i = 0U; i < SOCKET_NUM_REGS; i++) {
+		XAIE_UTEST_CHECK(XAie_Read32(&DevInst,
+					reg_off(&DevInst, Protocol, i), &Val) ==
+				XAIE_OK);
+		XAIE_UTEST_CHECK(Val == Data[i]);
+	}
+	XAIE_UTEST_CHECK(XAie_BlockRead32(&DevInst,
+				reg_off(&DevInst, Protocol, 0U), Read,
+				SOCKET_NUM_REGS) == XAIE_OK);
+	XAIE_UTEST_CHECK(memcmp(Read, Data, sizeof(Data)) == 0);
+	XAIE_UTEST_CHECK(XAie_MaskPoll(&DevInst,
+				reg_off(&DevInst, Protocol, 200U), 0xFFU,
+				0x55U, 100U) == XAIE_OK);
+
+	/* Registers written with the other protocol */
+	if(Protocol == 1U) {
+		XAIE_UTEST_CHECK(XAie_Read32(&DevInst,
+					reg_off(&DevInst, 0U, 7U), &Val) ==
+				XAIE_OK);
+		XAIE_UTEST_CHECK(Val == 49U);
+	}
+
+	NumThreadErrors = 0U;
+	for(u32 t = 0U; t < SOCKET_NUM_THREADS; t++) {
+		XAIE_UTEST_CHECK(pthread_create(&Threads[t], NULL, thread_rw,
+					(void *)(uintptr_t)t) == 0);
+	}
+	for(u32 t = 0U; t < SOCKET_NUM_THREADS; t++) {
+		pthread_join(Threads[t], NULL);
+	}
+	XAIE_UTEST_CHECK(NumThreadErrors == 0U);
+
+	return 0;
+}
+
+int main(void)
+{
+	int NumFailed = 0;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_UTEST_BASE_ADDR,
+			XAIE_UTEST_COL_SHIFT, XAIE_UTEST_ROW_SHIFT,
+			XAIE_UTEST_NUM_COLS, XAIE_UTEST_NUM_ROWS,
+			XAIE_UTEST_SHIM_ROW, XAIE_UTEST_MEM_TILE_ROW_START,
+			XAIE_UTEST_MEM_TILE_NUM_ROWS,
+			XAIE_UTEST_AIE_TILE_ROW_START,
+			XAIE_UTEST_AIE_TILE_NUM_ROWS);
+
+	for(u32 Protocol = 0U; Protocol < 2U; Protocol++) {
+		const char *Name = Protocol == 0U ? "text" : "binary";
+		int Ret = -1;
+
+		setenv(SOCKET_PROTOCOL_ENV, Name, 1);
+		memset(&DevInst, 0, sizeof(DevInst));
+		if(XAie_CfgInitialize(&DevInst, &ConfigPtr) == XAIE_OK) {
+			Ret = test_socket(Protocol);
+			XAie_Finish(&DevInst);
+		}
+
+		if(Ret != 0) {
+			printf("test_socket_%s: FAIL\n", Name);
+			NumFailed++;
+		} else {
+			printf("test_socket_%s: PASS\n", Name);
+		}
+	}
+
+	return NumFailed;
+}
+/** @} */
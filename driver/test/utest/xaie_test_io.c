@@ -0,0 +1,420 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_test_io.c
+* @{
+*
+* This file contains the unit tests of the register IO features. The backend
+* operations of the model are wrapped to count the accesses that reach the
+* backend.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "xaie_utest.h"
+#include "xaie_io.h"
+
+/************************** Constant Definitions *****************************/
+#define IO_CKPT_PATH		"xaie_utest_ckpt.bin"
+#define IO_NUM_WORDS		3000U
+
+/************************** Variable Definitions *****************************/
+static XAie_Backend WrapBackend;
+static const XAie_Backend *ModelBackend;
+static u32 NumWrite32;
+static u32 NumExecCmds;
+static u32 NumExecCmdsCmds;
+static u32 NumBlockRead32;
+
+/************************** Function Definitions *****************************/
+/*
+ * Backend operations counting the accesses before passing them to the model.
+ */
+static AieRC wrap_write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	NumWrite32++;
+
+	return ModelBackend->Ops.Write32(IOInst, RegOff, Value);
+}
+
+static AieRC wrap_exec_cmds(void *IOInst, const XAie_TxnCmd *Cmds,
+		u32 NumCmds)
+{
+	NumExecCmds++;
+	NumExecCmdsCmds += NumCmds;
+
+	return ModelBackend->Ops.ExecCmds(IOInst, Cmds, NumCmds);
+}
+
+static AieRC wrap_block_read32(void *IOInst, u64 RegOff, u32 *Data, u32 Size)
+{
+	NumBlockRead32++;
+
+	return ModelBackend->Ops.BlockRead32(IOInst, RegOff, Data, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function installs a copy of the model backend whose operations count
+* the accesses.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		The device instance must use the model backend.
+*
+*******************************************************************************/
+static void wrap_backend(XAie_DevInst *DevInst)
+{
+	ModelBackend = DevInst->Backend;
+	WrapBackend = *ModelBackend;
+	WrapBackend.Ops.Write32 = wrap_write32;
+	WrapBackend.Ops.ExecCmds = wrap_exec_cmds;
+	WrapBackend.Ops.BlockRead32 = wrap_block_read32;
+	DevInst->Backend = &WrapBackend;
+
+	NumWrite32 = 0U;
+	NumExecCmds = 0U;
+	NumExecCmdsCmds = 0U;
+	NumBlockRead32 = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests the register accesses of the model backend. Written
+* registers and memories must read back, across the pages of the model, and
+* words never written must read as zero.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_model_io(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 2U, 0U) + XAIE_UTEST_BD_OFF;
+	u64 MemOff = XAie_GetTileAddr(DevInst, 5U, 3U) + 0xFF0U;
+	u32 Data[16], Val;
+
+	XAIE_UTEST_CHECK(DevInst->Backend->Type == XAIE_IO_BACKEND_MODEL);
+
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0U);
+	XAIE_UTEST_CHECK(XAie_Write32(DevInst, RegOff, 0x12345678U) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_MaskWrite32(DevInst, RegOff, 0xFF00U,
+				0xAB00U) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0x1234AB78U);
+	XAIE_UTEST_CHECK(XAie_MaskPoll(DevInst, RegOff, 0xFFU, 0x78U, 10U) ==
+			XAIE_OK);
+
+	/* The block crosses a page of the model */
+	for(u32 i = 0U; i < 16U; i++) {
+		Data[i] = 0xC0000000U + i;
+	}
+	XAIE_UTEST_CHECK(XAie_BlockWrite32(DevInst, MemOff, Data, 16U) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_BlockSet32(DevInst, MemOff + 4U * 8U, 0x99U,
+				4U) == XAIE_OK);
+	for(u32 i = 0U; i < 16U; i++) {
+		XAIE_UTEST_CHECK(XAie_Read32(DevInst, MemOff + 4U * i, &Val) ==
+				XAIE_OK);
+		XAIE_UTEST_CHECK(Val == ((i >= 8U) && (i < 12U) ? 0x99U :
+					Data[i]));
+	}
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, MemOff + 4U * 16U, &Val) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0U);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests the register shadow. Writes of the shadowed value are
+* dropped, until a column reset executes, directly or from a transaction.
+* Writes to tile memories are never dropped.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		The model does not clear the registers on a reset, the test
+*		clears the register behind the driver instead.
+*
+*******************************************************************************/
+int test_reg_shadow_reset(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 2U, 1U) + XAIE_UTEST_BD_OFF;
+	u64 MemOff = XAie_GetTileAddr(DevInst, 2U, 1U);
+	u32 Val;
+
+	XAIE_UTEST_CHECK(XAie_EnableRegShadow(DevInst) == XAIE_OK);
+	wrap_backend(DevInst);
+
+	XAie_Write32(DevInst, RegOff, 5U);
+	XAie_Write32(DevInst, RegOff, 5U);
+	XAIE_UTEST_CHECK(NumWrite32 == 1U);
+
+	/* Column reset executed directly */
+	XAIE_UTEST_CHECK(XAie_ResetPartition(DevInst) == XAIE_OK);
+	ModelBackend->Ops.Write32(DevInst->IOInst, RegOff, 0U);
+	XAie_Write32(DevInst, RegOff, 5U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 5U);
+
+	/* Column reset executed from a transaction */
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_ResetPartition(DevInst) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_SubmitTransaction(DevInst, NULL) == XAIE_OK);
+	ModelBackend->Ops.Write32(DevInst->IOInst, RegOff, 0U);
+	XAie_Write32(DevInst, RegOff, 5U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 5U);
+
+	/* Data memory is not shadowed */
+	NumWrite32 = 0U;
+	XAie_Write32(DevInst, MemOff, 9U);
+	XAie_Write32(DevInst, MemOff, 9U);
+	XAIE_UTEST_CHECK(NumWrite32 == 2U);
+
+	XAIE_UTEST_CHECK(XAie_DisableRegShadow(DevInst) == XAIE_OK);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests partition checkpoints. A checkpoint saved to and loaded
+* from a file must restore the captured registers and memories.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_checkpoint(XAie_DevInst *DevInst)
+{
+	u64 BdOff = XAie_GetTileAddr(DevInst, 2U, 1U) + XAIE_UTEST_BD_OFF;
+	u64 MemTileBdOff = XAie_GetTileAddr(DevInst, 1U, 2U) + 0xA0000U;
+	u64 PmOff = XAie_GetTileAddr(DevInst, 3U, 0U) + 0x20000U;
+	u32 Pm[4] = {1U, 2U, 3U, 4U}, Data[4], Val;
+	XAie_Checkpoint Ckpt, Loaded;
+
+	XAie_Write32(DevInst, BdOff, 0x1234U);
+	XAie_Write32(DevInst, BdOff + 0x24U, 0x55U);
+	XAie_Write32(DevInst, MemTileBdOff, 0x77U);
+	XAie_BlockWrite32(DevInst, PmOff, Pm, 4U);
+
+	XAIE_UTEST_CHECK(XAie_CheckpointCapture(DevInst,
+				XAIE_CHECKPOINT_DEFAULT |
+				XAIE_CHECKPOINT_MEM_TILES, &Ckpt) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_CheckpointSave(&Ckpt, IO_CKPT_PATH) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_CheckpointLoad(&Loaded, IO_CKPT_PATH) ==
+			XAIE_OK);
+	remove(IO_CKPT_PATH);
+	XAIE_UTEST_CHECK(Loaded.Size == Ckpt.Size);
+	XAIE_UTEST_CHECK(memcmp(Loaded.Txn, Ckpt.Txn, Ckpt.Size) == 0);
+
+	XAie_Write32(DevInst, BdOff, 0U);
+	XAie_Write32(DevInst, BdOff + 0x24U, 0U);
+	XAie_Write32(DevInst, MemTileBdOff, 0U);
+	XAie_BlockSet32(DevInst, PmOff, 0U, 4U);
+
+	XAIE_UTEST_CHECK(XAie_CheckpointRestore(DevInst, &Loaded) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, BdOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0x1234U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, BdOff + 0x24U, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0x55U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, MemTileBdOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0x77U);
+	XAIE_UTEST_CHECK(XAie_BlockRead32(DevInst, PmOff, Data, 4U) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(memcmp(Data, Pm, sizeof(Pm)) == 0);
+
+	XAie_CheckpointFree(&Ckpt);
+	XAie_CheckpointFree(&Loaded);
+	XAIE_UTEST_CHECK(XAie_CheckpointLoad(&Loaded, IO_CKPT_PATH) !=
+			XAIE_OK);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests the vectored command execution. A transaction must be
+* passed to the backend in one call and execute in order.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_exec_cmds(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 2U, 2U) + XAIE_UTEST_BD_OFF;
+	u64 MemOff = XAie_GetTileAddr(DevInst, 3U, 1U);
+	static u32 Data[IO_NUM_WORDS];
+	u32 Val;
+
+	XAIE_UTEST_CHECK(DevInst->Backend->Ops.ExecCmds != NULL);
+	wrap_backend(DevInst);
+
+	for(u32 i = 0U; i < IO_NUM_WORDS; i++) {
+		Data[i] = i ^ 0x5A5AU;
+	}
+
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	for(u32 c = 0U; c < XAIE_UTEST_NUM_COLS; c++) {
+		XAie_Write32(DevInst, XAie_GetTileAddr(DevInst, 2U, (u8)c) +
+				XAIE_UTEST_BD_OFF, c + 1U);
+	}
+	XAie_MaskWrite32(DevInst, RegOff, 0xF0U, 0x70U);
+	XAie_BlockWrite32(DevInst, MemOff, Data, IO_NUM_WORDS);
+	XAie_BlockSet32(DevInst, RegOff + 0x40U, 0x77U, 16U);
+	XAie_MaskPoll(DevInst, RegOff, 0xF0U, 0x70U, 10U);
+	XAie_Write32(DevInst, RegOff + 0x40U, 0xDEADU);
+	XAIE_UTEST_CHECK(XAie_SubmitTransaction(DevInst, NULL) == XAIE_OK);
+
+	/* The poll is passed to the backend in its own call */
+	XAIE_UTEST_CHECK(NumExecCmds == 3U);
+	XAIE_UTEST_CHECK(NumExecCmdsCmds == XAIE_UTEST_NUM_COLS + 5U);
+	XAIE_UTEST_CHECK(NumWrite32 == 0U);
+
+	for(u32 c = 0U; c < XAIE_UTEST_NUM_COLS; c++) {
+		XAIE_UTEST_CHECK(XAie_Read32(DevInst, XAie_GetTileAddr(DevInst,
+						2U, (u8)c) + XAIE_UTEST_BD_OFF,
+					&Val) == XAIE_OK);
+		XAIE_UTEST_CHECK(Val == (c == 2U ? 0x73U : c + 1U));
+	}
+	for(u32 i = 0U; i < IO_NUM_WORDS; i++) {
+		XAIE_UTEST_CHECK(XAie_Read32(DevInst, MemOff + 4U * i, &Val) ==
+				XAIE_OK);
+		XAIE_UTEST_CHECK(Val == Data[i]);
+	}
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff + 0x40U, &Val) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0xDEADU);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff + 0x44U, &Val) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0x77U);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests block reads of registers and of data memory, including
+* unaligned data memory reads and reads in a transaction with pending
+* commands.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_block_read(XAie_DevInst *DevInst)
+{
+	u64 MemOff = XAie_GetTileAddr(DevInst, 3U, 1U) + 0xF00U;
+	u64 BdOff = XAie_GetTileAddr(DevInst, 3U, 3U) + XAIE_UTEST_BD_OFF;
+	XAie_LocType Loc = XAie_TileLoc(1, 3);
+	static u32 Data[IO_NUM_WORDS], Read[IO_NUM_WORDS];
+	u8 Bytes[1001], ReadBytes[1001];
+
+	XAIE_UTEST_CHECK(XAie_PmRequestTiles(DevInst, NULL, 0U) == XAIE_OK);
+	wrap_backend(DevInst);
+
+	for(u32 i = 0U; i < IO_NUM_WORDS; i++) {
+		Data[i] = i * 2654435761U;
+	}
+	XAIE_UTEST_CHECK(XAie_BlockWrite32(DevInst, MemOff, Data,
+				IO_NUM_WORDS) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_BlockRead32(DevInst, MemOff, Read,
+				IO_NUM_WORDS) == XAIE_OK);
+	XAIE_UTEST_CHECK(memcmp(Data, Read, sizeof(Data)) == 0);
+	XAIE_UTEST_CHECK(NumBlockRead32 > 0U);
+
+	/* Never written words read as zero */
+	XAIE_UTEST_CHECK(XAie_BlockRead32(DevInst, MemOff + 4U * IO_NUM_WORDS,
+				Read, 100U) == XAIE_OK);
+	for(u32 i = 0U; i < 100U; i++) {
+		XAIE_UTEST_CHECK(Read[i] == 0U);
+	}
+
+	/* Pending configuration writes are read without flushing */
+	XAIE_UTEST_CHECK(XAie_BlockWrite32(DevInst, BdOff, Data, 8U) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH |
+				XAIE_TRANSACTION_DEFER_READS) == XAIE_OK);
+	XAie_Write32(DevInst, BdOff + 4U, 11U);
+	XAie_Write32(DevInst, BdOff + 8U, 12U);
+	NumBlockRead32 = 0U;
+	XAIE_UTEST_CHECK(XAie_BlockRead32(DevInst, BdOff, Read, 8U) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(NumBlockRead32 == 1U);
+	for(u32 i = 0U; i < 8U; i++) {
+		XAIE_UTEST_CHECK(Read[i] == (i == 1U ? 11U :
+					i == 2U ? 12U : Data[i]));
+	}
+
+	/* Other words flush the pending commands once */
+	XAie_Write32(DevInst, MemOff, 13U);
+	NumBlockRead32 = 0U;
+	XAIE_UTEST_CHECK(XAie_BlockRead32(DevInst, MemOff, Read, 100U) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(NumBlockRead32 == 1U);
+	XAIE_UTEST_CHECK(Read[0] == 13U);
+	XAIE_UTEST_CHECK(memcmp(&Data[1], &Read[1], 99U * sizeof(u32)) == 0);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, BdOff + 4U, Read) == XAIE_OK);
+	XAIE_UTEST_CHECK(Read[0] == 11U);
+
+	for(u32 i = 0U; i < sizeof(Bytes); i++) {
+		Bytes[i] = (u8)(i * 7U + 1U);
+	}
+	XAIE_UTEST_CHECK(XAie_DataMemBlockWrite(DevInst, Loc, 3U, Bytes,
+				sizeof(Bytes)) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_DataMemBlockRead(DevInst, Loc, 3U, ReadBytes,
+				sizeof(ReadBytes)) == XAIE_OK);
+	XAIE_UTEST_CHECK(memcmp(Bytes, ReadBytes, sizeof(Bytes)) == 0);
+
+	return 0;
+}
+/** @} */
@@ -0,0 +1,682 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_test_txn.c
+* @{
+*
+* This file contains the unit tests of the transaction features. The tests
+* check the registers of the model backend after the transactions executed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "xaie_utest.h"
+
+/************************** Constant Definitions *****************************/
+#define TXN_NUM_REGS		32U /* Registers of the random sequences */
+#define TXN_RUN_OFF		0x100U /* Offset of the contiguous writes */
+#define TXN_RUN_NUM_REGS	8U
+#define TXN_NUM_ASYNC		16U
+
+/************************** Variable Definitions *****************************/
+static u32 CustomOpCount;
+static u32 CustomOpSum;
+static u32 FenceCbCount;
+static AieRC FenceCbRC;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function returns the next value of a pseudo random sequence, so that the
+* recorded transactions are the same on every run.
+*
+* @param	Seed: Pointer to the state of the sequence.
+*
+* @return	Pseudo random value.
+*
+* @note		None.
+*
+*******************************************************************************/
+static u32 utest_rand(u32 *Seed)
+{
+	*Seed = *Seed * 1103515245U + 12345U;
+
+	return *Seed >> 16U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function records a sequence of writes, masked writes and block writes
+* to TXN_NUM_REGS registers from RegOff, followed by TXN_RUN_NUM_REGS
+* contiguous writes from RegOff + TXN_RUN_OFF.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset of the first register.
+* @param	NumOps: Number of random operations.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void record_random(XAie_DevInst *DevInst, u64 RegOff, u32 NumOps)
+{
+	u32 Seed = 1U;
+
+	for(u32 i = 0U; i < NumOps; i++) {
+		u64 Off = RegOff + 4U * (utest_rand(&Seed) %
+				(TXN_NUM_REGS - 2U));
+		u32 Data[3];
+		u32 Mask;
+
+		switch(utest_rand(&Seed) % 4U) {
+		case 0U:
+			XAie_Write32(DevInst, Off, utest_rand(&Seed));
+			break;
+		case 1U:
+			Mask = utest_rand(&Seed);
+			XAie_MaskWrite32(DevInst, Off, Mask,
+					utest_rand(&Seed) & Mask);
+			break;
+		case 2U:
+			for(u32 j = 0U; j < 3U; j++) {
+				Data[j] = utest_rand(&Seed);
+			}
+			XAie_BlockWrite32(DevInst, Off, Data, 3U);
+			break;
+		default:
+			XAie_Write32(DevInst, Off, 0U);
+			break;
+		}
+	}
+
+	for(u32 i = 0U; i < TXN_RUN_NUM_REGS; i++) {
+		XAie_Write32(DevInst, RegOff + TXN_RUN_OFF + 4U * i, i + 1U);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the registers written by record_random() and clears
+* them.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset of the first register.
+* @param	Regs: Buffer of TXN_NUM_REGS + TXN_RUN_NUM_REGS words.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void read_and_clear(XAie_DevInst *DevInst, u64 RegOff, u32 *Regs)
+{
+	XAie_BlockRead32(DevInst, RegOff, Regs, TXN_NUM_REGS);
+	XAie_BlockRead32(DevInst, RegOff + TXN_RUN_OFF, &Regs[TXN_NUM_REGS],
+			TXN_RUN_NUM_REGS);
+	XAie_BlockSet32(DevInst, RegOff, 0U, TXN_NUM_REGS);
+	XAie_BlockSet32(DevInst, RegOff + TXN_RUN_OFF, 0U, TXN_RUN_NUM_REGS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the handler of the custom operation of the compact format
+* test. It counts the calls and sums the payload bytes.
+*
+* @param	DevInst: Device instance pointer.
+* @param	OpNumber: Custom operation number.
+* @param	Args: Payload of the operation.
+* @param	Size: Size of the payload.
+* @param	Priv: Unused.
+*
+* @return	XAIE_OK.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC count_op(XAie_DevInst *DevInst, u8 OpNumber, const void *Args,
+		u32 Size, void *Priv)
+{
+	(void)DevInst;
+	(void)OpNumber;
+	(void)Priv;
+
+	CustomOpCount++;
+	for(u32 i = 0U; i < Size; i++) {
+		CustomOpSum += ((const u8 *)Args)[i];
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the handler of a custom operation which delays the
+* asynchronous submissions.
+*
+* @param	DevInst: Device instance pointer.
+* @param	OpNumber: Custom operation number.
+* @param	Args: Unused.
+* @param	Size: Unused.
+* @param	Priv: Error code to return.
+*
+* @return	Error code passed in Priv.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC slow_op(XAie_DevInst *DevInst, u8 OpNumber, const void *Args,
+		u32 Size, void *Priv)
+{
+	(void)DevInst;
+	(void)OpNumber;
+	(void)Args;
+	(void)Size;
+
+	usleep(20000);
+
+	return *(const AieRC *)Priv;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the callback of the asynchronous submissions.
+*
+* @param	Fence: Completion fence.
+* @param	RC: Result of the submission.
+* @param	Arg: Unused.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void fence_cb(XAie_TxnFence *Fence, AieRC RC, void *Arg)
+{
+	(void)Fence;
+	(void)Arg;
+
+	FenceCbCount++;
+	FenceCbRC = RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests the transaction optimizer. An optimized copy of a
+* transaction must leave the registers in the same state as the original
+* transaction, with less commands. Writes to data memory must not be merged
+* and serializing a transaction must not optimize the recorded commands.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_txn_optimize(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 2U, 1U) + XAIE_UTEST_BD_OFF;
+	u64 MemOff = XAie_GetTileAddr(DevInst, 2U, 1U);
+	u32 Ref[TXN_NUM_REGS + TXN_RUN_NUM_REGS];
+	u32 Regs[TXN_NUM_REGS + TXN_RUN_NUM_REGS];
+	XAie_TxnInst *Orig, *Opt;
+	XAie_TxnOptStats Stats;
+	u32 NumCmds;
+	u8 *Txn;
+
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	record_random(DevInst, RegOff, 500U);
+	Orig = XAie_ExportTransactionInstance(DevInst);
+	Opt = XAie_ExportTransactionInstance(DevInst);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK((Orig != NULL) && (Opt != NULL));
+
+	XAIE_UTEST_CHECK(XAie_OptimizeTransaction(DevInst, Opt,
+				XAIE_TXN_OPT_ALL, &Stats) == XAIE_OK);
+	XAIE_UTEST_CHECK(Stats.NumOpsBefore == Orig->NumCmds);
+	XAIE_UTEST_CHECK(Stats.NumOpsAfter == Opt->NumCmds);
+	XAIE_UTEST_CHECK(Stats.NumOpsAfter < Stats.NumOpsBefore);
+	XAIE_UTEST_CHECK(Stats.NumCoalesced > 0U);
+
+	XAIE_UTEST_CHECK(XAie_SubmitTransaction(DevInst, Orig) == XAIE_OK);
+	read_and_clear(DevInst, RegOff, Ref);
+	XAIE_UTEST_CHECK(XAie_SubmitTransaction(DevInst, Opt) == XAIE_OK);
+	read_and_clear(DevInst, RegOff, Regs);
+	XAIE_UTEST_CHECK(memcmp(Ref, Regs, sizeof(Ref)) == 0);
+	XAIE_UTEST_CHECK(Ref[TXN_NUM_REGS + 1U] == 2U);
+
+	XAie_FreeTransactionInstance(Orig);
+	XAie_FreeTransactionInstance(Opt);
+
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	for(u32 i = 0U; i < 8U; i++) {
+		XAie_Write32(DevInst, MemOff + 4U * i, i);
+	}
+	Opt = XAie_ExportTransactionInstance(DevInst);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK(Opt != NULL);
+	XAIE_UTEST_CHECK(XAie_OptimizeTransaction(DevInst, Opt,
+				XAIE_TXN_OPT_ALL, &Stats) == XAIE_OK);
+	XAIE_UTEST_CHECK(Stats.NumCoalesced == 0U);
+	XAIE_UTEST_CHECK(Opt->NumCmds == 8U);
+	XAie_FreeTransactionInstance(Opt);
+
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH |
+				XAIE_TRANSACTION_ENABLE_OPTIMIZE) == XAIE_OK);
+	record_random(DevInst, RegOff, 500U);
+	Orig = XAie_ExportTransactionInstance(DevInst);
+	XAIE_UTEST_CHECK(Orig != NULL);
+	NumCmds = Orig->NumCmds;
+	XAie_FreeTransactionInstance(Orig);
+	Txn = XAie_ExportSerializedTransaction(DevInst, 0U, 0U);
+	XAIE_UTEST_CHECK(Txn != NULL);
+	XAIE_UTEST_CHECK(((XAie_TxnHeader *)Txn)->NumOps < NumCmds);
+	XAie_FreeSerializedTransaction(Txn);
+	Orig = XAie_ExportTransactionInstance(DevInst);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK(Orig != NULL);
+	XAIE_UTEST_CHECK(Orig->NumCmds == NumCmds);
+	XAie_FreeTransactionInstance(Orig);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests the compact serialized transaction format. A transaction
+* exported in the compact and in the legacy format must execute the same, and
+* malformed compact transactions must be rejected.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_txn_compact(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 3U, 2U) + XAIE_UTEST_BD_OFF;
+	u32 Ref[TXN_NUM_REGS + TXN_RUN_NUM_REGS];
+	u32 Regs[TXN_NUM_REGS + TXN_RUN_NUM_REGS];
+	u8 Payload[5] = {1U, 2U, 3U, 4U, 5U};
+	u32 LegacySize, CompactSize, Seed = 7U, RefSum;
+	XAie_TxnHeader *Header;
+	u8 *Legacy, *Compact, *Bad;
+	XAie_TxnInst *Inst;
+	int Op;
+
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	Op = XAie_RequestCustomTxnOp(DevInst);
+	XAIE_UTEST_CHECK(Op >= 0);
+	XAIE_UTEST_CHECK(XAie_RegisterCustomTxnOpHandler(DevInst, (u8)Op,
+				count_op, NULL) == XAIE_OK);
+	record_random(DevInst, RegOff, 300U);
+	XAie_BlockSet32(DevInst, RegOff + 4U, 0x55U, 20U);
+	XAie_MaskPoll(DevInst, RegOff + TXN_RUN_OFF, 0xFU, 0x1U, 10U);
+	XAie_AddCustomTxnOp(DevInst, (u8)Op, Payload, sizeof(Payload));
+	Legacy = XAie_ExportSerializedTransaction(DevInst, 0U, 0U);
+	Compact = XAie_ExportSerializedTransaction(DevInst, 0U,
+			XAIE_TRANSACTION_EXPORT_COMPACT);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK((Legacy != NULL) && (Compact != NULL));
+
+	LegacySize = ((XAie_TxnHeader *)Legacy)->TxnSize;
+	CompactSize = ((XAie_TxnHeader *)Compact)->TxnSize;
+	XAIE_UTEST_CHECK(CompactSize < LegacySize);
+
+	XAIE_UTEST_CHECK(XAie_SubmitSerializedTransaction(DevInst, Legacy,
+				LegacySize) == XAIE_OK);
+	read_and_clear(DevInst, RegOff, Ref);
+	RefSum = CustomOpSum;
+	XAIE_UTEST_CHECK(XAie_SubmitSerializedTransaction(DevInst, Compact,
+				CompactSize) == XAIE_OK);
+	read_and_clear(DevInst, RegOff, Regs);
+	XAIE_UTEST_CHECK(memcmp(Ref, Regs, sizeof(Ref)) == 0);
+	XAIE_UTEST_CHECK((CustomOpCount == 2U) && (CustomOpSum == 2U * RefSum));
+
+	/* Transaction size larger than the buffer */
+	XAIE_UTEST_CHECK(XAie_ImportSerializedTransaction(DevInst, Compact,
+				CompactSize - 4U) == NULL);
+
+	Bad = (u8 *)malloc(CompactSize);
+	XAIE_UTEST_CHECK(Bad != NULL);
+	Header = (XAie_TxnHeader *)Bad;
+
+	/* More records than bytes */
+	memcpy(Bad, Compact, CompactSize);
+	Header->NumOps = CompactSize;
+	XAIE_UTEST_CHECK(XAie_ImportSerializedTransaction(DevInst, Bad,
+				CompactSize) == NULL);
+
+	/* Records cut after the first bytes */
+	memcpy(Bad, Compact, CompactSize);
+	Header->TxnSize = sizeof(*Header) + 8U;
+	XAIE_UTEST_CHECK(XAie_ImportSerializedTransaction(DevInst, Bad,
+				CompactSize) == NULL);
+
+	/* Corrupted records must be rejected or decoded, never overrun */
+	for(u32 i = 0U; i < 500U; i++) {
+		memcpy(Bad, Compact, CompactSize);
+		for(u32 j = 0U; j < 1U + utest_rand(&Seed) % 4U; j++) {
+			Bad[sizeof(*Header) + utest_rand(&Seed) %
+				(CompactSize - sizeof(*Header))] ^=
+				(u8)(1U << (utest_rand(&Seed) % 8U));
+		}
+
+		Inst = XAie_ImportSerializedTransaction(DevInst, Bad,
+				CompactSize);
+		if(Inst != NULL) {
+			XAie_FreeTransactionInstance(Inst);
+		}
+	}
+
+	free(Bad);
+	XAie_FreeSerializedTransaction(Legacy);
+	XAie_FreeSerializedTransaction(Compact);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests reads of registers written by the transaction being
+* recorded. The reads must return the pending values without executing the
+* transaction.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_txn_pending_read(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 2U, 0U) + XAIE_UTEST_BD_OFF;
+	XAie_TxnInst *Inst;
+	u32 Data[16], Val;
+
+	for(u32 i = 0U; i < 16U; i++) {
+		Data[i] = 0xA0000000U + i;
+	}
+
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_Write32(DevInst, RegOff, 0x1234U);
+	XAie_MaskWrite32(DevInst, RegOff, 0xFFU, 0x56U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0x1256U);
+
+	XAie_BlockWrite32(DevInst, RegOff + 0x40U, Data, 16U);
+	XAie_MaskWrite32(DevInst, RegOff + 0x40U + 4U * 7U, 0xFU, 0x3U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff + 0x40U + 4U * 7U,
+				&Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0xA0000003U);
+
+	XAie_BlockSet32(DevInst, RegOff + 0x40U, 0x77U, 8U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff + 0x40U + 4U * 7U,
+				&Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0x77U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff + 0x40U + 4U * 8U,
+				&Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0xA0000008U);
+
+	/* Nothing was executed */
+	Inst = XAie_ExportTransactionInstance(DevInst);
+	XAIE_UTEST_CHECK((Inst != NULL) && (Inst->NumCmds == 5U));
+	XAie_FreeTransactionInstance(Inst);
+	XAie_ClearTransaction(DevInst);
+
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 0U);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests the transaction cache: hits and misses of keyed and
+* hashed transactions, verification of the contents of a hit, eviction and
+* disabling the cache.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_txn_cache(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 2U, 1U) + XAIE_UTEST_BD_OFF;
+	u64 Key1, Key2;
+	u32 Val;
+	u8 Hit;
+
+	XAIE_UTEST_CHECK(XAie_SetTxnCacheBudget(DevInst, 4096U) == XAIE_OK);
+
+	/* Miss then hit of the same transaction */
+	for(u32 i = 0U; i < 2U; i++) {
+		XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+					XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+				XAIE_OK);
+		XAie_Write32(DevInst, RegOff, 10U);
+		XAie_Write32(DevInst, RegOff + 4U, 11U);
+		XAIE_UTEST_CHECK(XAie_HashTransaction(DevInst, NULL,
+					i == 0U ? &Key1 : &Key2) == XAIE_OK);
+		XAIE_UTEST_CHECK(XAie_SubmitTransactionWithCache(DevInst,
+					NULL) == XAIE_OK);
+		XAie_Write32(DevInst, RegOff, 0U);
+	}
+	XAIE_UTEST_CHECK(Key1 == Key2);
+	XAIE_UTEST_CHECK(XAie_SubmitCachedTransaction(DevInst, Key1, &Hit) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Hit == 1U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 10U);
+
+	/* Keyed transactions */
+	XAIE_UTEST_CHECK(XAie_SubmitCachedTransaction(DevInst, 42U, &Hit) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Hit == 0U);
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_Write32(DevInst, RegOff, 100U);
+	XAIE_UTEST_CHECK(XAie_AddCachedTransaction(DevInst, 42U, NULL) ==
+			XAIE_OK);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 10U);
+	XAIE_UTEST_CHECK(XAie_SubmitCachedTransaction(DevInst, 42U, &Hit) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Hit == 1U);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 100U);
+
+	/* A cached transaction stored under the hash of another one */
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_Write32(DevInst, RegOff, 200U);
+	XAIE_UTEST_CHECK(XAie_HashTransaction(DevInst, NULL, &Key2) ==
+			XAIE_OK);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_Write32(DevInst, RegOff, 300U);
+	XAIE_UTEST_CHECK(XAie_AddCachedTransaction(DevInst, Key2, NULL) ==
+			XAIE_OK);
+	XAie_ClearTransaction(DevInst);
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_Write32(DevInst, RegOff, 200U);
+	XAIE_UTEST_CHECK(XAie_SubmitTransactionWithCache(DevInst, NULL) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 200U);
+
+	/* Least recently used transactions are evicted over the budget */
+	for(u32 k = 0U; k < 64U; k++) {
+		XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+					XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+				XAIE_OK);
+		for(u32 i = 0U; i < 8U; i++) {
+			XAie_Write32(DevInst, RegOff + 4U * i, k + i);
+		}
+		XAIE_UTEST_CHECK(XAie_AddCachedTransaction(DevInst,
+					1000U + k, NULL) == XAIE_OK);
+		XAie_ClearTransaction(DevInst);
+	}
+	XAIE_UTEST_CHECK(XAie_SubmitCachedTransaction(DevInst, 42U, &Hit) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Hit == 0U);
+	XAIE_UTEST_CHECK(XAie_SubmitCachedTransaction(DevInst, 1063U, &Hit) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Hit == 1U);
+
+	/* A zero budget disables the cache */
+	XAIE_UTEST_CHECK(XAie_SetTxnCacheBudget(DevInst, 0U) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_SubmitCachedTransaction(DevInst, 1063U, &Hit) ==
+			XAIE_OK);
+	XAIE_UTEST_CHECK(Hit == 0U);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tests asynchronous submissions. The submissions must execute
+* in order, before any later synchronous submission, and report their result
+* on their fence and callback.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int test_txn_async(XAie_DevInst *DevInst)
+{
+	u64 RegOff = XAie_GetTileAddr(DevInst, 2U, 3U) + XAIE_UTEST_BD_OFF;
+	static const AieRC SlowRC = XAIE_OK, FailRC = XAIE_ERR;
+	XAie_TxnFence *Fences[TXN_NUM_ASYNC], *Fence;
+	u8 SlowOp = XAIE_IO_CUSTOM_OP_NEXT, FailOp = SlowOp + 1U;
+	u32 Val;
+	u8 Done;
+
+	XAIE_UTEST_CHECK(XAie_RegisterCustomTxnOpHandler(DevInst, SlowOp,
+				slow_op, (void *)&SlowRC) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_RegisterCustomTxnOpHandler(DevInst, FailOp,
+				slow_op, (void *)&FailRC) == XAIE_OK);
+	FenceCbCount = 0U;
+
+	/* Later submissions overwrite the registers of earlier ones */
+	for(u32 t = 0U; t < TXN_NUM_ASYNC; t++) {
+		XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+					XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+				XAIE_OK);
+		if(t == 0U) {
+			XAie_AddCustomTxnOp(DevInst, SlowOp, &t, 1U);
+		}
+		for(u32 i = 0U; i < TXN_NUM_REGS; i++) {
+			XAie_Write32(DevInst, RegOff + 4U * i,
+					t * 1000U + i);
+		}
+		Fences[t] = XAie_SubmitTransactionAsync(DevInst, NULL,
+				fence_cb, NULL);
+		XAIE_UTEST_CHECK(Fences[t] != NULL);
+	}
+	XAIE_UTEST_CHECK(XAie_TxnFencePoll(Fences[0U], &Done) == XAIE_OK);
+	XAIE_UTEST_CHECK(Done == 0U);
+
+	for(u32 t = 0U; t < TXN_NUM_ASYNC; t++) {
+		XAIE_UTEST_CHECK(XAie_TxnFenceWait(Fences[t]) == XAIE_OK);
+		XAie_FreeTxnFence(Fences[t]);
+	}
+	XAIE_UTEST_CHECK(FenceCbCount == TXN_NUM_ASYNC);
+	for(u32 i = 0U; i < TXN_NUM_REGS; i++) {
+		XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff + 4U * i, &Val) ==
+				XAIE_OK);
+		XAIE_UTEST_CHECK(Val == (TXN_NUM_ASYNC - 1U) * 1000U + i);
+	}
+
+	/* A synchronous submission waits for the pending ones */
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_AddCustomTxnOp(DevInst, SlowOp, &Val, 1U);
+	XAie_Write32(DevInst, RegOff, 1U);
+	Fence = XAie_SubmitTransactionAsync(DevInst, NULL, NULL, NULL);
+	XAIE_UTEST_CHECK(Fence != NULL);
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_Write32(DevInst, RegOff, 2U);
+	XAIE_UTEST_CHECK(XAie_SubmitTransaction(DevInst, NULL) == XAIE_OK);
+	XAIE_UTEST_CHECK(XAie_TxnFencePoll(Fence, &Done) == XAIE_OK);
+	XAIE_UTEST_CHECK(Done == 1U);
+	XAie_FreeTxnFence(Fence);
+	XAIE_UTEST_CHECK(XAie_Read32(DevInst, RegOff, &Val) == XAIE_OK);
+	XAIE_UTEST_CHECK(Val == 2U);
+
+	/* Errors are reported on the fence and to the callback */
+	XAIE_UTEST_CHECK(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) ==
+			XAIE_OK);
+	XAie_RequestCustomTxnOp(DevInst);
+	XAie_AddCustomTxnOp(DevInst, FailOp, &Val, 1U);
+	Fence = XAie_SubmitTransactionAsync(DevInst, NULL, fence_cb, NULL);
+	XAIE_UTEST_CHECK(Fence != NULL);
+	XAIE_UTEST_CHECK(XAie_TxnFenceWait(Fence) == XAIE_ERR);
+	XAIE_UTEST_CHECK(FenceCbRC == XAIE_ERR);
+	XAie_FreeTxnFence(Fence);
+
+	/* Nothing to submit */
+	XAIE_UTEST_CHECK(XAie_SubmitTransactionAsync(DevInst, NULL, NULL,
+				NULL) == NULL);
+
+	return 0;
+}
+/** @} */
@@ -0,0 +1,81 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_utest.h
+* @{
+*
+* Header file for declaring the AIE-RT unit tests run on the in-memory register
+* model backend (XAIE_IO_BACKEND_MODEL).
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   10/16/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_UTEST_H
+#define XAIE_UTEST_H
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/*
+ * Partition the unit tests run on: 4 columns of an AIEML device with a shim
+ * row, one memory tile row and 4 AIE tile rows.
+ */
+#define XAIE_UTEST_BASE_ADDR		0x20000000000
+#define XAIE_UTEST_COL_SHIFT		25U
+#define XAIE_UTEST_ROW_SHIFT		20U
+#define XAIE_UTEST_NUM_COLS		4U
+#define XAIE_UTEST_NUM_ROWS		6U
+#define XAIE_UTEST_SHIM_ROW		0U
+#define XAIE_UTEST_MEM_TILE_ROW_START	1U
+#define XAIE_UTEST_MEM_TILE_NUM_ROWS	1U
+#define XAIE_UTEST_AIE_TILE_ROW_START	2U
+#define XAIE_UTEST_AIE_TILE_NUM_ROWS	4U
+
+/* Offset of the DMA buffer descriptors of an AIE tile */
+#define XAIE_UTEST_BD_OFF		0x1D000U
+
+/***************************** Macro Definitions *****************************/
+/*
+ * Fails the calling test if the condition does not hold.
+ */
+#define XAIE_UTEST_CHECK(Cond)						\
+	do {								\
+		if(!(Cond)) {						\
+			printf("[utest/%s] %s:%d: %s failed.\n",	\
+					__func__, __FILE__, __LINE__,	\
+					#Cond);				\
+			return -1;					\
+		}							\
+	} while(0)
+
+/************************** Function Prototypes  *****************************/
+/*
+ * Description: Add an external reference to your test-api/s here and to the
+ * tables of xaie_model_utest.c.
+ */
+extern int test_model_io(XAie_DevInst *DevInst);
+extern int test_txn_optimize(XAie_DevInst *DevInst);
+extern int test_txn_compact(XAie_DevInst *DevInst);
+extern int test_txn_pending_read(XAie_DevInst *DevInst);
+extern int test_txn_cache(XAie_DevInst *DevInst);
+extern int test_txn_async(XAie_DevInst *DevInst);
+extern int test_reg_shadow_reset(XAie_DevInst *DevInst);
+extern int test_checkpoint(XAie_DevInst *DevInst);
+extern int test_exec_cmds(XAie_DevInst *DevInst);
+extern int test_block_read(XAie_DevInst *DevInst);
+
+#endif
+/** @} */